@@ -27,17 +27,22 @@ SOURCES += \
     client/qopcuacomplexnumber.cpp \
     client/qopcuacontentfilterelement.cpp \
     client/qopcuacontentfilterelementresult.cpp \
+    client/qopcuadatasetbatch.cpp \
     client/qopcuadeletereferenceitem.cpp \
     client/qopcuadoublecomplexnumber.cpp \
     client/qopcuaelementoperand.cpp \
     client/qopcuaendpointdescription.cpp \
     client/qopcuaerrorstate.cpp \
     client/qopcuaeuinformation.cpp \
+    client/qopcuaeventbatch.cpp \
     client/qopcuaeventfilterresult.cpp \
     client/qopcuaexpandednodeid.cpp \
     client/qopcuaextensionobject.cpp \
+    client/qopcuahistorydata.cpp \
+    client/qopcuahistoryreadrequest.cpp \
     client/qopcualiteraloperand.cpp \
     client/qopcualocalizedtext.cpp \
+    client/qopcuamonitoringitem.cpp \
     client/qopcuamonitoringparameters.cpp \
     client/qopcuamultidimensionalarray.cpp \
     client/qopcuanode.cpp \
@@ -45,6 +50,7 @@ SOURCES += \
     client/qopcuanodeids.cpp \
     client/qopcuanodeimpl.cpp \
     client/qopcuapkiconfiguration.cpp \
+    client/qopcuapubsubreader.cpp \
     client/qopcuaqualifiedname.cpp \
     client/qopcuarange.cpp \
     client/qopcuareaditem.cpp \
@@ -52,6 +58,7 @@ SOURCES += \
     client/qopcuareferencedescription.cpp \
     client/qopcuarelativepathelement.cpp \
     client/qopcuasimpleattributeoperand.cpp \
+    client/qopcuatagtable.cpp \
     client/qopcuatype.cpp \
     client/qopcuausertokenpolicy.cpp \
     client/qopcuawriteitem.cpp \
@@ -77,17 +84,23 @@ HEADERS += \
     client/qopcuacomplexnumber.h \
     client/qopcuacontentfilterelement.h \
     client/qopcuacontentfilterelementresult.h \
+    client/qopcuadatasetbatch.h \
     client/qopcuadeletereferenceitem.h \
     client/qopcuadoublecomplexnumber.h \
     client/qopcuaelementoperand.h \
     client/qopcuaendpointdescription.h \
     client/qopcuaerrorstate.h \
     client/qopcuaeuinformation.h \
+    client/qopcuaeventbatch.h \
     client/qopcuaeventfilterresult.h \
     client/qopcuaexpandednodeid.h \
     client/qopcuaextensionobject.h \
+    client/qopcuaextensionobject_p.h \
+    client/qopcuahistorydata.h \
+    client/qopcuahistoryreadrequest.h \
     client/qopcualiteraloperand.h \
     client/qopcualocalizedtext.h \
+    client/qopcuamonitoringitem.h \
     client/qopcuamonitoringparameters.h \
     client/qopcuamonitoringparameters_p.h \
     client/qopcuamultidimensionalarray.h \
@@ -97,13 +110,19 @@ HEADERS += \
     client/qopcuanodeids.h \
     client/qopcuanodeimpl_p.h \
     client/qopcuapkiconfiguration.h \
+    client/qopcuapubsubreader.h \
+    client/qopcuapubsubreader_p.h \
     client/qopcuaqualifiedname.h \
     client/qopcuarange.h \
     client/qopcuareaditem.h \
     client/qopcuareadresult.h \
+    client/qopcuareadresult_p.h \
     client/qopcuareferencedescription.h \
     client/qopcuarelativepathelement.h \
     client/qopcuasimpleattributeoperand.h \
+    client/qopcuatagtable.h \
+    client/qopcuatagtable_p.h \
+    client/qopcuatype_p.h \
     client/qopcuausertokenpolicy.h \
     client/qopcuawriteitem.h \
     client/qopcuawriteresult.h \
@@ -35,6 +35,7 @@
 ****************************************************************************/
 
 #include <private/qopcuabackend_p.h>
+#include <private/qopcuatagtable_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -45,6 +46,48 @@ QOpcUaBackend::QOpcUaBackend()
 QOpcUaBackend::~QOpcUaBackend()
 {}
 
+void QOpcUaBackend::registerTagTable(quint32 tableId, const QOpcUaTagTable &table)
+{
+    m_tagTables[tableId] = table;
+}
+
+void QOpcUaBackend::unregisterTagTable(quint32 tableId)
+{
+    m_tagTables.remove(tableId);
+}
+
+QOpcUaTagTable QOpcUaBackend::tagTable(quint32 tableId) const
+{
+    return m_tagTables.value(tableId);
+}
+
+/*
+    Writes the result into the tag table if the handle belongs to a tag.
+    The client is notified once until the changed tags have been taken from the table.
+*/
+bool QOpcUaBackend::updateTagTable(quint64 handle, const QOpcUaReadResult &result)
+{
+    if (!QOpcUaTagTablePrivate::isTagHandle(handle))
+        return false;
+
+    const quint32 tableId = QOpcUaTagTablePrivate::tableId(handle);
+    auto table = m_tagTables.constFind(tableId);
+    if (table != m_tagTables.constEnd() &&
+            QOpcUaTagTablePrivate::get(*table)->update(QOpcUaTagTablePrivate::tagIndex(handle), result))
+        emit tagTableChanged(tableId);
+
+    return true;
+}
+
+void QOpcUaBackend::setTagStatusCode(quint64 handle, QOpcUa::UaStatusCode statusCode)
+{
+    const quint32 tableId = QOpcUaTagTablePrivate::tableId(handle);
+    auto table = m_tagTables.constFind(tableId);
+    if (table != m_tagTables.constEnd() &&
+            QOpcUaTagTablePrivate::get(*table)->setStatusCode(QOpcUaTagTablePrivate::tagIndex(handle), statusCode))
+        emit tagTableChanged(tableId);
+}
+
 // All attributes except Value have a fixed type.
 // A mapping between attribute id and type can be used to simplify the API for writing multiple attributes at once.
 QOpcUa::Types QOpcUaBackend::attributeIdToTypeId(QOpcUa::NodeAttribute attr)
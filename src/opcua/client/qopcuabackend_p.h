@@ -52,6 +52,7 @@
 #include <QtOpcUa/qopcuaendpointdescription.h>
 #include <private/qopcuanodeimpl_p.h>
 
+#include <QtCore/qhash.h>
 #include <QtCore/qobject.h>
 
 #include <functional>
@@ -73,20 +74,40 @@ public:
         return sizeof(std::underlying_type<QOpcUa::NodeAttribute>::type) * CHAR_BIT;
     }
 
+    // Never assigned to nodes, monitored nodes or tags, backends use it for their own monitored items
+    static constexpr quint64 InternalHandle = Q_UINT64_C(0x7fffffffffffffff);
+
     QOpcUa::Types attributeIdToTypeId(QOpcUa::NodeAttribute attr);
 
     double revisePublishingInterval(double requestedValue, double minimumValue);
     static bool verifyEndpointDescription(const QOpcUaEndpointDescription &endpoint, QString *message = nullptr);
 
+    // Tag tables receive their data changes directly on the backend thread
+    void registerTagTable(quint32 tableId, const QOpcUaTagTable &table);
+    void unregisterTagTable(quint32 tableId);
+    QOpcUaTagTable tagTable(quint32 tableId) const;
+    bool updateTagTable(quint64 handle, const QOpcUaReadResult &result);
+    void setTagStatusCode(quint64 handle, QOpcUa::UaStatusCode statusCode);
+
 Q_SIGNALS:
     void stateAndOrErrorChanged(QOpcUaClient::ClientState state,
                                 QOpcUaClient::ClientError error);
+    void connectionRecovered();
     void attributesRead(quint64 handle, QVector<QOpcUaReadResult> attributes, QOpcUa::UaStatusCode serviceResult);
     void attributeWritten(quint64 hande, QOpcUa::NodeAttribute attribute, QVariant value, QOpcUa::UaStatusCode statusCode);
     void methodCallFinished(quint64 handle, QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
 
     void dataChangeOccurred(quint64 handle, QOpcUaReadResult res);
+    void dataChangesOccurred(QVector<QPair<quint64, QOpcUaReadResult>> changes);
+    void tagTableChanged(quint32 tableId);
+    void crawlReferencesReceived(QStringList sourceNodeIds, QVector<QOpcUaReferenceDescription> references);
+    void crawlFinished(QOpcUa::UaStatusCode statusCode);
+    void registerNodesFinished(quint64 handle, QStringList nodeIds, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode);
+    void unregisterNodesFinished(quint64 handle, QStringList nodeIds, QOpcUa::UaStatusCode statusCode);
+    void historyDataReceived(QOpcUaHistoryReadRequest request, QVector<QOpcUaHistoryData> data);
+    void historyReadFinished(QOpcUaHistoryReadRequest request, QOpcUa::UaStatusCode statusCode);
     void eventOccurred(quint64 handle, QVariantList fields);
+    void eventsOccurred(quint64 handle, QOpcUaEventBatch events);
     void monitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void monitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUaMonitoringParameters param);
@@ -98,6 +119,9 @@ Q_SIGNALS:
     void findServersFinished(QVector<QOpcUaApplicationDescription> servers, QOpcUa::UaStatusCode statusCode, QUrl requestUrl);
     void readNodeAttributesFinished(QVector<QOpcUaReadResult> results, QOpcUa::UaStatusCode serviceResult);
     void writeNodeAttributesFinished(QVector<QOpcUaWriteResult> results, QOpcUa::UaStatusCode serviceResult);
+    void enableMonitoringFinished(QVector<QOpcUaMonitoringItem> results);
+    void disableMonitoringFinished(QVector<QOpcUaMonitoringItem> results);
+    void modifyMonitoringFinished(QVector<QOpcUaMonitoringItem> results);
 
     void addNodeFinished(QOpcUaExpandedNodeId requestedNodeId, QString assignedNodeId, QOpcUa::UaStatusCode statusCode);
     void deleteNodeFinished(QString nodeId, QOpcUa::UaStatusCode statusCode);
@@ -110,6 +134,8 @@ Q_SIGNALS:
 
 private:
     Q_DISABLE_COPY(QOpcUaBackend)
+
+    QHash<quint32, QOpcUaTagTable> m_tagTables;
 };
 
 static inline void qt_forEachAttribute(QOpcUa::NodeAttributes attributes, const std::function<void(QOpcUa::NodeAttribute attribute)> &f)
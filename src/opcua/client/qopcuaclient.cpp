@@ -162,6 +162,22 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
     This signal is emitted when a connection has been closed following to a close request.
 */
 
+/*!
+    \fn QOpcUaClient::connectionRecovered()
+    \since QtOpcUa 6.0
+
+    This signal is emitted after a lost connection has been reestablished automatically and
+    the subscriptions of the client have been recovered. Monitored attributes keep delivering
+    data changes without being enabled again, their subscription and monitored item ids may
+    have changed.
+
+    While the backend is trying to reconnect, the client is in the \l Connecting state.
+    Calling \l disconnectFromEndpoint() in this state stops the reconnect attempts.
+    When the connection has been recovered, the state changes back to \l Connected
+    but \l connected() is not emitted again. Automatic reconnects are enabled using
+    backend specific properties, see \l QOpcUaProvider::createClient().
+*/
+
 /*!
     \fn QOpcUaClient::connectError(QOpcUaErrorState *errorState)
     \since QtOpcUa 5.13
@@ -260,6 +276,142 @@ Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
     \sa writeNodeAttributes() QOpcUaWriteResult
 */
 
+/*!
+    \fn void QOpcUaClient::enableMonitoringFinished(QVector<QOpcUaMonitoringItem> results)
+    \since QtOpcUa 6.0
+
+    This signal is emitted after an \l enableMonitoring() operation has finished.
+
+    \a results contains one entry for each attribute of each item in the request, in the order of the request.
+    Every entry has exactly one attribute set, the parameters contain the status code for this monitored item
+    and the values revised by the server.
+
+    \sa enableMonitoring() QOpcUaMonitoringItem
+*/
+
+/*!
+    \fn void QOpcUaClient::disableMonitoringFinished(QVector<QOpcUaMonitoringItem> results)
+    \since QtOpcUa 6.0
+
+    This signal is emitted after a \l disableMonitoring() operation has finished.
+    It is also emitted with a single entry if a monitored item has been removed because its subscription timed out.
+
+    \a results contains one entry for each attribute of each item in the request. The status code
+    in the parameters of each entry indicates the result of the operation.
+
+    \sa disableMonitoring()
+*/
+
+/*!
+    \fn void QOpcUaClient::modifyMonitoringFinished(QVector<QOpcUaMonitoringItem> results)
+    \since QtOpcUa 6.0
+
+    This signal is emitted after a \l modifyMonitoring() operation has finished.
+
+    \a results contains one entry for each attribute of each item in the request.
+    The parameters of each entry contain the status code and the current parameters of the monitored item.
+
+    \sa modifyMonitoring()
+*/
+
+/*!
+    \fn void QOpcUaClient::dataChangesOccurred(QVector<QOpcUaReadResult> values)
+    \since QtOpcUa 6.0
+
+    This signal is emitted when new values for attributes monitored using \l enableMonitoring() have been received.
+    Each entry in \a values contains the node id, the attribute, the value and the timestamps of one data change.
+*/
+
+/*!
+    \fn void QOpcUaClient::tagsChanged(QOpcUaTagTable table)
+    \since QtOpcUa 6.0
+
+    This signal is emitted when tags of \a table monitored using \l enableMonitoring() have changed.
+    It is not emitted again until the changes have been taken using QOpcUaTagTable::takeChangedTags().
+*/
+
+/*!
+    \fn void QOpcUaClient::crawlReferencesReceived(QStringList sourceNodeIds, QVector<QOpcUaReferenceDescription> references)
+    \since QtOpcUa 6.0
+
+    This signal is emitted for each batch of references found by \l crawl().
+    Entry \e i of \a sourceNodeIds is the node entry \e i of \a references has been found on.
+*/
+
+/*!
+    \fn void QOpcUaClient::crawlFinished(QOpcUa::UaStatusCode statusCode)
+    \since QtOpcUa 6.0
+
+    This signal is emitted after a \l crawl() has finished.
+    \a statusCode is \l {QOpcUa::UaStatusCode} {Good} if all nodes have been browsed successfully.
+    Otherwise, it contains the last error which occurred. Nodes which could not be browsed are skipped
+    and the crawl continues with the remaining nodes. If a browse request fails as a whole, for example
+    because the connection has been lost, the crawl is aborted and no further nodes are browsed.
+    References of requests which were already in flight are still reported before this signal.
+*/
+
+/*!
+    \fn void QOpcUaClient::registerNodesFinished(QStringList nodeIds, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode)
+    \since QtOpcUa 6.0
+
+    This signal is emitted after a \l registerNodes() operation has finished.
+    Entry \e i of \a registeredNodeIds is the node id the server has assigned to entry \e i of \a nodeIds.
+    If \a statusCode is not \l {QOpcUa::UaStatusCode} {Good}, the node ids could not be registered
+    and the entries of \a registeredNodeIds are empty.
+*/
+
+/*!
+    \fn void QOpcUaClient::unregisterNodesFinished(QStringList nodeIds, QOpcUa::UaStatusCode statusCode)
+    \since QtOpcUa 6.0
+
+    This signal is emitted after an \l unregisterNodes() operation for \a nodeIds has finished
+    with status \a statusCode.
+*/
+
+/*!
+    \fn void QOpcUaClient::historyDataReceived(QOpcUaHistoryReadRequest request, QVector<QOpcUaHistoryData> data)
+    \since QtOpcUa 6.0
+
+    This signal is emitted for each batch of historical values read by \l readHistoryData() for \a request.
+    \a data contains one entry for each node of the batch. If the server has split the result
+    using continuation points, the signal is emitted again for the remaining values of a node.
+*/
+
+/*!
+    \fn void QOpcUaClient::historyReadFinished(QOpcUaHistoryReadRequest request, QOpcUa::UaStatusCode statusCode)
+    \since QtOpcUa 6.0
+
+    This signal is emitted after all data for \a request has been reported by \l historyDataReceived().
+    \a statusCode is \l {QOpcUa::UaStatusCode} {Good} if all service calls succeeded.
+    Otherwise, it contains the last service level error, results for individual nodes are reported
+    in \l QOpcUaHistoryData::statusCode().
+*/
+
+/*!
+    \fn void QOpcUaClient::eventOccurred(QString nodeId, QVariantList eventFields)
+    \since QtOpcUa 6.0
+
+    This signal is emitted when an event has been received for a node whose EventNotifier attribute
+    is monitored with an event filter using \l enableMonitoring().
+
+    \a nodeId is the node the event was received for, \a eventFields contains the values of the
+    fields specified in the select clauses of the event filter.
+*/
+
+/*!
+    \fn void QOpcUaClient::eventsOccurred(QString nodeId, QOpcUaEventBatch events)
+    \since QtOpcUa 6.0
+
+    This signal is emitted once for all events received in a notification for a node whose
+    EventNotifier attribute is monitored using \l enableMonitoring().
+
+    \a nodeId is the node the events were received for, \a events contains their fields column
+    by column. If \l eventOccurred() is connected, it is emitted for each event of the batch
+    after this signal.
+
+    This signal is currently only emitted by the open62541 backend.
+*/
+
 /*!
     \fn void QOpcUaClient::addNodeFinished(QOpcUaExpandedNodeId requestedNodeId, QString assignedNodeId, QOpcUa::UaStatusCode statusCode)
 
@@ -817,6 +969,248 @@ bool QOpcUaClient::writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWr
     return d->m_impl->writeNodeAttributes(nodesToWrite);
 }
 
+/*!
+    \since QtOpcUa 6.0
+
+    Starts monitoring the attributes of multiple nodes without creating \l QOpcUaNode objects.
+    The node id, the attributes and the monitoring parameters can be specified for every entry in \a items.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    The results are returned in the \l enableMonitoringFinished() signal.
+
+    The monitored items for all entries which are assigned to the same subscription are created
+    using a single CreateMonitoredItems service call, requests exceeding the server's limit for monitored
+    items per call are split into multiple calls. This reduces the startup time and the network overhead
+    if a large number of nodes has to be monitored.
+
+    Data changes are delivered using the \l dataChangesOccurred() signal, events using the
+    \l eventOccurred() signal.
+
+    In the following example, the value attributes of two nodes are monitored with a publishing interval of 100ms:
+    \code
+    QVector<QOpcUaMonitoringItem> request;
+    request.push_back(QOpcUaMonitoringItem("ns=2;s=Demo.Static.Scalar.Double",
+                                           QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)));
+    request.push_back(QOpcUaMonitoringItem("ns=2;s=Demo.Static.Scalar.Int32",
+                                           QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)));
+    m_client->enableMonitoring(request);
+    \endcode
+
+    This function is currently only supported by the open62541 backend.
+
+    \sa QOpcUaMonitoringItem enableMonitoringFinished() dataChangesOccurred()
+*/
+bool QOpcUaClient::enableMonitoring(const QVector<QOpcUaMonitoringItem> &items)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->enableMonitoring(items);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Stops monitoring the attributes given in \a items which have been monitored using \l enableMonitoring().
+    The parameters of the items are ignored.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    The results are returned in the \l disableMonitoringFinished() signal.
+
+    \sa enableMonitoring() disableMonitoringFinished()
+*/
+bool QOpcUaClient::disableMonitoring(const QVector<QOpcUaMonitoringItem> &items)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->disableMonitoring(items);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Modifies the sampling interval, the queue size, the discard policy and the filter
+    of the monitored items for the attributes given in \a items.
+    Subscription related parameters can't be modified using this function.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    The results are returned in the \l modifyMonitoringFinished() signal.
+
+    \sa enableMonitoring() modifyMonitoringFinished()
+*/
+bool QOpcUaClient::modifyMonitoring(const QVector<QOpcUaMonitoringItem> &items)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->modifyMonitoring(items);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Starts monitoring the value attributes of all tags in \a table using \a settings.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+    Tags whose monitored item could not be created are marked as changed and report the
+    error in QOpcUaTagTable::statusCode(). Data changes are written into \a table
+    and announced by the \l tagsChanged() signal.
+
+    Unlike monitoring the same nodes using \l QOpcUaNode or \l enableMonitoring() with a list of
+    \l QOpcUaMonitoringItem, no objects are created per node on the client side.
+
+    This function is currently only supported by the open62541 backend.
+
+    \sa disableMonitoring(const QOpcUaTagTable &) QOpcUaTagTable
+*/
+bool QOpcUaClient::enableMonitoring(const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->enableMonitoring(table, settings);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Stops monitoring the tags in \a table. The last values remain in the table.
+
+    Returns \c true if the asynchronous request has been successfully dispatched.
+
+    \sa enableMonitoring(const QOpcUaTagTable &, const QOpcUaMonitoringParameters &)
+*/
+bool QOpcUaClient::disableMonitoring(const QOpcUaTagTable &table)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->disableMonitoring(table);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Starts a breadth-first traversal of the address space beginning at \a startNodeIds.
+    The references selected by \a request are followed for at most \a maxDepth levels,
+    a negative value follows them until no unknown nodes are found anymore.
+
+    Returns \c true if the asynchronous operation has been successfully dispatched.
+    Only one crawl can be in progress at a time.
+
+    Many nodes are browsed in each request and several requests are kept in flight.
+    The references are reported in batches by \l crawlReferencesReceived() as soon as they arrive,
+    every node is browsed only once, even if it is referenced by multiple nodes.
+    Nodes on other servers are reported but not browsed.
+    \l crawlFinished() is emitted when all reachable nodes have been browsed.
+
+    In the following example, the hierarchy of the objects folder is collected:
+    \code
+    QOpcUaBrowseRequest request;
+    request.setReferenceTypeId(QOpcUa::ReferenceTypeId::HierarchicalReferences);
+    request.setIncludeSubtypes(true);
+    m_client->crawl({QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder)}, request);
+    \endcode
+
+    This function is currently only supported by the open62541 backend.
+
+    \sa crawlReferencesReceived() crawlFinished() QOpcUaNode::browse()
+*/
+bool QOpcUaClient::crawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request, int maxDepth)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->crawl(startNodeIds, request, maxDepth);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Registers the nodes in \a nodeIds with the server using the RegisterNodes service
+    specified in OPC-UA part 4, 5.8.5.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+    The result is returned in the \l registerNodesFinished() signal.
+
+    Registering tells the server that the nodes will be accessed repeatedly. Servers can respond
+    with numeric aliases for long string node ids which are cheaper to encode and to look up.
+    As long as a node is registered, the backend transparently uses the alias in
+    \l readNodeAttributes(), \l writeNodeAttributes() and in the read and write operations of QOpcUaNode,
+    results are still reported with the node id from the request.
+    The aliases are only valid for the current session, they are requested again
+    after an automatic reconnect and dropped when the client disconnects.
+
+    Registrations are counted, a node stays registered until \l unregisterNodes() has been called
+    as many times as it has been registered.
+
+    This function is currently only supported by the open62541 backend.
+
+    \sa unregisterNodes() QOpcUaNode::registerNodeId()
+*/
+bool QOpcUaClient::registerNodes(const QStringList &nodeIds)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->registerNodes(0, nodeIds);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Releases registrations of the nodes in \a nodeIds made by \l registerNodes().
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+    The result is returned in the \l unregisterNodesFinished() signal.
+
+    This function is currently only supported by the open62541 backend.
+*/
+bool QOpcUaClient::unregisterNodes(const QStringList &nodeIds)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->unregisterNodes(0, nodeIds);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Reads historical data using the HistoryRead service specified in OPC-UA part 4, 5.10.3
+    with the parameters from \a request.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+
+    The values are reported in batches by \l historyDataReceived() as soon as they arrive, the server
+    is asked for the remaining values of nodes with a continuation point until all values have been read.
+    Nodes are split into several requests if the server limits the number of nodes per HistoryRead call,
+    these requests are processed in parallel. \l historyReadFinished() is emitted when all values have been reported.
+
+    This function is currently only supported by the open62541 backend if open62541 has been built with
+    historizing support (UA_ENABLE_HISTORIZING). The open62541 sources bundled with Qt OPC UA don't
+    contain it, the function returns \c false in this case.
+
+    \sa QOpcUaHistoryReadRequest QOpcUaHistoryData
+*/
+bool QOpcUaClient::readHistoryData(const QOpcUaHistoryReadRequest &request)
+{
+    if (state() != QOpcUaClient::Connected)
+       return false;
+
+    Q_D(QOpcUaClient);
+    return d->m_impl->readHistoryData(request);
+}
+
 /*!
     Returns the name of the backend used by this instance of QOpcUaClient,
     e.g. "open62541".
@@ -41,14 +41,18 @@
 #include <QtOpcUa/qopcuaapplicationidentity.h>
 #include <QtOpcUa/qopcuapkiconfiguration.h>
 #include <QtOpcUa/qopcuanode.h>
+#include <QtOpcUa/qopcuamonitoringitem.h>
 #include <QtOpcUa/qopcuareaditem.h>
 #include <QtOpcUa/qopcuareadresult.h>
+#include <QtOpcUa/qopcuatagtable.h>
 #include <QtOpcUa/qopcuawriteitem.h>
 #include <QtOpcUa/qopcuawriteresult.h>
 #include <QtOpcUa/qopcuaaddnodeitem.h>
 #include <QtOpcUa/qopcuaaddreferenceitem.h>
 #include <QtOpcUa/qopcuadeletereferenceitem.h>
 #include <QtOpcUa/qopcuaendpointdescription.h>
+#include <QtOpcUa/qopcuahistorydata.h>
+#include <QtOpcUa/qopcuahistoryreadrequest.h>
 
 #include <QtCore/qobject.h>
 #include <QtCore/qurl.h>
@@ -117,6 +121,20 @@ public:
     bool readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead);
     bool writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite);
 
+    bool enableMonitoring(const QVector<QOpcUaMonitoringItem> &items);
+    bool disableMonitoring(const QVector<QOpcUaMonitoringItem> &items);
+    bool modifyMonitoring(const QVector<QOpcUaMonitoringItem> &items);
+
+    bool enableMonitoring(const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings);
+    bool disableMonitoring(const QOpcUaTagTable &table);
+
+    bool crawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request = QOpcUaBrowseRequest(), int maxDepth = -1);
+
+    bool registerNodes(const QStringList &nodeIds);
+    bool unregisterNodes(const QStringList &nodeIds);
+
+    bool readHistoryData(const QOpcUaHistoryReadRequest &request);
+
     bool addNode(const QOpcUaAddNodeItem &nodeToAdd);
     bool deleteNode(const QString &nodeId, bool deleteTargetReferences = true);
 
@@ -144,6 +162,7 @@ public:
 Q_SIGNALS:
     void connected();
     void disconnected();
+    void connectionRecovered();
     void stateChanged(QOpcUaClient::ClientState state);
     void errorChanged(QOpcUaClient::ClientError error);
     void connectError(QOpcUaErrorState *errorState);
@@ -153,6 +172,19 @@ Q_SIGNALS:
     void findServersFinished(QVector<QOpcUaApplicationDescription> servers, QOpcUa::UaStatusCode statusCode, QUrl requestUrl);
     void readNodeAttributesFinished(QVector<QOpcUaReadResult> results, QOpcUa::UaStatusCode serviceResult);
     void writeNodeAttributesFinished(QVector<QOpcUaWriteResult> results, QOpcUa::UaStatusCode serviceResult);
+    void enableMonitoringFinished(QVector<QOpcUaMonitoringItem> results);
+    void disableMonitoringFinished(QVector<QOpcUaMonitoringItem> results);
+    void modifyMonitoringFinished(QVector<QOpcUaMonitoringItem> results);
+    void dataChangesOccurred(QVector<QOpcUaReadResult> values);
+    void tagsChanged(QOpcUaTagTable table);
+    void crawlReferencesReceived(QStringList sourceNodeIds, QVector<QOpcUaReferenceDescription> references);
+    void crawlFinished(QOpcUa::UaStatusCode statusCode);
+    void registerNodesFinished(QStringList nodeIds, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode);
+    void unregisterNodesFinished(QStringList nodeIds, QOpcUa::UaStatusCode statusCode);
+    void historyDataReceived(QOpcUaHistoryReadRequest request, QVector<QOpcUaHistoryData> data);
+    void historyReadFinished(QOpcUaHistoryReadRequest request, QOpcUa::UaStatusCode statusCode);
+    void eventOccurred(QString nodeId, QVariantList eventFields);
+    void eventsOccurred(QString nodeId, QOpcUaEventBatch events);
     void addNodeFinished(QOpcUaExpandedNodeId requestedNodeId, QString assignedNodeId, QOpcUa::UaStatusCode statusCode);
     void deleteNodeFinished(QString nodeId, QOpcUa::UaStatusCode statusCode);
     void addReferenceFinished(QString sourceNodeId, QString referenceTypeId, QOpcUaExpandedNodeId targetNodeId, bool isForwardReference,
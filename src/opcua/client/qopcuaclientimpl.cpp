@@ -39,13 +39,20 @@
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 #include "qopcuaclient_p.h"
 #include "qopcuaerrorstate.h"
+#include "qopcuatagtable_p.h"
+
+#include <QtCore/qloggingcategory.h>
 
 QT_BEGIN_NAMESPACE
 
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
 QOpcUaClientImpl::QOpcUaClientImpl(QObject *parent)
     : QObject(parent)
     , m_client(nullptr)
     , m_handleCounter(0)
+    , m_tagTableCounter(0)
+    , m_crawlInProgress(false)
 {}
 
 QOpcUaClientImpl::~QOpcUaClientImpl()
@@ -56,38 +63,249 @@ bool QOpcUaClientImpl::registerNode(QPointer<QOpcUaNodeImpl> obj)
     if (m_handles.count() == (std::numeric_limits<int>::max)())
         return false;
 
+    const quint64 handle = nextFreeHandle();
+    obj->setHandle(handle);
+    m_handles[handle] = obj;
+    return true;
+}
+
+void QOpcUaClientImpl::unregisterNode(QPointer<QOpcUaNodeImpl> obj)
+{
+    m_handles.remove(obj->handle());
+}
+
+bool QOpcUaClientImpl::enableMonitoring(const QVector<QOpcUaMonitoringItem> &items)
+{
+    QVector<quint64> handles;
+    handles.reserve(items.size());
+    QSet<quint64> requestHandles; // Each request is counted once per node
+
+    for (const auto &item : items) {
+        auto it = m_monitoredNodeHandles.constFind(item.nodeId());
+        quint64 handle = 0;
+        if (it != m_monitoredNodeHandles.constEnd()) {
+            handle = it.value();
+        } else {
+            if (m_monitoredNodes.count() == (std::numeric_limits<int>::max)())
+                return false;
+            handle = nextFreeHandle();
+            m_monitoredNodes[handle].nodeId = item.nodeId();
+            m_monitoredNodeHandles[item.nodeId()] = handle;
+        }
+
+        // Items without attributes don't generate a result
+        if (item.attributes() && !requestHandles.contains(handle)) {
+            ++m_monitoredNodes[handle].pendingRequests;
+            requestHandles.insert(handle);
+        }
+        handles.push_back(handle);
+    }
+
+    const bool success = createMonitoredItems(handles, items);
+
+    for (const auto handle : qAsConst(handles)) {
+        if (!success && requestHandles.remove(handle))
+            --m_monitoredNodes[handle].pendingRequests;
+        releaseMonitoredNode(handle);
+    }
+
+    return success;
+}
+
+bool QOpcUaClientImpl::disableMonitoring(const QVector<QOpcUaMonitoringItem> &items)
+{
+    // Handle 0 is never assigned, the backend reports an invalid monitored item for unknown nodes
+    QVector<quint64> handles;
+    handles.reserve(items.size());
+    for (const auto &item : items)
+        handles.push_back(m_monitoredNodeHandles.value(item.nodeId(), 0));
+
+    return deleteMonitoredItems(handles, items);
+}
+
+bool QOpcUaClientImpl::modifyMonitoring(const QVector<QOpcUaMonitoringItem> &items)
+{
+    QVector<quint64> handles;
+    handles.reserve(items.size());
+    for (const auto &item : items)
+        handles.push_back(m_monitoredNodeHandles.value(item.nodeId(), 0));
+
+    return modifyMonitoredItems(handles, items);
+}
+
+bool QOpcUaClientImpl::enableMonitoring(const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings)
+{
+    QOpcUaTagTablePrivate *d = QOpcUaTagTablePrivate::get(table);
+    if (m_tagTables.contains(d->id)) {
+        qCWarning(QT_OPCUA) << "The tag table is already monitored";
+        return false;
+    }
+
+    if (!d->id) {
+        if (m_tagTableCounter == (std::numeric_limits<qint32>::max)())
+            return false;
+        d->id = ++m_tagTableCounter;
+    }
+
+    if (!createTagMonitoredItems(d->id, table, settings))
+        return false;
+
+    m_tagTables[d->id] = table;
+    return true;
+}
+
+bool QOpcUaClientImpl::disableMonitoring(const QOpcUaTagTable &table)
+{
+    const quint32 id = QOpcUaTagTablePrivate::get(table)->id;
+    if (!m_tagTables.contains(id))
+        return false;
+
+    if (!deleteTagMonitoredItems(id))
+        return false;
+
+    m_tagTables.remove(id);
+    return true;
+}
+
+bool QOpcUaClientImpl::createTagMonitoredItems(quint32 tableId, const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings)
+{
+    Q_UNUSED(tableId);
+    Q_UNUSED(table);
+    Q_UNUSED(settings);
+    qCWarning(QT_OPCUA) << "Tag tables are not supported by the backend" << backend();
+    return false;
+}
+
+bool QOpcUaClientImpl::deleteTagMonitoredItems(quint32 tableId)
+{
+    Q_UNUSED(tableId);
+    qCWarning(QT_OPCUA) << "Tag tables are not supported by the backend" << backend();
+    return false;
+}
+
+bool QOpcUaClientImpl::crawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request, int maxDepth)
+{
+    if (m_crawlInProgress) {
+        qCWarning(QT_OPCUA) << "Another crawl is still in progress";
+        return false;
+    }
+
+    if (startNodeIds.isEmpty() || !startCrawl(startNodeIds, request, maxDepth))
+        return false;
+
+    m_crawlInProgress = true;
+    return true;
+}
+
+bool QOpcUaClientImpl::startCrawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request, int maxDepth)
+{
+    Q_UNUSED(startNodeIds);
+    Q_UNUSED(request);
+    Q_UNUSED(maxDepth);
+    qCWarning(QT_OPCUA) << "Crawling is not supported by the backend" << backend();
+    return false;
+}
+
+bool QOpcUaClientImpl::registerNodes(quint64 handle, const QStringList &nodeIds)
+{
+    Q_UNUSED(handle);
+    Q_UNUSED(nodeIds);
+    qCWarning(QT_OPCUA) << "Registering nodes is not supported by the backend" << backend();
+    return false;
+}
+
+bool QOpcUaClientImpl::unregisterNodes(quint64 handle, const QStringList &nodeIds)
+{
+    Q_UNUSED(handle);
+    Q_UNUSED(nodeIds);
+    qCWarning(QT_OPCUA) << "Registering nodes is not supported by the backend" << backend();
+    return false;
+}
+
+bool QOpcUaClientImpl::readHistoryData(const QOpcUaHistoryReadRequest &request)
+{
+    Q_UNUSED(request);
+    qCWarning(QT_OPCUA) << "Reading historical data is not supported by the backend" << backend();
+    return false;
+}
+
+bool QOpcUaClientImpl::createMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items)
+{
+    Q_UNUSED(handles);
+    Q_UNUSED(items);
+    qCWarning(QT_OPCUA) << "Bulk monitored item creation is not supported by the backend" << backend();
+    return false;
+}
+
+bool QOpcUaClientImpl::deleteMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items)
+{
+    Q_UNUSED(handles);
+    Q_UNUSED(items);
+    qCWarning(QT_OPCUA) << "Bulk monitored item deletion is not supported by the backend" << backend();
+    return false;
+}
+
+bool QOpcUaClientImpl::modifyMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items)
+{
+    Q_UNUSED(handles);
+    Q_UNUSED(items);
+    qCWarning(QT_OPCUA) << "Bulk monitored item modification is not supported by the backend" << backend();
+    return false;
+}
+
+quint64 QOpcUaClientImpl::nextFreeHandle()
+{
+    // Node objects and nodes monitored by the client share the handle space of the backend,
+    // handles of tags and the internal handle of the backend are never assigned
     while (true) {
         ++m_handleCounter;
+        if (m_handleCounter >= QOpcUaBackend::InternalHandle)
+            m_handleCounter = 1;
 
-        if (!m_handles.contains(m_handleCounter)) {
-            obj->setHandle(m_handleCounter);
-            m_handles[m_handleCounter] = obj;
-            return true;
-        }
+        if (m_handleCounter && !m_handles.contains(m_handleCounter) && !m_monitoredNodes.contains(m_handleCounter))
+            return m_handleCounter;
     }
 }
 
-void QOpcUaClientImpl::unregisterNode(QPointer<QOpcUaNodeImpl> obj)
+void QOpcUaClientImpl::releaseMonitoredNode(quint64 handle)
 {
-    m_handles.remove(obj->handle());
+    auto it = m_monitoredNodes.find(handle);
+    if (it == m_monitoredNodes.end() || it->attributes || it->pendingRequests > 0)
+        return;
+
+    m_monitoredNodeHandles.remove(it->nodeId);
+    m_monitoredNodes.erase(it);
 }
 
 void QOpcUaClientImpl::connectBackendWithClient(QOpcUaBackend *backend)
 {
     connect(backend, &QOpcUaBackend::attributesRead, this, &QOpcUaClientImpl::handleAttributesRead);
     connect(backend, &QOpcUaBackend::stateAndOrErrorChanged, this, &QOpcUaClientImpl::stateAndOrErrorChanged);
+    connect(backend, &QOpcUaBackend::connectionRecovered, this, &QOpcUaClientImpl::connectionRecovered);
     connect(backend, &QOpcUaBackend::attributeWritten, this, &QOpcUaClientImpl::handleAttributeWritten);
     connect(backend, &QOpcUaBackend::dataChangeOccurred, this, &QOpcUaClientImpl::handleDataChangeOccurred);
+    connect(backend, &QOpcUaBackend::dataChangesOccurred, this, &QOpcUaClientImpl::handleDataChangesOccurred);
+    connect(backend, &QOpcUaBackend::tagTableChanged, this, &QOpcUaClientImpl::handleTagTableChanged);
+    connect(backend, &QOpcUaBackend::crawlReferencesReceived, this, &QOpcUaClientImpl::crawlReferencesReceived);
+    connect(backend, &QOpcUaBackend::crawlFinished, this, &QOpcUaClientImpl::handleCrawlFinished);
+    connect(backend, &QOpcUaBackend::registerNodesFinished, this, &QOpcUaClientImpl::handleRegisterNodesFinished);
+    connect(backend, &QOpcUaBackend::unregisterNodesFinished, this, &QOpcUaClientImpl::handleUnregisterNodesFinished);
+    connect(backend, &QOpcUaBackend::historyDataReceived, this, &QOpcUaClientImpl::historyDataReceived);
+    connect(backend, &QOpcUaBackend::historyReadFinished, this, &QOpcUaClientImpl::historyReadFinished);
     connect(backend, &QOpcUaBackend::monitoringEnableDisable, this, &QOpcUaClientImpl::handleMonitoringEnableDisable);
     connect(backend, &QOpcUaBackend::monitoringStatusChanged, this, &QOpcUaClientImpl::handleMonitoringStatusChanged);
     connect(backend, &QOpcUaBackend::methodCallFinished, this, &QOpcUaClientImpl::handleMethodCallFinished);
     connect(backend, &QOpcUaBackend::browseFinished, this, &QOpcUaClientImpl::handleBrowseFinished);
     connect(backend, &QOpcUaBackend::resolveBrowsePathFinished, this, &QOpcUaClientImpl::handleResolveBrowsePathFinished);
     connect(backend, &QOpcUaBackend::eventOccurred, this, &QOpcUaClientImpl::handleNewEvent);
+    connect(backend, &QOpcUaBackend::eventsOccurred, this, &QOpcUaClientImpl::handleNewEvents);
     connect(backend, &QOpcUaBackend::endpointsRequestFinished, this, &QOpcUaClientImpl::endpointsRequestFinished);
     connect(backend, &QOpcUaBackend::findServersFinished, this, &QOpcUaClientImpl::findServersFinished);
     connect(backend, &QOpcUaBackend::readNodeAttributesFinished, this, &QOpcUaClientImpl::readNodeAttributesFinished);
     connect(backend, &QOpcUaBackend::writeNodeAttributesFinished, this, &QOpcUaClientImpl::writeNodeAttributesFinished);
+    connect(backend, &QOpcUaBackend::enableMonitoringFinished, this, &QOpcUaClientImpl::handleEnableMonitoringFinished);
+    connect(backend, &QOpcUaBackend::disableMonitoringFinished, this, &QOpcUaClientImpl::handleDisableMonitoringFinished);
+    connect(backend, &QOpcUaBackend::modifyMonitoringFinished, this, &QOpcUaClientImpl::modifyMonitoringFinished);
     connect(backend, &QOpcUaBackend::addNodeFinished, this, &QOpcUaClientImpl::addNodeFinished);
     connect(backend, &QOpcUaBackend::deleteNodeFinished, this, &QOpcUaClientImpl::deleteNodeFinished);
     connect(backend, &QOpcUaBackend::addReferenceFinished, this, &QOpcUaClientImpl::addReferenceFinished);
@@ -113,13 +331,63 @@ void QOpcUaClientImpl::handleAttributeWritten(quint64 handle, QOpcUa::NodeAttrib
 
 void QOpcUaClientImpl::handleDataChangeOccurred(quint64 handle, const QOpcUaReadResult &value)
 {
+    auto monitoredNode = m_monitoredNodes.constFind(handle);
+    if (monitoredNode != m_monitoredNodes.constEnd()) {
+        QOpcUaReadResult result = value;
+        result.setNodeId(monitoredNode->nodeId);
+        emit dataChangesOccurred({result});
+        return;
+    }
+
     auto it = m_handles.constFind(handle);
     if (it != m_handles.constEnd() && !it->isNull())
         emit (*it)->dataChangeOccurred(value.attribute(), value);
 }
 
+void QOpcUaClientImpl::handleDataChangesOccurred(const QVector<QPair<quint64, QOpcUaReadResult>> &changes)
+{
+    // Consecutive changes for the same node are delivered to the node with a single signal
+    QVector<QOpcUaReadResult> values;
+    QVector<QOpcUaReadResult> monitoredNodeValues;
+    for (int i = 0; i < changes.size(); ++i) {
+        const quint64 handle = changes.at(i).first;
+
+        auto monitoredNode = m_monitoredNodes.constFind(handle);
+        if (monitoredNode != m_monitoredNodes.constEnd()) {
+            monitoredNodeValues.append(changes.at(i).second);
+            monitoredNodeValues.last().setNodeId(monitoredNode->nodeId);
+            continue;
+        }
+
+        values.append(changes.at(i).second);
+
+        if (i + 1 < changes.size() && changes.at(i + 1).first == handle)
+            continue;
+
+        auto it = m_handles.constFind(handle);
+        if (it != m_handles.constEnd() && !it->isNull())
+            emit (*it)->dataChangesOccurred(values);
+        values.clear();
+    }
+
+    if (!monitoredNodeValues.isEmpty())
+        emit dataChangesOccurred(monitoredNodeValues);
+}
+
 void QOpcUaClientImpl::handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status)
 {
+    // Monitored items of nodes monitored by the client are only removed without a request if the subscription has timed out
+    auto monitoredNode = m_monitoredNodes.find(handle);
+    if (monitoredNode != m_monitoredNodes.end()) {
+        if (!subscribe) {
+            const QString nodeId = monitoredNode->nodeId;
+            monitoredNode->attributes &= ~QOpcUa::NodeAttributes(attr);
+            releaseMonitoredNode(handle);
+            emit disableMonitoringFinished({QOpcUaMonitoringItem(nodeId, attr, status)});
+        }
+        return;
+    }
+
     auto it = m_handles.constFind(handle);
     if (it != m_handles.constEnd() && !it->isNull())
         emit (*it)->monitoringEnableDisable(attr, subscribe, status);
@@ -156,9 +424,101 @@ void QOpcUaClientImpl::handleResolveBrowsePathFinished(quint64 handle, QVector<Q
 
 void QOpcUaClientImpl::handleNewEvent(quint64 handle, QVariantList eventFields)
 {
+    auto monitoredNode = m_monitoredNodes.constFind(handle);
+    if (monitoredNode != m_monitoredNodes.constEnd()) {
+        emit eventOccurred(monitoredNode->nodeId, eventFields);
+        return;
+    }
+
     auto it = m_handles.constFind(handle);
     if (it != m_handles.constEnd() && !it->isNull())
         emit (*it)->eventOccurred(eventFields);
 }
 
+void QOpcUaClientImpl::handleNewEvents(quint64 handle, const QOpcUaEventBatch &events)
+{
+    auto monitoredNode = m_monitoredNodes.constFind(handle);
+    if (monitoredNode != m_monitoredNodes.constEnd()) {
+        emit eventsOccurred(monitoredNode->nodeId, events);
+        return;
+    }
+
+    auto it = m_handles.constFind(handle);
+    if (it != m_handles.constEnd() && !it->isNull())
+        emit (*it)->eventsOccurred(events);
+}
+
+void QOpcUaClientImpl::handleEnableMonitoringFinished(const QVector<QOpcUaMonitoringItem> &results)
+{
+    QSet<quint64> finishedHandles;
+
+    for (const auto &result : results) {
+        auto handle = m_monitoredNodeHandles.constFind(result.nodeId());
+        if (handle == m_monitoredNodeHandles.constEnd())
+            continue;
+
+        if (!finishedHandles.contains(handle.value())) {
+            --m_monitoredNodes[handle.value()].pendingRequests;
+            finishedHandles.insert(handle.value());
+        }
+
+        if (result.parameters().statusCode() == QOpcUa::UaStatusCode::Good)
+            m_monitoredNodes[handle.value()].attributes |= result.attributes();
+    }
+
+    for (const auto handle : qAsConst(finishedHandles))
+        releaseMonitoredNode(handle);
+
+    emit enableMonitoringFinished(results);
+}
+
+void QOpcUaClientImpl::handleDisableMonitoringFinished(const QVector<QOpcUaMonitoringItem> &results)
+{
+    // The monitored items are removed by the backend even if the server returned an error
+    for (const auto &result : results) {
+        auto handle = m_monitoredNodeHandles.constFind(result.nodeId());
+        if (handle == m_monitoredNodeHandles.constEnd())
+            continue;
+
+        const quint64 h = handle.value();
+        m_monitoredNodes[h].attributes &= ~result.attributes();
+        releaseMonitoredNode(h);
+    }
+
+    emit disableMonitoringFinished(results);
+}
+
+void QOpcUaClientImpl::handleTagTableChanged(quint32 tableId)
+{
+    auto table = m_tagTables.constFind(tableId);
+    if (table != m_tagTables.constEnd())
+        emit tagsChanged(*table);
+}
+
+void QOpcUaClientImpl::handleCrawlFinished(QOpcUa::UaStatusCode statusCode)
+{
+    m_crawlInProgress = false;
+    emit crawlFinished(statusCode);
+}
+
+void QOpcUaClientImpl::handleRegisterNodesFinished(quint64 handle, const QStringList &nodeIds, const QStringList &registeredNodeIds,
+                                                   QOpcUa::UaStatusCode statusCode)
+{
+    if (handle == 0) {
+        emit registerNodesFinished(nodeIds, registeredNodeIds, statusCode);
+        return;
+    }
+
+    auto it = m_handles.constFind(handle);
+    if (it != m_handles.constEnd() && !it->isNull())
+        emit (*it)->registerNodeIdFinished(registeredNodeIds.value(0), statusCode);
+}
+
+void QOpcUaClientImpl::handleUnregisterNodesFinished(quint64 handle, const QStringList &nodeIds, QOpcUa::UaStatusCode statusCode)
+{
+    // Nodes unregister their node id when they are destroyed, nobody is waiting for the result
+    if (handle == 0)
+        emit unregisterNodesFinished(nodeIds, statusCode);
+}
+
 QT_END_NAMESPACE
@@ -51,6 +51,9 @@
 #include <QtOpcUa/qopcuaclient.h>
 #include <QtOpcUa/qopcuaglobal.h>
 #include <QtOpcUa/qopcuaendpointdescription.h>
+#include <QtOpcUa/qopcuahistoryreadrequest.h>
+#include <QtOpcUa/qopcuamonitoringitem.h>
+#include <QtOpcUa/qopcuatagtable.h>
 #include <private/qopcuanodeimpl_p.h>
 
 #include <QtCore/qobject.h>
@@ -84,6 +87,35 @@ public:
     bool registerNode(QPointer<QOpcUaNodeImpl> obj);
     void unregisterNode(QPointer<QOpcUaNodeImpl> obj);
 
+    bool enableMonitoring(const QVector<QOpcUaMonitoringItem> &items);
+    bool disableMonitoring(const QVector<QOpcUaMonitoringItem> &items);
+    bool modifyMonitoring(const QVector<QOpcUaMonitoringItem> &items);
+
+    // Backends without support for bulk monitored item operations don't need to implement these functions
+    virtual bool createMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items);
+    virtual bool deleteMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items);
+    virtual bool modifyMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items);
+
+    bool enableMonitoring(const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings);
+    bool disableMonitoring(const QOpcUaTagTable &table);
+
+    // Backends without support for tag tables don't need to implement these functions
+    virtual bool createTagMonitoredItems(quint32 tableId, const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings);
+    virtual bool deleteTagMonitoredItems(quint32 tableId);
+
+    bool crawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request, int maxDepth);
+
+    // Backends without support for crawling don't need to implement this function
+    virtual bool startCrawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request, int maxDepth);
+
+    // Backends without support for registering nodes don't need to implement these functions.
+    // Requests of QOpcUaClient use handle 0, requests of a node use the node's handle.
+    virtual bool registerNodes(quint64 handle, const QStringList &nodeIds);
+    virtual bool unregisterNodes(quint64 handle, const QStringList &nodeIds);
+
+    // Backends without support for reading historical data don't need to implement this function
+    virtual bool readHistoryData(const QOpcUaHistoryReadRequest &request);
+
     virtual bool addNode(const QOpcUaAddNodeItem &nodeToAdd) = 0;
     virtual bool deleteNode(const QString &nodeId, bool deleteTargetReferences) = 0;
 
@@ -101,6 +133,7 @@ private Q_SLOTS:
     void handleAttributesRead(quint64 handle, QVector<QOpcUaReadResult> attr, QOpcUa::UaStatusCode serviceResult);
     void handleAttributeWritten(quint64 handle, QOpcUa::NodeAttribute attr, const QVariant &value, QOpcUa::UaStatusCode statusCode);
     void handleDataChangeOccurred(quint64 handle, const QOpcUaReadResult &value);
+    void handleDataChangesOccurred(const QVector<QPair<quint64, QOpcUaReadResult>> &changes);
     void handleMonitoringEnableDisable(quint64 handle, QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void handleMonitoringStatusChanged(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                                  QOpcUaMonitoringParameters param);
@@ -111,16 +144,39 @@ private Q_SLOTS:
                                            QVector<QOpcUaRelativePathElement> path, QOpcUa::UaStatusCode status);
 
     void handleNewEvent(quint64 handle, QVariantList eventFields);
+    void handleNewEvents(quint64 handle, const QOpcUaEventBatch &events);
+
+    void handleEnableMonitoringFinished(const QVector<QOpcUaMonitoringItem> &results);
+    void handleDisableMonitoringFinished(const QVector<QOpcUaMonitoringItem> &results);
+    void handleTagTableChanged(quint32 tableId);
+    void handleCrawlFinished(QOpcUa::UaStatusCode statusCode);
+    void handleRegisterNodesFinished(quint64 handle, const QStringList &nodeIds, const QStringList &registeredNodeIds,
+                                     QOpcUa::UaStatusCode statusCode);
+    void handleUnregisterNodesFinished(quint64 handle, const QStringList &nodeIds, QOpcUa::UaStatusCode statusCode);
 
 signals:
     void connected();
     void disconnected();
     void stateAndOrErrorChanged(QOpcUaClient::ClientState state,
                                 QOpcUaClient::ClientError error);
+    void connectionRecovered();
     void endpointsRequestFinished(QVector<QOpcUaEndpointDescription> endpoints, QOpcUa::UaStatusCode statusCode, QUrl requestUrl);
     void findServersFinished(QVector<QOpcUaApplicationDescription> servers, QOpcUa::UaStatusCode statusCode, QUrl requestUrl);
     void readNodeAttributesFinished(QVector<QOpcUaReadResult> results, QOpcUa::UaStatusCode serviceResult);
     void writeNodeAttributesFinished(QVector<QOpcUaWriteResult> results, QOpcUa::UaStatusCode serviceResult);
+    void enableMonitoringFinished(QVector<QOpcUaMonitoringItem> results);
+    void disableMonitoringFinished(QVector<QOpcUaMonitoringItem> results);
+    void modifyMonitoringFinished(QVector<QOpcUaMonitoringItem> results);
+    void dataChangesOccurred(QVector<QOpcUaReadResult> values);
+    void tagsChanged(QOpcUaTagTable table);
+    void crawlReferencesReceived(QStringList sourceNodeIds, QVector<QOpcUaReferenceDescription> references);
+    void crawlFinished(QOpcUa::UaStatusCode statusCode);
+    void registerNodesFinished(QStringList nodeIds, QStringList registeredNodeIds, QOpcUa::UaStatusCode statusCode);
+    void unregisterNodesFinished(QStringList nodeIds, QOpcUa::UaStatusCode statusCode);
+    void historyDataReceived(QOpcUaHistoryReadRequest request, QVector<QOpcUaHistoryData> data);
+    void historyReadFinished(QOpcUaHistoryReadRequest request, QOpcUa::UaStatusCode statusCode);
+    void eventOccurred(QString nodeId, QVariantList eventFields);
+    void eventsOccurred(QString nodeId, QOpcUaEventBatch events);
     void addNodeFinished(QOpcUaExpandedNodeId requestedNodeId, QString assignedNodeId, QOpcUa::UaStatusCode statusCode);
     void deleteNodeFinished(QString nodeId, QOpcUa::UaStatusCode statusCode);
     void addReferenceFinished(QString sourceNodeId, QString referenceTypeId, QOpcUaExpandedNodeId targetNodeId, bool isForwardReference,
@@ -132,8 +188,26 @@ signals:
 
 private:
     Q_DISABLE_COPY(QOpcUaClientImpl)
+    quint64 nextFreeHandle();
+    void releaseMonitoredNode(quint64 handle);
+
     QHash<quint64, QPointer<QOpcUaNodeImpl>> m_handles;
     quint64 m_handleCounter;
+
+    // Nodes monitored using the bulk functions of QOpcUaClient
+    struct MonitoredNode {
+        QString nodeId;
+        QOpcUa::NodeAttributes attributes;
+        int pendingRequests = 0;
+    };
+    QHash<quint64, MonitoredNode> m_monitoredNodes;
+    QHash<QString, quint64> m_monitoredNodeHandles;
+
+    // Monitored tag tables, the handles of their tags are derived from the table id
+    QHash<quint32, QOpcUaTagTable> m_tagTables;
+    quint32 m_tagTableCounter;
+
+    bool m_crawlInProgress; // Only one crawl at a time, its results are not associated with a request
 };
 
 #if QT_VERSION >= 0x060000
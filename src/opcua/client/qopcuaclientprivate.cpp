@@ -37,6 +37,7 @@
 #include <private/qopcuaclient_p.h>
 
 #include <QtCore/qloggingcategory.h>
+#include <private/qmetaobject_p.h>
 #include <QtOpcUa/qopcuaendpointdescription.h>
 
 #include "qopcuaerrorstate.h"
@@ -65,6 +66,18 @@ QOpcUaClientPrivate::QOpcUaClientPrivate(QOpcUaClientImpl *impl)
         }
     });
 
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::connectionRecovered, [this]() {
+        Q_Q(QOpcUaClient);
+        // Unlike setStateAndError(), connected() is not emitted, the setup of the application is still valid
+        m_error = QOpcUaClient::NoError;
+        if (m_state != QOpcUaClient::Connected) {
+            m_state = QOpcUaClient::Connected;
+            emit q->stateChanged(m_state);
+        }
+        updateNamespaceArray();
+        emit q->connectionRecovered();
+    });
+
     QObject::connect(m_impl.data(), &QOpcUaClientImpl::endpointsRequestFinished, m_impl.data(),
                      [this](const QVector<QOpcUaEndpointDescription> &e, QOpcUa::UaStatusCode s, const QUrl &requestUrl) {
         Q_Q(QOpcUaClient);
@@ -86,6 +99,86 @@ QOpcUaClientPrivate::QOpcUaClientPrivate(QOpcUaClientImpl *impl)
         emit q->writeNodeAttributesFinished(results, serviceResult);
     });
 
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::enableMonitoringFinished, [this](const QVector<QOpcUaMonitoringItem> &results) {
+        Q_Q(QOpcUaClient);
+        emit q->enableMonitoringFinished(results);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::disableMonitoringFinished, [this](const QVector<QOpcUaMonitoringItem> &results) {
+        Q_Q(QOpcUaClient);
+        emit q->disableMonitoringFinished(results);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::modifyMonitoringFinished, [this](const QVector<QOpcUaMonitoringItem> &results) {
+        Q_Q(QOpcUaClient);
+        emit q->modifyMonitoringFinished(results);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::dataChangesOccurred, [this](const QVector<QOpcUaReadResult> &values) {
+        Q_Q(QOpcUaClient);
+        emit q->dataChangesOccurred(values);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::tagsChanged, [this](const QOpcUaTagTable &table) {
+        Q_Q(QOpcUaClient);
+        emit q->tagsChanged(table);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::crawlReferencesReceived,
+                     [this](const QStringList &sourceNodeIds, const QVector<QOpcUaReferenceDescription> &references) {
+        Q_Q(QOpcUaClient);
+        emit q->crawlReferencesReceived(sourceNodeIds, references);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::crawlFinished, [this](QOpcUa::UaStatusCode statusCode) {
+        Q_Q(QOpcUaClient);
+        emit q->crawlFinished(statusCode);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::registerNodesFinished,
+                     [this](const QStringList &nodeIds, const QStringList &registeredNodeIds, QOpcUa::UaStatusCode statusCode) {
+        Q_Q(QOpcUaClient);
+        emit q->registerNodesFinished(nodeIds, registeredNodeIds, statusCode);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::unregisterNodesFinished,
+                     [this](const QStringList &nodeIds, QOpcUa::UaStatusCode statusCode) {
+        Q_Q(QOpcUaClient);
+        emit q->unregisterNodesFinished(nodeIds, statusCode);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::historyDataReceived,
+                     [this](const QOpcUaHistoryReadRequest &request, const QVector<QOpcUaHistoryData> &data) {
+        Q_Q(QOpcUaClient);
+        emit q->historyDataReceived(request, data);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::historyReadFinished,
+                     [this](const QOpcUaHistoryReadRequest &request, QOpcUa::UaStatusCode statusCode) {
+        Q_Q(QOpcUaClient);
+        emit q->historyReadFinished(request, statusCode);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::eventOccurred, [this](const QString &nodeId, const QVariantList &eventFields) {
+        Q_Q(QOpcUaClient);
+        emit q->eventOccurred(nodeId, eventFields);
+    });
+
+    QObject::connect(m_impl.data(), &QOpcUaClientImpl::eventsOccurred, [this](const QString &nodeId, const QOpcUaEventBatch &events) {
+        Q_Q(QOpcUaClient);
+        emit q->eventsOccurred(nodeId, events);
+
+        static const int eventOccurredIndex = QMetaObjectPrivate::signalIndex(
+                    QMetaMethod::fromSignal(&QOpcUaClient::eventOccurred));
+        if (!isSignalConnected(eventOccurredIndex))
+            return;
+
+        // A slot may delete the client while the events are delivered
+        QPointer<QOpcUaClient> guard(q);
+        for (int i = 0; i < events.count() && guard; ++i)
+            emit q->eventOccurred(nodeId, events.eventFields(i));
+    });
+
     QObject::connect(m_impl.data(), &QOpcUaClientImpl::addNodeFinished, [this](const QOpcUaExpandedNodeId &requestedNodeId, const QString &assignedNodeId, QOpcUa::UaStatusCode statusCode) {
         Q_Q(QOpcUaClient);
         emit q->addNodeFinished(requestedNodeId, assignedNodeId, statusCode);
@@ -148,7 +241,8 @@ void QOpcUaClientPrivate::connectToEndpoint(const QOpcUaEndpointDescription &end
 
 void QOpcUaClientPrivate::disconnectFromEndpoint()
 {
-    if (m_state != QOpcUaClient::Connected) {
+    // A client in the Connecting state may be waiting for an automatic reconnect
+    if (m_state != QOpcUaClient::Connected && m_state != QOpcUaClient::Connecting) {
         qCWarning(QT_OPCUA) << "Closing a connection without being connected";
         return;
     }
@@ -0,0 +1,277 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include "qopcuadatasetbatch.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaDataSetBatch
+    \inmodule QtOpcUa
+    \since QtOpcUa 6.0
+    \brief Contains the DataSetMessages decoded by a \l QOpcUaPubSubReader in one read cycle.
+
+    Each DataSetMessage is one row of the batch. The fields of the DataSet are stored column
+    by column, entry \e i of a column belongs to message \e i.
+
+    Fields of numeric, Boolean, String or DateTime type are stored in a typed vector like
+    QVector<double> or QVector<QDateTime>. Fields of other types and fields whose values
+    don't match the expected type are stored in a QVariantList.
+
+    A delta frame only contains the fields which have changed. The other fields of its row
+    repeat the last value received for them, so every row contains the complete DataSet.
+
+    \l dataSetWriterIds(), \l sequenceNumbers(), \l timestamps() and \l statusCodes() contain
+    the header information of the messages.
+
+    \sa QOpcUaPubSubReader::dataSetsReceived()
+*/
+
+/*!
+    \variable QOpcUaDataSetBatch::InvalidTimestamp
+
+    This value marks a message without timestamp.
+*/
+constexpr qint64 QOpcUaDataSetBatch::InvalidTimestamp;
+
+/*!
+    \fn template <typename T> QVector<T> QOpcUaDataSetBatch::typedField(int fieldIndex) const
+
+    Returns the column at \a fieldIndex if it is stored as QVector<T>.
+    Otherwise, an empty vector is returned.
+*/
+
+class QOpcUaDataSetBatchData : public QSharedData
+{
+public:
+    int count {0};
+    QStringList fieldNames;
+    QVariantList fields;
+    QVector<quint16> dataSetWriterIds;
+    QVector<quint16> sequenceNumbers;
+    QVector<qint64> timestamps;
+    QVector<QOpcUa::UaStatusCode> statusCodes;
+};
+
+QOpcUaDataSetBatch::QOpcUaDataSetBatch()
+    : data(new QOpcUaDataSetBatchData)
+{
+}
+
+/*!
+    Creates a DataSet batch from \a other.
+*/
+QOpcUaDataSetBatch::QOpcUaDataSetBatch(const QOpcUaDataSetBatch &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this DataSet batch.
+*/
+QOpcUaDataSetBatch &QOpcUaDataSetBatch::operator=(const QOpcUaDataSetBatch &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaDataSetBatch::~QOpcUaDataSetBatch()
+{
+}
+
+/*!
+    Returns the number of DataSetMessages in this batch.
+*/
+int QOpcUaDataSetBatch::count() const
+{
+    return data->count;
+}
+
+/*!
+    Sets the number of DataSetMessages in this batch to \a count.
+*/
+void QOpcUaDataSetBatch::setCount(int count)
+{
+    data->count = count;
+}
+
+/*!
+    Returns the number of fields of the DataSet.
+*/
+int QOpcUaDataSetBatch::fieldCount() const
+{
+    return data->fields.size();
+}
+
+/*!
+    Returns the names of the fields.
+*/
+QStringList QOpcUaDataSetBatch::fieldNames() const
+{
+    return data->fieldNames;
+}
+
+/*!
+    Sets the names of the fields to \a fieldNames.
+*/
+void QOpcUaDataSetBatch::setFieldNames(const QStringList &fieldNames)
+{
+    data->fieldNames = fieldNames;
+}
+
+/*!
+    Returns the index of the field named \a fieldName or \c -1 if there is no such field.
+*/
+int QOpcUaDataSetBatch::fieldIndex(const QString &fieldName) const
+{
+    return data->fieldNames.indexOf(fieldName);
+}
+
+/*!
+    Returns all columns of this batch.
+*/
+QVariantList QOpcUaDataSetBatch::fields() const
+{
+    return data->fields;
+}
+
+/*!
+    Sets the columns of this batch to \a fields.
+    Each column must be a typed vector or a QVariantList with \l count() entries.
+*/
+void QOpcUaDataSetBatch::setFields(const QVariantList &fields)
+{
+    data->fields = fields;
+}
+
+/*!
+    Returns the column at \a fieldIndex, either as a typed vector or as a QVariantList.
+*/
+QVariant QOpcUaDataSetBatch::field(int fieldIndex) const
+{
+    return data->fields.value(fieldIndex);
+}
+
+/*!
+    Returns the value of the field at \a fieldIndex in the message at index \a message.
+*/
+QVariant QOpcUaDataSetBatch::value(int message, int fieldIndex) const
+{
+    if (message < 0 || message >= data->count || fieldIndex < 0 || fieldIndex >= data->fields.size())
+        return QVariant();
+
+    const QVariant &column = data->fields.at(fieldIndex);
+    if (column.userType() == QMetaType::QVariantList)
+        return static_cast<const QVariantList *>(column.constData())->value(message);
+
+    if (!column.canConvert<QVariantList>())
+        return QVariant();
+
+    const QSequentialIterable iterable = column.value<QSequentialIterable>();
+    if (message >= iterable.size())
+        return QVariant();
+    return iterable.at(message);
+}
+
+/*!
+    Returns the DataSetWriterIds of the messages, \c 0 if the NetworkMessage had no payload header.
+*/
+QVector<quint16> QOpcUaDataSetBatch::dataSetWriterIds() const
+{
+    return data->dataSetWriterIds;
+}
+
+/*!
+    Sets the DataSetWriterIds of the messages to \a dataSetWriterIds.
+*/
+void QOpcUaDataSetBatch::setDataSetWriterIds(const QVector<quint16> &dataSetWriterIds)
+{
+    data->dataSetWriterIds = dataSetWriterIds;
+}
+
+/*!
+    Returns the sequence numbers of the messages, \c 0 if the publisher didn't send them.
+*/
+QVector<quint16> QOpcUaDataSetBatch::sequenceNumbers() const
+{
+    return data->sequenceNumbers;
+}
+
+/*!
+    Sets the sequence numbers of the messages to \a sequenceNumbers.
+*/
+void QOpcUaDataSetBatch::setSequenceNumbers(const QVector<quint16> &sequenceNumbers)
+{
+    data->sequenceNumbers = sequenceNumbers;
+}
+
+/*!
+    Returns the timestamps of the messages in milliseconds since 1970-01-01T00:00:00 UTC.
+    Messages without a timestamp of their own use the timestamp of the NetworkMessage.
+    If neither is present, the timestamp is \l InvalidTimestamp.
+*/
+QVector<qint64> QOpcUaDataSetBatch::timestamps() const
+{
+    return data->timestamps;
+}
+
+/*!
+    Sets the timestamps of the messages to \a timestamps.
+*/
+void QOpcUaDataSetBatch::setTimestamps(const QVector<qint64> &timestamps)
+{
+    data->timestamps = timestamps;
+}
+
+/*!
+    Returns the status codes of the messages. A message which could not be decoded completely
+    has the status code \l {QOpcUa::UaStatusCode} {BadDecodingError}, its remaining fields
+    repeat their last values.
+*/
+QVector<QOpcUa::UaStatusCode> QOpcUaDataSetBatch::statusCodes() const
+{
+    return data->statusCodes;
+}
+
+/*!
+    Sets the status codes of the messages to \a statusCodes.
+*/
+void QOpcUaDataSetBatch::setStatusCodes(const QVector<QOpcUa::UaStatusCode> &statusCodes)
+{
+    data->statusCodes = statusCodes;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,106 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef QOPCUADATASETBATCH_H
+#define QOPCUADATASETBATCH_H
+
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qshareddata.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qvariant.h>
+#include <QtCore/qvector.h>
+
+#include <limits>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaDataSetBatchData;
+class Q_OPCUA_EXPORT QOpcUaDataSetBatch
+{
+public:
+    static constexpr qint64 InvalidTimestamp = (std::numeric_limits<qint64>::min)();
+
+    QOpcUaDataSetBatch();
+    QOpcUaDataSetBatch(const QOpcUaDataSetBatch &other);
+    QOpcUaDataSetBatch &operator=(const QOpcUaDataSetBatch &rhs);
+    ~QOpcUaDataSetBatch();
+
+    int count() const;
+    void setCount(int count);
+
+    int fieldCount() const;
+
+    QStringList fieldNames() const;
+    void setFieldNames(const QStringList &fieldNames);
+    int fieldIndex(const QString &fieldName) const;
+
+    QVariantList fields() const;
+    void setFields(const QVariantList &fields);
+
+    QVariant field(int fieldIndex) const;
+
+    template <typename T>
+    QVector<T> typedField(int fieldIndex) const
+    {
+        const QVariant column = field(fieldIndex);
+        if (column.userType() == qMetaTypeId<QVector<T>>())
+            return column.value<QVector<T>>();
+        return QVector<T>();
+    }
+
+    QVariant value(int message, int fieldIndex) const;
+
+    QVector<quint16> dataSetWriterIds() const;
+    void setDataSetWriterIds(const QVector<quint16> &dataSetWriterIds);
+
+    QVector<quint16> sequenceNumbers() const;
+    void setSequenceNumbers(const QVector<quint16> &sequenceNumbers);
+
+    QVector<qint64> timestamps() const;
+    void setTimestamps(const QVector<qint64> &timestamps);
+
+    QVector<QOpcUa::UaStatusCode> statusCodes() const;
+    void setStatusCodes(const QVector<QOpcUa::UaStatusCode> &statusCodes);
+
+private:
+    QSharedDataPointer<QOpcUaDataSetBatchData> data;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaDataSetBatch)
+
+#endif // QOPCUADATASETBATCH_H
@@ -0,0 +1,208 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include "qopcuaeventbatch.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaEventBatch
+    \inmodule QtOpcUa
+    \since QtOpcUa 6.0
+    \brief Contains events received in one publish cycle for a monitored EventNotifier attribute.
+
+    The events are stored column by column. Each field selected by the \c select clause of the
+    event filter is one column, entry \e i of a column belongs to event \e i.
+
+    If a field has the same type in all events of the batch, \l field() contains a typed vector
+    like QVector<quint16>, QVector<QDateTime> or QVector<QOpcUaLocalizedText>. Otherwise, the
+    column is a QVariantList with one entry per event.
+
+    \l eventFields() converts a single event to the representation used by
+    \l QOpcUaNode::eventOccurred().
+
+    \sa QOpcUaNode::eventsOccurred() QOpcUaMonitoringParameters::EventFilter
+*/
+
+/*!
+    \fn template <typename T> QVector<T> QOpcUaEventBatch::typedField(int fieldIndex) const
+
+    Returns the column at \a fieldIndex if it is stored as QVector<T>.
+    Otherwise, an empty vector is returned.
+*/
+
+class QOpcUaEventBatchData : public QSharedData
+{
+public:
+    int count {0};
+    QStringList fieldNames;
+    QVariantList fields;
+};
+
+QOpcUaEventBatch::QOpcUaEventBatch()
+    : data(new QOpcUaEventBatchData)
+{
+}
+
+/*!
+    Creates an event batch from \a other.
+*/
+QOpcUaEventBatch::QOpcUaEventBatch(const QOpcUaEventBatch &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this event batch.
+*/
+QOpcUaEventBatch &QOpcUaEventBatch::operator=(const QOpcUaEventBatch &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaEventBatch::~QOpcUaEventBatch()
+{
+}
+
+/*!
+    Returns the number of events in this batch.
+*/
+int QOpcUaEventBatch::count() const
+{
+    return data->count;
+}
+
+/*!
+    Sets the number of events in this batch to \a count.
+*/
+void QOpcUaEventBatch::setCount(int count)
+{
+    data->count = count;
+}
+
+/*!
+    Returns the number of fields of each event.
+*/
+int QOpcUaEventBatch::fieldCount() const
+{
+    return data->fields.size();
+}
+
+/*!
+    Returns the names of the fields. A name is the browse path of the select clause,
+    the names of the path elements are separated by \c /.
+*/
+QStringList QOpcUaEventBatch::fieldNames() const
+{
+    return data->fieldNames;
+}
+
+/*!
+    Sets the names of the fields to \a fieldNames.
+*/
+void QOpcUaEventBatch::setFieldNames(const QStringList &fieldNames)
+{
+    data->fieldNames = fieldNames;
+}
+
+/*!
+    Returns the index of the field named \a fieldName or \c -1 if there is no such field.
+*/
+int QOpcUaEventBatch::fieldIndex(const QString &fieldName) const
+{
+    return data->fieldNames.indexOf(fieldName);
+}
+
+/*!
+    Returns all columns of this batch.
+*/
+QVariantList QOpcUaEventBatch::fields() const
+{
+    return data->fields;
+}
+
+/*!
+    Sets the columns of this batch to \a fields.
+    Each column must be a typed vector or a QVariantList with \l count() entries.
+*/
+void QOpcUaEventBatch::setFields(const QVariantList &fields)
+{
+    data->fields = fields;
+}
+
+/*!
+    Returns the column at \a fieldIndex, either as a typed vector or as a QVariantList.
+*/
+QVariant QOpcUaEventBatch::field(int fieldIndex) const
+{
+    return data->fields.value(fieldIndex);
+}
+
+/*!
+    Returns the value of the field at \a fieldIndex for the event at index \a event.
+*/
+QVariant QOpcUaEventBatch::value(int event, int fieldIndex) const
+{
+    if (event < 0 || event >= data->count || fieldIndex < 0 || fieldIndex >= data->fields.size())
+        return QVariant();
+
+    const QVariant &column = data->fields.at(fieldIndex);
+    if (column.userType() == QMetaType::QVariantList)
+        return static_cast<const QVariantList *>(column.constData())->value(event);
+
+    if (!column.canConvert<QVariantList>())
+        return QVariant();
+
+    const QSequentialIterable iterable = column.value<QSequentialIterable>();
+    if (event >= iterable.size())
+        return QVariant();
+    return iterable.at(event);
+}
+
+/*!
+    Returns the fields of the event at index \a event in the order of the select clauses.
+*/
+QVariantList QOpcUaEventBatch::eventFields(int event) const
+{
+    QVariantList result;
+    result.reserve(data->fields.size());
+    for (int i = 0; i < data->fields.size(); ++i)
+        result.append(value(event, i));
+    return result;
+}
+
+QT_END_NAMESPACE
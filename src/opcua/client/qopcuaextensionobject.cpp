@@ -35,8 +35,11 @@
 ****************************************************************************/
 
 #include "qopcuaextensionobject.h"
+#include "qopcuaextensionobject_p.h"
 #include "qopcuatype.h"
 
+#include <QtCore/qsharedpointer.h>
+
 QT_BEGIN_NAMESPACE
 
 /*!
@@ -68,6 +71,7 @@ class QOpcUaExtensionObjectData : public QSharedData
 public:
     QString encodingTypeId;
     QByteArray encodedBody;
+    QSharedPointer<char> adoptedBody; // Owns the memory referenced by encodedBody if the body has been adopted
     QOpcUaExtensionObject::Encoding encoding{QOpcUaExtensionObject::Encoding::NoBody};
 };
 
@@ -101,7 +105,7 @@ bool QOpcUaExtensionObject::operator==(const QOpcUaExtensionObject &rhs) const
 {
     return data->encoding == rhs.encoding() &&
             QOpcUa::nodeIdEquals(data->encodingTypeId, rhs.encodingTypeId()) &&
-            data->encodedBody == rhs.encodedBody();
+            data->encodedBody == rhs.data->encodedBody;
 }
 
 /*!
@@ -137,11 +141,18 @@ void QOpcUaExtensionObject::setEncoding(QOpcUaExtensionObject::Encoding encoding
 */
 QByteArray QOpcUaExtensionObject::encodedBody() const
 {
+    // The returned byte array may outlive this object, it must not reference an adopted body
+    if (data->adoptedBody)
+        return QByteArray(data->encodedBody.constData(), data->encodedBody.size());
     return data->encodedBody;
 }
 
 /*!
     Returns a reference to the body of this extension object.
+
+    Unlike encodedBody(), this function never copies the body. If the backend has handed over
+    the body without copying it, copies of the returned byte array must not outlive this
+    extension object.
 */
 QByteArray &QOpcUaExtensionObject::encodedBodyRef()
 {
@@ -153,6 +164,7 @@ QByteArray &QOpcUaExtensionObject::encodedBodyRef()
 void QOpcUaExtensionObject::setEncodedBody(const QByteArray &encodedBody)
 {
     data->encodedBody = encodedBody;
+    data->adoptedBody.reset();
 }
 
 /*!
@@ -204,4 +216,16 @@ void QOpcUaExtensionObject::setEncodingTypeId(const QString &encodingTypeId)
     data->encodingTypeId = encodingTypeId;
 }
 
+/*!
+    \internal
+
+    Makes \a object the owner of \a size bytes at \a body without copying them.
+    The memory is released with \a deleter when the last copy of the extension object is destroyed.
+*/
+void qt_adoptEncodedBody(QOpcUaExtensionObject &object, char *body, int size, void (*deleter)(void *))
+{
+    object.data->adoptedBody = QSharedPointer<char>(body, deleter);
+    object.data->encodedBody = QByteArray::fromRawData(body, size);
+}
+
 QT_END_NAMESPACE
@@ -76,6 +76,9 @@ public:
 
 private:
     QSharedDataPointer<QOpcUaExtensionObjectData> data;
+
+    friend Q_OPCUA_EXPORT void qt_adoptEncodedBody(QOpcUaExtensionObject &object, char *body, int size,
+                                                   void (*deleter)(void *));
 };
 
 QT_END_NAMESPACE
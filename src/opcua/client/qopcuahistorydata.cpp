@@ -0,0 +1,211 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuahistorydata.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaHistoryData
+    \inmodule QtOpcUa
+    \since QtOpcUa 6.0
+    \brief Contains a chunk of the history of a node returned by the OPC UA HistoryRead service.
+
+    The samples are stored column by column. Entry \e i of \l values(), \l sourceTimestamps(),
+    \l serverTimestamps() and \l statusCodes() belongs to sample \e i.
+
+    If the values of all samples have the same numeric type, \l values() contains a typed vector
+    like QVector<double> or QVector<qint32> instead of a QVariantList. Samples without a value
+    are stored as 0 in a typed vector, their status code tells why the value is missing.
+
+    Timestamps are stored as milliseconds since 1970-01-01T00:00:00 UTC,
+    timestamps which have not been returned by the server are \l InvalidTimestamp.
+
+    \sa QOpcUaClient::readHistoryData() QOpcUaHistoryReadRequest
+*/
+
+/*!
+    \variable QOpcUaHistoryData::InvalidTimestamp
+
+    This value marks a timestamp which has not been returned by the server.
+*/
+
+constexpr qint64 QOpcUaHistoryData::InvalidTimestamp;
+
+class QOpcUaHistoryDataData : public QSharedData
+{
+public:
+    QString nodeId;
+    QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
+    QVariant values;
+    QVector<qint64> sourceTimestamps;
+    QVector<qint64> serverTimestamps;
+    QVector<QOpcUa::UaStatusCode> statusCodes;
+};
+
+QOpcUaHistoryData::QOpcUaHistoryData()
+    : data(new QOpcUaHistoryDataData)
+{
+}
+
+/*!
+    Creates history data from \a other.
+*/
+QOpcUaHistoryData::QOpcUaHistoryData(const QOpcUaHistoryData &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this history data.
+*/
+QOpcUaHistoryData &QOpcUaHistoryData::operator=(const QOpcUaHistoryData &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaHistoryData::~QOpcUaHistoryData()
+{
+}
+
+/*!
+    Returns the id of the node the history belongs to.
+*/
+QString QOpcUaHistoryData::nodeId() const
+{
+    return data->nodeId;
+}
+
+/*!
+    Sets the id of the node the history belongs to to \a nodeId.
+*/
+void QOpcUaHistoryData::setNodeId(const QString &nodeId)
+{
+    data->nodeId = nodeId;
+}
+
+/*!
+    Returns the status code of the history read for the node.
+*/
+QOpcUa::UaStatusCode QOpcUaHistoryData::statusCode() const
+{
+    return data->statusCode;
+}
+
+/*!
+    Sets the status code of the history read for the node to \a statusCode.
+*/
+void QOpcUaHistoryData::setStatusCode(QOpcUa::UaStatusCode statusCode)
+{
+    data->statusCode = statusCode;
+}
+
+/*!
+    Returns the number of samples.
+*/
+int QOpcUaHistoryData::count() const
+{
+    return data->statusCodes.size();
+}
+
+/*!
+    Returns the values of the samples, either as a typed vector or as a QVariantList.
+*/
+QVariant QOpcUaHistoryData::values() const
+{
+    return data->values;
+}
+
+/*!
+    Sets the values of the samples to \a values.
+*/
+void QOpcUaHistoryData::setValues(const QVariant &values)
+{
+    data->values = values;
+}
+
+/*!
+    Returns the source timestamps of the samples.
+*/
+QVector<qint64> QOpcUaHistoryData::sourceTimestamps() const
+{
+    return data->sourceTimestamps;
+}
+
+/*!
+    Sets the source timestamps of the samples to \a sourceTimestamps.
+*/
+void QOpcUaHistoryData::setSourceTimestamps(const QVector<qint64> &sourceTimestamps)
+{
+    data->sourceTimestamps = sourceTimestamps;
+}
+
+/*!
+    Returns the server timestamps of the samples.
+*/
+QVector<qint64> QOpcUaHistoryData::serverTimestamps() const
+{
+    return data->serverTimestamps;
+}
+
+/*!
+    Sets the server timestamps of the samples to \a serverTimestamps.
+*/
+void QOpcUaHistoryData::setServerTimestamps(const QVector<qint64> &serverTimestamps)
+{
+    data->serverTimestamps = serverTimestamps;
+}
+
+/*!
+    Returns the status codes of the samples.
+*/
+QVector<QOpcUa::UaStatusCode> QOpcUaHistoryData::statusCodes() const
+{
+    return data->statusCodes;
+}
+
+/*!
+    Sets the status codes of the samples to \a statusCodes.
+    The number of samples is the number of status codes.
+*/
+void QOpcUaHistoryData::setStatusCodes(const QVector<QOpcUa::UaStatusCode> &statusCodes)
+{
+    data->statusCodes = statusCodes;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,326 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuahistoryreadrequest.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaHistoryReadRequest
+    \inmodule QtOpcUa
+    \since QtOpcUa 6.0
+    \brief Contains parameters for a call to the OPC UA HistoryRead service.
+
+    The history of all nodes in \l nodeIds() is read with the same parameters.
+    Which of the parameters are used depends on \l type():
+
+    \table
+    \header
+        \li Type
+        \li Parameters
+    \row
+        \li \l {QOpcUaHistoryReadRequest::Type} {RawModified}
+        \li \l startTimestamp(), \l endTimestamp(), \l numValuesPerNode(), \l returnBounds(), \l readModified()
+    \row
+        \li \l {QOpcUaHistoryReadRequest::Type} {Processed}
+        \li \l startTimestamp(), \l endTimestamp(), \l aggregateType(), \l processingInterval()
+    \row
+        \li \l {QOpcUaHistoryReadRequest::Type} {AtTime}
+        \li \l requestedTimestamps(), \l useSimpleBounds()
+    \endtable
+
+    The open62541 backend requires an open62541 library built with UA_ENABLE_HISTORIZING.
+
+    \sa QOpcUaClient::readHistoryData() QOpcUaHistoryData
+*/
+
+/*!
+    \enum QOpcUaHistoryReadRequest::Type
+
+    This enum specifies the kind of history to be read.
+
+    \value RawModified Read the raw values or the modified values stored in a time range (ReadRawModifiedDetails).
+    \value Processed Read values calculated by an aggregate for intervals of a time range (ReadProcessedDetails).
+    \value AtTime Read the values at the given timestamps, interpolated if necessary (ReadAtTimeDetails).
+*/
+
+class QOpcUaHistoryReadRequestData : public QSharedData
+{
+public:
+    QOpcUaHistoryReadRequest::Type type {QOpcUaHistoryReadRequest::Type::RawModified};
+    QStringList nodeIds;
+    QDateTime startTimestamp;
+    QDateTime endTimestamp;
+    quint32 numValuesPerNode {0};
+    bool returnBounds {false};
+    bool readModified {false};
+    QString aggregateType;
+    double processingInterval {0};
+    QVector<QDateTime> requestedTimestamps;
+    bool useSimpleBounds {true};
+};
+
+QOpcUaHistoryReadRequest::QOpcUaHistoryReadRequest()
+    : data(new QOpcUaHistoryReadRequestData)
+{
+}
+
+/*!
+    Creates a history read request from \a other.
+*/
+QOpcUaHistoryReadRequest::QOpcUaHistoryReadRequest(const QOpcUaHistoryReadRequest &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Sets the values from \a rhs in this history read request.
+*/
+QOpcUaHistoryReadRequest &QOpcUaHistoryReadRequest::operator=(const QOpcUaHistoryReadRequest &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+/*!
+    Returns \c true if this history read request has the same value as \a rhs.
+*/
+bool QOpcUaHistoryReadRequest::operator==(const QOpcUaHistoryReadRequest &rhs) const
+{
+    return data->type == rhs.data->type &&
+            data->nodeIds == rhs.data->nodeIds &&
+            data->startTimestamp == rhs.data->startTimestamp &&
+            data->endTimestamp == rhs.data->endTimestamp &&
+            data->numValuesPerNode == rhs.data->numValuesPerNode &&
+            data->returnBounds == rhs.data->returnBounds &&
+            data->readModified == rhs.data->readModified &&
+            data->aggregateType == rhs.data->aggregateType &&
+            data->processingInterval == rhs.data->processingInterval &&
+            data->requestedTimestamps == rhs.data->requestedTimestamps &&
+            data->useSimpleBounds == rhs.data->useSimpleBounds;
+}
+
+QOpcUaHistoryReadRequest::~QOpcUaHistoryReadRequest()
+{
+}
+
+/*!
+    Returns the type of the history read.
+*/
+QOpcUaHistoryReadRequest::Type QOpcUaHistoryReadRequest::type() const
+{
+    return data->type;
+}
+
+/*!
+    Sets the type of the history read to \a type.
+*/
+void QOpcUaHistoryReadRequest::setType(QOpcUaHistoryReadRequest::Type type)
+{
+    data->type = type;
+}
+
+/*!
+    Returns the ids of the nodes whose history is read.
+*/
+QStringList QOpcUaHistoryReadRequest::nodeIds() const
+{
+    return data->nodeIds;
+}
+
+/*!
+    Sets the ids of the nodes whose history is read to \a nodeIds.
+*/
+void QOpcUaHistoryReadRequest::setNodeIds(const QStringList &nodeIds)
+{
+    data->nodeIds = nodeIds;
+}
+
+/*!
+    Returns the beginning of the time range.
+*/
+QDateTime QOpcUaHistoryReadRequest::startTimestamp() const
+{
+    return data->startTimestamp;
+}
+
+/*!
+    Sets the beginning of the time range to \a startTimestamp.
+
+    For \l {QOpcUaHistoryReadRequest::Type} {RawModified}, the values are returned in reverse order
+    if the start timestamp is later than the end timestamp.
+*/
+void QOpcUaHistoryReadRequest::setStartTimestamp(const QDateTime &startTimestamp)
+{
+    data->startTimestamp = startTimestamp;
+}
+
+/*!
+    Returns the end of the time range.
+*/
+QDateTime QOpcUaHistoryReadRequest::endTimestamp() const
+{
+    return data->endTimestamp;
+}
+
+/*!
+    Sets the end of the time range to \a endTimestamp.
+*/
+void QOpcUaHistoryReadRequest::setEndTimestamp(const QDateTime &endTimestamp)
+{
+    data->endTimestamp = endTimestamp;
+}
+
+/*!
+    Returns the maximum number of values returned per node and response.
+*/
+quint32 QOpcUaHistoryReadRequest::numValuesPerNode() const
+{
+    return data->numValuesPerNode;
+}
+
+/*!
+    Sets the maximum number of values returned per node and response to \a numValuesPerNode.
+
+    Larger histories are read in chunks of at most \a numValuesPerNode values using continuation points.
+    The default value is 0, which leaves the chunk size to the server.
+*/
+void QOpcUaHistoryReadRequest::setNumValuesPerNode(quint32 numValuesPerNode)
+{
+    data->numValuesPerNode = numValuesPerNode;
+}
+
+/*!
+    Returns \c true if the bounding values of the time range are requested.
+*/
+bool QOpcUaHistoryReadRequest::returnBounds() const
+{
+    return data->returnBounds;
+}
+
+/*!
+    Sets the request of the bounding values of the time range to \a returnBounds.
+*/
+void QOpcUaHistoryReadRequest::setReturnBounds(bool returnBounds)
+{
+    data->returnBounds = returnBounds;
+}
+
+/*!
+    Returns \c true if modified values are read instead of raw values.
+*/
+bool QOpcUaHistoryReadRequest::readModified() const
+{
+    return data->readModified;
+}
+
+/*!
+    Sets the reading of modified values instead of raw values to \a readModified.
+*/
+void QOpcUaHistoryReadRequest::setReadModified(bool readModified)
+{
+    data->readModified = readModified;
+}
+
+/*!
+    Returns the node id of the aggregate function.
+*/
+QString QOpcUaHistoryReadRequest::aggregateType() const
+{
+    return data->aggregateType;
+}
+
+/*!
+    Sets the node id of the aggregate function to \a aggregateType, for example
+    \c {QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::AggregateFunction_Average)}.
+*/
+void QOpcUaHistoryReadRequest::setAggregateType(const QString &aggregateType)
+{
+    data->aggregateType = aggregateType;
+}
+
+/*!
+    Returns the length of the intervals the aggregate is calculated for in milliseconds.
+*/
+double QOpcUaHistoryReadRequest::processingInterval() const
+{
+    return data->processingInterval;
+}
+
+/*!
+    Sets the length of the intervals the aggregate is calculated for to \a processingInterval milliseconds.
+    For a processing interval of 0, the aggregate is calculated for the whole time range.
+*/
+void QOpcUaHistoryReadRequest::setProcessingInterval(double processingInterval)
+{
+    data->processingInterval = processingInterval;
+}
+
+/*!
+    Returns the timestamps for which values are requested.
+*/
+QVector<QDateTime> QOpcUaHistoryReadRequest::requestedTimestamps() const
+{
+    return data->requestedTimestamps;
+}
+
+/*!
+    Sets the timestamps for which values are requested to \a requestedTimestamps.
+*/
+void QOpcUaHistoryReadRequest::setRequestedTimestamps(const QVector<QDateTime> &requestedTimestamps)
+{
+    data->requestedTimestamps = requestedTimestamps;
+}
+
+/*!
+    Returns \c true if simple bounds are used for interpolating the values at the requested timestamps.
+*/
+bool QOpcUaHistoryReadRequest::useSimpleBounds() const
+{
+    return data->useSimpleBounds;
+}
+
+/*!
+    Sets the use of simple bounds for interpolating the values at the requested timestamps to \a useSimpleBounds.
+    The default value is \c true.
+*/
+void QOpcUaHistoryReadRequest::setUseSimpleBounds(bool useSimpleBounds)
+{
+    data->useSimpleBounds = useSimpleBounds;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,161 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuamonitoringitem.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaMonitoringItem
+    \inmodule QtOpcUa
+    \brief This class stores the node id, the attributes and the monitoring parameters of a monitored item operation.
+
+    One or multiple objects of this class make up the request of a \l QOpcUaClient::enableMonitoring(),
+    \l QOpcUaClient::disableMonitoring() or \l QOpcUaClient::modifyMonitoring() operation.
+    The backend combines the items into as few service calls as the server permits.
+
+    The results of these operations are also reported as objects of this class. Each result
+    contains the node id and exactly one attribute. The parameters contain the status code
+    and the values revised by the server.
+
+    \sa QOpcUaClient::enableMonitoring() QOpcUaMonitoringParameters
+*/
+
+class QOpcUaMonitoringItemData : public QSharedData
+{
+public:
+    QString nodeId;
+    QOpcUa::NodeAttributes attributes {QOpcUa::NodeAttribute::Value};
+    QOpcUaMonitoringParameters parameters;
+};
+
+QOpcUaMonitoringItem::QOpcUaMonitoringItem()
+    : data(new QOpcUaMonitoringItemData)
+{
+}
+
+/*!
+    Constructs a monitoring item from \a other.
+*/
+QOpcUaMonitoringItem::QOpcUaMonitoringItem(const QOpcUaMonitoringItem &other)
+    : data(other.data)
+{
+}
+
+/*!
+    Constructs a monitoring item for the attributes \a attributes of node \a nodeId
+    with the monitoring parameters \a parameters.
+*/
+QOpcUaMonitoringItem::QOpcUaMonitoringItem(const QString &nodeId, QOpcUa::NodeAttributes attributes,
+                                           const QOpcUaMonitoringParameters &parameters)
+    : data(new QOpcUaMonitoringItemData)
+{
+    setNodeId(nodeId);
+    setAttributes(attributes);
+    setParameters(parameters);
+}
+
+/*!
+    Sets the values from \a rhs in this monitoring item.
+*/
+QOpcUaMonitoringItem &QOpcUaMonitoringItem::operator=(const QOpcUaMonitoringItem &rhs)
+{
+    if (this != &rhs)
+        data.operator=(rhs.data);
+    return *this;
+}
+
+QOpcUaMonitoringItem::~QOpcUaMonitoringItem()
+{
+}
+
+/*!
+    Returns the node id.
+*/
+QString QOpcUaMonitoringItem::nodeId() const
+{
+    return data->nodeId;
+}
+
+/*!
+    Sets the node id to \a nodeId.
+*/
+void QOpcUaMonitoringItem::setNodeId(const QString &nodeId)
+{
+    data->nodeId = nodeId;
+}
+
+/*!
+    Returns the attributes.
+*/
+QOpcUa::NodeAttributes QOpcUaMonitoringItem::attributes() const
+{
+    return data->attributes;
+}
+
+/*!
+    Sets the attributes to \a attributes.
+*/
+void QOpcUaMonitoringItem::setAttributes(QOpcUa::NodeAttributes attributes)
+{
+    data->attributes = attributes;
+}
+
+/*!
+    Returns the monitoring parameters.
+*/
+QOpcUaMonitoringParameters QOpcUaMonitoringItem::parameters() const
+{
+    return data->parameters;
+}
+
+/*!
+    Returns a reference to the monitoring parameters.
+*/
+QOpcUaMonitoringParameters &QOpcUaMonitoringItem::parametersRef()
+{
+    return data->parameters;
+}
+
+/*!
+    Sets the monitoring parameters to \a parameters.
+*/
+void QOpcUaMonitoringItem::setParameters(const QOpcUaMonitoringParameters &parameters)
+{
+    data->parameters = parameters;
+}
+
+QT_END_NAMESPACE
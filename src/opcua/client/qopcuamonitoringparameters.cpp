@@ -135,6 +135,14 @@ QT_BEGIN_NAMESPACE
     \li MaxNotificationsPerPublish
     \li X
     \li X
+    \row
+    \li ClientSideFilter
+    \li X
+    \li
+    \row
+    \li MinimumDeliveryInterval
+    \li X
+    \li
     \endtable
 */
 
@@ -253,6 +261,92 @@ void QOpcUaMonitoringParameters::setIndexRange(const QString &indexRange)
     d_ptr->indexRange = indexRange;
 }
 
+/*!
+    Returns the deadband filter which is applied by the client to the values of the monitored item.
+
+    \sa setClientSideFilter()
+*/
+QOpcUaMonitoringParameters::DataChangeFilter QOpcUaMonitoringParameters::clientSideFilter() const
+{
+    return d_ptr->clientSideFilter;
+}
+
+/*!
+    Sets \a filter as deadband filter which is applied by the client to the values of the monitored item.
+
+    Unlike the filter set by \l setFilter(), this filter is evaluated by the backend before a data change
+    is delivered. This is useful for servers which don't support deadband filters.
+    Only the deadband type and value of \a filter are used, a change of the status code
+    is always delivered. A percent deadband requires the node to have an EURange property,
+    otherwise creating the monitored item fails with \l {QOpcUa::UaStatusCode} {BadDeadbandFilterInvalid}.
+
+    The client-side filter is applied to the value attribute only and can't be modified
+    after the monitored item has been created.
+
+    \sa suppressedNotifications()
+*/
+void QOpcUaMonitoringParameters::setClientSideFilter(const QOpcUaMonitoringParameters::DataChangeFilter &filter)
+{
+    d_ptr->clientSideFilter = filter;
+}
+
+/*!
+    Returns the minimum interval in milliseconds between two data change notifications
+    delivered for the monitored item.
+
+    \sa setMinimumDeliveryInterval()
+*/
+double QOpcUaMonitoringParameters::minimumDeliveryInterval() const
+{
+    return d_ptr->minimumDeliveryInterval;
+}
+
+/*!
+    Limits the rate of data change notifications delivered for the monitored item.
+    Values received less than \a minimumDeliveryInterval milliseconds after the previous notification
+    are held back and only the most recent one is delivered when the interval has elapsed.
+    A value of 0 disables the limit.
+*/
+void QOpcUaMonitoringParameters::setMinimumDeliveryInterval(double minimumDeliveryInterval)
+{
+    d_ptr->minimumDeliveryInterval = minimumDeliveryInterval;
+}
+
+/*!
+    Returns the number of data change notifications which have not been delivered because
+    of the client-side filter or the minimum delivery interval.
+
+    The counter is shared with the backend and keeps counting after monitoringStatus()
+    has returned these parameters.
+
+    \sa setClientSideFilter() setMinimumDeliveryInterval()
+*/
+quint64 QOpcUaMonitoringParameters::suppressedNotifications() const
+{
+    return d_ptr->suppressedNotifications ? d_ptr->suppressedNotifications->loadAcquire() : 0;
+}
+
+/*!
+    \internal
+
+    Attaches a new suppressed notifications counter to \a parameters.
+*/
+void qt_resetSuppressedNotifications(QOpcUaMonitoringParameters &parameters)
+{
+    parameters.d_ptr->suppressedNotifications.reset(new QAtomicInteger<quint64>(0));
+}
+
+/*!
+    \internal
+
+    Adds \a count to the suppressed notifications counter of \a parameters.
+*/
+void qt_addSuppressedNotifications(const QOpcUaMonitoringParameters &parameters, quint64 count)
+{
+    if (parameters.d_ptr->suppressedNotifications)
+        parameters.d_ptr->suppressedNotifications->fetchAndAddRelaxed(count);
+}
+
 /*!
     Returns the status code of the monitored item creation.
 */
@@ -187,9 +187,17 @@ public:
     void setSubscriptionType(SubscriptionType subscriptionType);
     QString indexRange() const;
     void setIndexRange(const QString &indexRange);
+    QOpcUaMonitoringParameters::DataChangeFilter clientSideFilter() const;
+    void setClientSideFilter(const QOpcUaMonitoringParameters::DataChangeFilter &filter);
+    double minimumDeliveryInterval() const;
+    void setMinimumDeliveryInterval(double minimumDeliveryInterval);
+    quint64 suppressedNotifications() const;
 
 private:
     QSharedDataPointer<QOpcUaMonitoringParametersPrivate> d_ptr;
+
+    friend Q_OPCUA_EXPORT void qt_resetSuppressedNotifications(QOpcUaMonitoringParameters &parameters);
+    friend Q_OPCUA_EXPORT void qt_addSuppressedNotifications(const QOpcUaMonitoringParameters &parameters, quint64 count);
 };
 
 Q_DECLARE_TYPEINFO(QOpcUaMonitoringParameters::SubscriptionType, Q_PRIMITIVE_TYPE);
@@ -50,7 +50,9 @@
 
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 
+#include <QtCore/qatomic.h>
 #include <QtCore/qshareddata.h>
+#include <QtCore/qsharedpointer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -73,6 +75,7 @@ public:
         , publishingEnabled(true)
         , statusCode(QOpcUa::UaStatusCode::BadNoEntryExists)
         , shared(QOpcUaMonitoringParameters::SubscriptionType::Shared)
+        , minimumDeliveryInterval(0)
     {}
 
     // MonitoredItem
@@ -97,8 +100,15 @@ public:
     // Qt OPC UA specific
     QOpcUa::UaStatusCode statusCode;
     QOpcUaMonitoringParameters::SubscriptionType shared;
+    QOpcUaMonitoringParameters::DataChangeFilter clientSideFilter;
+    double minimumDeliveryInterval;
+    // Shared by all copies of the parameters of a monitored item, incremented by the backend
+    QSharedPointer<QAtomicInteger<quint64>> suppressedNotifications;
 };
 
+Q_OPCUA_EXPORT void qt_resetSuppressedNotifications(QOpcUaMonitoringParameters &parameters);
+Q_OPCUA_EXPORT void qt_addSuppressedNotifications(const QOpcUaMonitoringParameters &parameters, quint64 count);
+
 QT_END_NAMESPACE
 
 #endif // QOPCUAMONITORINGPARAMETERS_P_H
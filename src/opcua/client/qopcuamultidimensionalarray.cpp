@@ -36,6 +36,8 @@
 
 #include "qopcuamultidimensionalarray.h"
 
+#include <cstring>
+
 QT_BEGIN_NAMESPACE
 
 /*
@@ -62,6 +64,106 @@ QT_BEGIN_NAMESPACE
     This class manages arrays of Qt OPC UA types with associated array dimensions information.
     It is returned as value when a multidimensional array is received from the server. It can also
     be used as a write value or as parameter for filters and method calls.
+
+    Arrays of numeric types can be stored in a contiguous buffer instead of a \l QVariantList.
+    Arrays received by the open62541 backend use this typed storage, it avoids a QVariant per element
+    for large arrays like images or spectra. The elements are accessed without copying using
+    \l constTypedData() or a \l QOpcUaMultiDimensionalArrayView returned by \l view():
+
+    \code
+    const auto image = result.value().value<QOpcUaMultiDimensionalArray>();
+    const QOpcUaMultiDimensionalArrayView<quint16> pixels = image.view<quint16>();
+    if (pixels.isValid()) {
+        const auto row = pixels.subArray(10);
+        quint16 pixel = row.value({20});
+    }
+    \endcode
+
+    The \l QVariantList based functions also work for typed storage, \l valueArray() converts
+    the elements and \l valueArrayRef() switches the array to a \l QVariantList.
+*/
+
+/*!
+    \class QOpcUaMultiDimensionalArrayView
+    \inmodule QtOpcUa
+    \since QtOpcUa 6.0
+    \brief A read-only view on the typed storage of a multidimensional array.
+
+    The view references the buffer of the \l QOpcUaMultiDimensionalArray it has been created from.
+    It stays valid as long as that array is neither modified nor destroyed.
+
+    \fn template <typename T> QOpcUaMultiDimensionalArrayView<T>::QOpcUaMultiDimensionalArrayView()
+
+    Constructs an invalid view.
+
+    \fn template <typename T> QOpcUaMultiDimensionalArrayView<T>::QOpcUaMultiDimensionalArrayView(const T *data, const QVector<quint32> &arrayDimensions, const QVector<quint32> &strides)
+
+    Constructs a view on \a data with dimensions \a arrayDimensions. Entry \e i of \a strides
+    is the distance in elements between two consecutive indices of dimension \e i.
+
+    \fn template <typename T> bool QOpcUaMultiDimensionalArrayView<T>::isValid() const
+
+    Returns \c true if the view references data.
+
+    \fn template <typename T> const T *QOpcUaMultiDimensionalArrayView<T>::data() const
+
+    Returns a pointer to the first element of the view.
+
+    \fn template <typename T> QVector<quint32> QOpcUaMultiDimensionalArrayView<T>::arrayDimensions() const
+
+    Returns the dimensions of the view.
+
+    \fn template <typename T> QVector<quint32> QOpcUaMultiDimensionalArrayView<T>::strides() const
+
+    Returns the strides of the dimensions of the view in elements.
+
+    \fn template <typename T> quint32 QOpcUaMultiDimensionalArrayView<T>::size() const
+
+    Returns the number of elements in the view.
+
+    \fn template <typename T> T QOpcUaMultiDimensionalArrayView<T>::value(const QVector<quint32> &indices) const
+
+    Returns the element identified by \a indices or a default constructed value if the indices are invalid.
+
+    \fn template <typename T> QOpcUaMultiDimensionalArrayView<T> QOpcUaMultiDimensionalArrayView<T>::subArray(quint32 index) const
+
+    Returns a view on the elements with \a index in the first dimension, for example a row of a matrix.
+    The returned view has one dimension less than this view.
+*/
+
+/*!
+    \fn template <typename T> void QOpcUaMultiDimensionalArray::setTypedValueArray(const T *values, int count)
+    \since QtOpcUa 6.0
+
+    Copies \a count elements from \a values into the typed storage of the multidimensional array.
+    A previously set \l QVariantList is cleared.
+
+    \fn template <typename T> void QOpcUaMultiDimensionalArray::setTypedValueArray(const QVector<T> &valueArray)
+    \since QtOpcUa 6.0
+
+    Copies the elements of \a valueArray into the typed storage of the multidimensional array.
+    A previously set \l QVariantList is cleared.
+
+    \fn template <typename T> QVector<T> QOpcUaMultiDimensionalArray::typedValueArray() const
+    \since QtOpcUa 6.0
+
+    Returns a copy of the typed storage or an empty vector if the elements are not stored as \c T.
+
+    \fn template <typename T> const T *QOpcUaMultiDimensionalArray::constTypedData() const
+    \since QtOpcUa 6.0
+
+    Returns a pointer to the typed storage or \c nullptr if the elements are not stored as \c T.
+
+    \fn template <typename T> T *QOpcUaMultiDimensionalArray::typedData()
+    \since QtOpcUa 6.0
+
+    Returns a pointer for modifying the typed storage or \c nullptr if the elements are not stored as \c T.
+
+    \fn template <typename T> QOpcUaMultiDimensionalArrayView<T> QOpcUaMultiDimensionalArray::view() const
+    \since QtOpcUa 6.0
+
+    Returns a view on the typed storage. The view is invalid if the elements are not stored as \c T
+    or if the array dimensions don't match the number of elements.
 */
 
 class QOpcUaMultiDimensionalArrayData : public QSharedData
@@ -70,6 +172,9 @@ public:
     QVariantList value;
     QVector<quint32> arrayDimensions;
     quint32 expectedArrayLength{0};
+    // Numeric elements are stored contiguously in row-major order, value is empty in this case
+    QByteArray typedValue;
+    int valueType{QMetaType::UnknownType};
 };
 
 QOpcUaMultiDimensionalArray::QOpcUaMultiDimensionalArray()
@@ -147,8 +252,13 @@ void QOpcUaMultiDimensionalArray::setArrayDimensions(const QVector<quint32> &arr
 */
 bool QOpcUaMultiDimensionalArray::operator==(const QOpcUaMultiDimensionalArray &other) const
 {
-    return arrayDimensions() == other.arrayDimensions() &&
-            valueArray() == other.valueArray();
+    if (arrayDimensions() != other.arrayDimensions())
+        return false;
+
+    if (isTyped() && data->valueType == other.data->valueType)
+        return data->typedValue == other.data->typedValue;
+
+    return valueArray() == other.valueArray();
 }
 
 /*!
@@ -164,14 +274,31 @@ QOpcUaMultiDimensionalArray::operator QVariant() const
 */
 QVariantList QOpcUaMultiDimensionalArray::valueArray() const
 {
-    return data->value;
+    if (!isTyped())
+        return data->value;
+
+    const int count = typedBufferSize();
+    const int elementSize = QMetaType::sizeOf(data->valueType);
+    const char *values = data->typedValue.constData();
+
+    QVariantList result;
+    result.reserve(count);
+    for (int i = 0; i < count; ++i)
+        result.append(QVariant(data->valueType, values + i * elementSize));
+    return result;
 }
 
 /*!
     Returns a reference to the value array of the multidimensional array.
+    If the elements are stored in the typed storage, they are converted to \l QVariantList first.
 */
 QVariantList &QOpcUaMultiDimensionalArray::valueArrayRef()
 {
+    if (isTyped()) {
+        data->value = valueArray();
+        data->typedValue.clear();
+        data->valueType = QMetaType::UnknownType;
+    }
     return data->value;
 }
 
@@ -181,6 +308,72 @@ QVariantList &QOpcUaMultiDimensionalArray::valueArrayRef()
 void QOpcUaMultiDimensionalArray::setValueArray(const QVariantList &value)
 {
     data->value = value;
+    data->typedValue.clear();
+    data->valueType = QMetaType::UnknownType;
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Returns \c true if the elements are stored in the typed storage.
+*/
+bool QOpcUaMultiDimensionalArray::isTyped() const
+{
+    return data->valueType != QMetaType::UnknownType;
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Returns the meta type id of the elements in the typed storage
+    or \c QMetaType::UnknownType if the elements are stored as \l QVariantList.
+*/
+int QOpcUaMultiDimensionalArray::valueType() const
+{
+    return data->valueType;
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Returns the distance in elements between two consecutive indices for each dimension.
+*/
+QVector<quint32> QOpcUaMultiDimensionalArray::strides() const
+{
+    QVector<quint32> result(data->arrayDimensions.size());
+    quint32 stride = 1;
+    for (int i = data->arrayDimensions.size() - 1; i >= 0; --i) {
+        result[i] = stride;
+        stride *= data->arrayDimensions.at(i);
+    }
+    return result;
+}
+
+void QOpcUaMultiDimensionalArray::setTypedBuffer(int valueType, const void *values, int count)
+{
+    data->value.clear();
+    data->valueType = valueType;
+    data->typedValue = QByteArray(static_cast<const char *>(values), qMax(count, 0) * QMetaType::sizeOf(valueType));
+}
+
+const void *QOpcUaMultiDimensionalArray::typedBuffer(int valueType) const
+{
+    return (isTyped() && data->valueType == valueType) ? data->typedValue.constData() : nullptr;
+}
+
+void *QOpcUaMultiDimensionalArray::typedBuffer(int valueType)
+{
+    return (isTyped() && data->valueType == valueType) ? data->typedValue.data() : nullptr;
+}
+
+int QOpcUaMultiDimensionalArray::typedBufferSize() const
+{
+    return isTyped() ? data->typedValue.size() / QMetaType::sizeOf(data->valueType) : 0;
+}
+
+int QOpcUaMultiDimensionalArray::elementCount() const
+{
+    return isTyped() ? typedBufferSize() : data->value.size();
 }
 
 /*!
@@ -192,12 +385,12 @@ int QOpcUaMultiDimensionalArray::arrayIndex(const QVector<quint32> &indices) con
 {
     // A QList can store INT_MAX values. Depending on the platform, this allows a size > UINT32_MAX
     if (data->expectedArrayLength > static_cast<quint64>((std::numeric_limits<int>::max)()) ||
-            static_cast<quint64>(data->value.size()) > (std::numeric_limits<quint32>::max)())
+            static_cast<quint64>(elementCount()) > (std::numeric_limits<quint32>::max)())
         return -1;
 
     // Check number of dimensions and data size
     if (indices.size() != data->arrayDimensions.size() ||
-            data->expectedArrayLength != static_cast<quint32>(data->value.size()))
+            data->expectedArrayLength != static_cast<quint32>(elementCount()))
         return -1; // Missing array dimensions or array dimensions don't fit the array
 
     quint32 index = 0;
@@ -229,11 +422,15 @@ QVariant QOpcUaMultiDimensionalArray::value(const QVector<quint32> &indices) con
     if (index < 0)
         return QVariant();
 
+    if (isTyped())
+        return QVariant(data->valueType, data->typedValue.constData() + index * QMetaType::sizeOf(data->valueType));
+
     return data->value.at(index);
 }
 
 /*!
     Sets the value at position \a indices to \a value.
+    For typed storage, \a value is converted to the element type.
     Returns \c true if the value has been successfully set.
 */
 bool QOpcUaMultiDimensionalArray::setValue(const QVector<quint32> &indices, const QVariant &value)
@@ -243,6 +440,15 @@ bool QOpcUaMultiDimensionalArray::setValue(const QVector<quint32> &indices, cons
     if (index < 0)
         return false;
 
+    if (isTyped()) {
+        QVariant converted = value;
+        if (!converted.convert(data->valueType))
+            return false;
+        const int elementSize = QMetaType::sizeOf(data->valueType);
+        std::memcpy(data->typedValue.data() + index * elementSize, converted.constData(), elementSize);
+        return true;
+    }
+
     data->value[index] = value;
     return true;
 }
@@ -252,8 +458,8 @@ bool QOpcUaMultiDimensionalArray::setValue(const QVector<quint32> &indices, cons
 */
 bool QOpcUaMultiDimensionalArray::isValid() const
 {
-    return static_cast<quint64>(data->value.size()) == data->expectedArrayLength &&
-            static_cast<quint64>(data->value.size()) <= (std::numeric_limits<quint32>::max)() &&
+    return static_cast<quint64>(elementCount()) == data->expectedArrayLength &&
+            static_cast<quint64>(elementCount()) <= (std::numeric_limits<quint32>::max)() &&
             static_cast<quint64>(data->arrayDimensions.size()) <= (std::numeric_limits<quint32>::max)();
 }
 
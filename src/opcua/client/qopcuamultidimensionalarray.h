@@ -41,9 +41,64 @@
 
 #include <QtCore/qshareddata.h>
 #include <QtCore/qvariant.h>
+#include <QtCore/qvector.h>
+
+#include <algorithm>
+#include <type_traits>
 
 QT_BEGIN_NAMESPACE
 
+template <typename T>
+class QOpcUaMultiDimensionalArrayView
+{
+public:
+    QOpcUaMultiDimensionalArrayView() = default;
+    QOpcUaMultiDimensionalArrayView(const T *data, const QVector<quint32> &arrayDimensions, const QVector<quint32> &strides)
+        : m_data(data)
+        , m_arrayDimensions(arrayDimensions)
+        , m_strides(strides)
+    {}
+
+    bool isValid() const { return m_data != nullptr; }
+    const T *data() const { return m_data; }
+    QVector<quint32> arrayDimensions() const { return m_arrayDimensions; }
+    QVector<quint32> strides() const { return m_strides; }
+
+    quint32 size() const
+    {
+        quint32 result = m_data ? 1 : 0;
+        for (const quint32 dimension : m_arrayDimensions)
+            result *= dimension;
+        return result;
+    }
+
+    T value(const QVector<quint32> &indices) const
+    {
+        if (!m_data || indices.size() != m_arrayDimensions.size())
+            return T();
+
+        quint32 index = 0;
+        for (int i = 0; i < indices.size(); ++i) {
+            if (indices.at(i) >= m_arrayDimensions.at(i))
+                return T();
+            index += indices.at(i) * m_strides.at(i);
+        }
+        return m_data[index];
+    }
+
+    QOpcUaMultiDimensionalArrayView subArray(quint32 index) const
+    {
+        if (!m_data || m_arrayDimensions.isEmpty() || index >= m_arrayDimensions.first())
+            return QOpcUaMultiDimensionalArrayView();
+        return QOpcUaMultiDimensionalArrayView(m_data + index * m_strides.first(), m_arrayDimensions.mid(1), m_strides.mid(1));
+    }
+
+private:
+    const T *m_data = nullptr;
+    QVector<quint32> m_arrayDimensions;
+    QVector<quint32> m_strides;
+};
+
 class QOpcUaMultiDimensionalArrayData;
 class Q_OPCUA_EXPORT QOpcUaMultiDimensionalArray
 {
@@ -72,7 +127,62 @@ public:
 
     operator QVariant() const;
 
+    bool isTyped() const;
+    int valueType() const;
+    QVector<quint32> strides() const;
+
+    template <typename T>
+    void setTypedValueArray(const T *values, int count)
+    {
+        static_assert(std::is_arithmetic<T>::value, "Typed storage requires a numeric type");
+        setTypedBuffer(qMetaTypeId<T>(), values, count);
+    }
+
+    template <typename T>
+    void setTypedValueArray(const QVector<T> &valueArray)
+    {
+        setTypedValueArray(valueArray.constData(), valueArray.size());
+    }
+
+    template <typename T>
+    QVector<T> typedValueArray() const
+    {
+        const T *values = constTypedData<T>();
+        if (!values)
+            return QVector<T>();
+        QVector<T> result(typedBufferSize());
+        std::copy(values, values + result.size(), result.begin());
+        return result;
+    }
+
+    template <typename T>
+    const T *constTypedData() const
+    {
+        return static_cast<const T *>(typedBuffer(qMetaTypeId<T>()));
+    }
+
+    template <typename T>
+    T *typedData()
+    {
+        return static_cast<T *>(typedBuffer(qMetaTypeId<T>()));
+    }
+
+    template <typename T>
+    QOpcUaMultiDimensionalArrayView<T> view() const
+    {
+        const T *values = constTypedData<T>();
+        if (!values || !isValid())
+            return QOpcUaMultiDimensionalArrayView<T>();
+        return QOpcUaMultiDimensionalArrayView<T>(values, arrayDimensions(), strides());
+    }
+
 private:
+    void setTypedBuffer(int valueType, const void *values, int count);
+    const void *typedBuffer(int valueType) const;
+    void *typedBuffer(int valueType);
+    int typedBufferSize() const;
+    int elementCount() const;
+
     QSharedDataPointer<QOpcUaMultiDimensionalArrayData> data;
 };
 
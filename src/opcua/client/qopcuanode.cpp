@@ -101,7 +101,8 @@ QT_BEGIN_NAMESPACE
     must be monitored using an \l {QOpcUaMonitoringParameters::EventFilter} {EventFilter} which selects
     the required event fields and filters the reported events by user defined criteria. The events are
     reported in the \l eventOccurred() signal as a \l QVariantList which contains the values of the selected
-    event fields.
+    event fields. Backends which receive events in batches additionally report all events of a
+    notification in one \l eventsOccurred() signal.
 
     Settings of the subscription and monitored item can be modified at runtime using \l modifyMonitoring().
 
@@ -250,6 +251,16 @@ QT_BEGIN_NAMESPACE
     The browse path \a path is the browse path from the request. It can be used to associate results with requests.
 */
 
+/*!
+    \fn void QOpcUaNode::registerNodeIdFinished(QString registeredNodeId, QOpcUa::UaStatusCode statusCode)
+    \since QtOpcUa 6.0
+
+    This signal is emitted after a \l registerNodeId() operation has finished.
+
+    \a registeredNodeId is the node id the server has assigned to this node for the current session.
+    If \a statusCode is not \l {QOpcUa::UaStatusCode} {Good}, \a registeredNodeId is empty.
+*/
+
 /*!
     \fn void QOpcUaNode::eventOccurred(QVariantList eventFields)
 
@@ -258,6 +269,19 @@ QT_BEGIN_NAMESPACE
     \a eventFields contains the values of the event fields in the order specified in the \c select clause of the event filter.
 */
 
+/*!
+    \fn void QOpcUaNode::eventsOccurred(QOpcUaEventBatch events)
+    \since QtOpcUa 6.0
+
+    This signal is emitted once for all events received in a notification.
+
+    \a events stores the fields column by column, which avoids converting every event to a
+    \l QVariantList. If \l eventOccurred() is connected, it is emitted for each event of the batch
+    after this signal.
+
+    This signal is currently only emitted by the open62541 backend.
+*/
+
 /*!
     \fn QOpcUa::NodeAttributes QOpcUaNode::mandatoryBaseAttributes()
 
@@ -668,6 +692,30 @@ bool QOpcUaNode::browseChildren(QOpcUa::ReferenceTypeId referenceType, QOpcUa::N
     return d->m_impl->browse(request);
 }
 
+/*!
+    \since QtOpcUa 6.0
+
+    Registers this node with the server using the RegisterNodes service specified in OPC-UA part 4, 5.8.5.
+
+    Returns \c true if the asynchronous call has been successfully dispatched.
+    The result is returned in the \l registerNodeIdFinished() signal.
+
+    Servers can use registration to prepare for repeated access to a node, for example by assigning
+    a numeric alias to a long string node id. While the node is registered, the backend uses the alias
+    for reading and writing the node's attributes. The node is unregistered when it is destroyed,
+    further calls of this function return \c false.
+
+    \sa QOpcUaClient::registerNodes()
+*/
+bool QOpcUaNode::registerNodeId()
+{
+    Q_D(QOpcUaNode);
+    if (d->m_client.isNull() || d->m_client->state() != QOpcUaClient::Connected)
+        return false;
+
+    return d->m_impl->registerNodeId();
+}
+
 /*!
     Returns the ID of the OPC UA node.
 */
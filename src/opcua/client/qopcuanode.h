@@ -38,6 +38,7 @@
 #define QOPCUANODE_H
 
 #include <QtOpcUa/qopcuabrowserequest.h>
+#include <QtOpcUa/qopcuaeventbatch.h>
 #include <QtOpcUa/qopcuaglobal.h>
 #include <QtOpcUa/qopcuamonitoringparameters.h>
 #include <QtOpcUa/qopcuareferencedescription.h>
@@ -104,12 +105,15 @@ public:
 
     bool browse(const QOpcUaBrowseRequest &request);
 
+    bool registerNodeId();
+
 Q_SIGNALS:
     void attributeRead(QOpcUa::NodeAttributes attributes);
     void attributeWritten(QOpcUa::NodeAttribute attribute, QOpcUa::UaStatusCode statusCode);
     void dataChangeOccurred(QOpcUa::NodeAttribute attr, QVariant value);
     void attributeUpdated(QOpcUa::NodeAttribute attr, QVariant value);
     void eventOccurred(QVariantList eventFields);
+    void eventsOccurred(QOpcUaEventBatch events);
 
     void monitoringStatusChanged(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUa::UaStatusCode statusCode);
@@ -119,6 +123,7 @@ Q_SIGNALS:
     void browseFinished(QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
     void resolveBrowsePathFinished(QVector<QOpcUaBrowsePathTarget> targets,
                                      QVector<QOpcUaRelativePathElement> path, QOpcUa::UaStatusCode statusCode);
+    void registerNodeIdFinished(QString registeredNodeId, QOpcUa::UaStatusCode statusCode);
 
 private:
     Q_DISABLE_COPY(QOpcUaNode)
@@ -53,6 +53,7 @@
 #include <QtOpcUa/qopcuaeventfilterresult.h>
 #include <private/qopcuanodeimpl_p.h>
 
+#include <private/qmetaobject_p.h>
 #include <private/qobject_p.h>
 #include <QtCore/qpointer.h>
 #include <QtCore/qscopedpointer.h>
@@ -115,6 +116,17 @@ public:
             emit q->attributeUpdated(attr, value.value());
         });
 
+        m_dataChangesOccurredConnection = QObject::connect(impl, &QOpcUaNodeImpl::dataChangesOccurred,
+                [this](QVector<QOpcUaReadResult> values)
+        {
+            Q_Q(QOpcUaNode);
+            for (const auto &value : qAsConst(values)) {
+                this->m_nodeAttributes[value.attribute()] = value;
+                emit q->dataChangeOccurred(value.attribute(), value.value());
+                emit q->attributeUpdated(value.attribute(), value.value());
+            }
+        });
+
         m_monitoringEnableDisableConnection = QObject::connect(impl, &QOpcUaNodeImpl::monitoringEnableDisable,
                 [this](QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status)
         {
@@ -203,6 +215,30 @@ public:
             Q_Q(QOpcUaNode);
             emit q->eventOccurred(eventFields);
         });
+
+        m_eventsOccurredConnection = QObject::connect(impl, &QOpcUaNodeImpl::eventsOccurred,
+            [this](QOpcUaEventBatch events)
+        {
+            Q_Q(QOpcUaNode);
+            emit q->eventsOccurred(events);
+
+            // Building the field lists is skipped if nobody listens for single events
+            static const int eventOccurredIndex = QMetaObjectPrivate::signalIndex(
+                        QMetaMethod::fromSignal(&QOpcUaNode::eventOccurred));
+            if (!isSignalConnected(eventOccurredIndex))
+                return;
+
+            QPointer<QOpcUaNode> guard(q);
+            for (int i = 0; i < events.count() && guard; ++i)
+                emit q->eventOccurred(events.eventFields(i));
+        });
+
+        m_registerNodeIdFinishedConnection = QObject::connect(impl, &QOpcUaNodeImpl::registerNodeIdFinished,
+            [this](QString registeredNodeId, QOpcUa::UaStatusCode statusCode)
+        {
+            Q_Q(QOpcUaNode);
+            emit q->registerNodeIdFinished(registeredNodeId, statusCode);
+        });
     }
 
     ~QOpcUaNodePrivate()
@@ -210,12 +246,15 @@ public:
         QObject::disconnect(m_attributesReadConnection);
         QObject::disconnect(m_attributeWrittenConnection);
         QObject::disconnect(m_dataChangeOccurredConnection);
+        QObject::disconnect(m_dataChangesOccurredConnection);
         QObject::disconnect(m_monitoringEnableDisableConnection);
         QObject::disconnect(m_monitoringStatusChangedConnection);
         QObject::disconnect(m_methodCallFinishedConnection);
         QObject::disconnect(m_browseFinishedConnection);
         QObject::disconnect(m_resolveBrowsePathFinishedConnection);
         QObject::disconnect(m_eventOccurredConnection);
+        QObject::disconnect(m_eventsOccurredConnection);
+        QObject::disconnect(m_registerNodeIdFinishedConnection);
 
         // Disable remaining monitorings
         QOpcUa::NodeAttributes attr;
@@ -237,12 +276,15 @@ public:
     QMetaObject::Connection m_attributesReadConnection;
     QMetaObject::Connection m_attributeWrittenConnection;
     QMetaObject::Connection m_dataChangeOccurredConnection;
+    QMetaObject::Connection m_dataChangesOccurredConnection;
     QMetaObject::Connection m_monitoringEnableDisableConnection;
     QMetaObject::Connection m_monitoringStatusChangedConnection;
     QMetaObject::Connection m_methodCallFinishedConnection;
     QMetaObject::Connection m_browseFinishedConnection;
     QMetaObject::Connection m_resolveBrowsePathFinishedConnection;
     QMetaObject::Connection m_eventOccurredConnection;
+    QMetaObject::Connection m_eventsOccurredConnection;
+    QMetaObject::Connection m_registerNodeIdFinishedConnection;
 };
 
 QT_END_NAMESPACE
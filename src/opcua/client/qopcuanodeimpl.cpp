@@ -36,8 +36,12 @@
 
 #include <private/qopcuanodeimpl_p.h>
 
+#include <QtCore/qloggingcategory.h>
+
 QT_BEGIN_NAMESPACE
 
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
 QOpcUaNodeImpl::QOpcUaNodeImpl()
     : m_handle{0}
     , m_registered{false}
@@ -68,4 +72,10 @@ void QOpcUaNodeImpl::setRegistered(bool registered)
     m_registered = registered;
 }
 
+bool QOpcUaNodeImpl::registerNodeId()
+{
+    qCWarning(QT_OPCUA) << "Registering nodes is not supported by the backend";
+    return false;
+}
+
 QT_END_NAMESPACE
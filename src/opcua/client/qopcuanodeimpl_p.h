@@ -83,6 +83,9 @@ public:
 
     virtual bool resolveBrowsePath(const QVector<QOpcUaRelativePathElement> &path) = 0;
 
+    // Backends without support for registering nodes don't need to implement this function
+    virtual bool registerNodeId();
+
     quint64 handle() const;
     void setHandle(quint64 handle);
 
@@ -95,13 +98,16 @@ Q_SIGNALS:
     void browseFinished(QVector<QOpcUaReferenceDescription> children, QOpcUa::UaStatusCode statusCode);
 
     void dataChangeOccurred(QOpcUa::NodeAttribute attr, QOpcUaReadResult value);
+    void dataChangesOccurred(QVector<QOpcUaReadResult> values);
     void eventOccurred(QVariantList eventFields);
+    void eventsOccurred(QOpcUaEventBatch events);
     void monitoringEnableDisable(QOpcUa::NodeAttribute attr, bool subscribe, QOpcUaMonitoringParameters status);
     void monitoringStatusChanged(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameters items,
                            QOpcUaMonitoringParameters param);
     void methodCallFinished(QString methodNodeId, QVariant result, QOpcUa::UaStatusCode statusCode);
     void resolveBrowsePathFinished(QVector<QOpcUaBrowsePathTarget> targets,
                                      QVector<QOpcUaRelativePathElement> path, QOpcUa::UaStatusCode status);
+    void registerNodeIdFinished(QString registeredNodeId, QOpcUa::UaStatusCode statusCode);
 
 private:
     quint64 m_handle;
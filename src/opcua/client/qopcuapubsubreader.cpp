@@ -0,0 +1,1159 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include "qopcuapubsubreader.h"
+#include "qopcuapubsubreader_p.h"
+#include "qopcuareadresult_p.h"
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qpointer.h>
+#include <QtCore/qvarlengtharray.h>
+#include <QtNetwork/qudpsocket.h>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA)
+
+/*!
+    \class QOpcUaPubSubReader
+    \inmodule QtOpcUa
+    \since QtOpcUa 6.0
+    \brief QOpcUaPubSubReader receives DataSets published with the OPC UA PubSub UADP message mapping.
+
+    Client/server subscriptions deliver data changes in publish responses, which are limited by the
+    publishing interval and the round trips to the server. Publishers using OPC UA PubSub
+    (OPC-UA part 14) instead send their DataSets to a UDP unicast or multicast address, without a
+    session and at rates of several kHz.
+
+    QOpcUaPubSubReader is bound to such an address with \l bind() and decodes the received UADP
+    NetworkMessages directly into a \l QOpcUaDataSetBatch. The DataSetMessages of all datagrams
+    available when the socket becomes readable are delivered in a single \l dataSetsReceived() signal.
+    It is not tied to a \l QOpcUaClient or a backend.
+
+    \code
+    QOpcUaPubSubReader reader;
+    reader.setWriterGroupId(100);
+    reader.setFieldNames({QStringLiteral("Counter"), QStringLiteral("Temperature")});
+    QObject::connect(&reader, &QOpcUaPubSubReader::dataSetsReceived, [](QOpcUaDataSetBatch dataSets) {
+        const auto temperatures = dataSets.typedField<double>(1);
+        ...
+    });
+    reader.bind(QUrl(QStringLiteral("opc.udp://239.0.0.1:4840")));
+    \endcode
+
+    The reader decodes key frames, delta frames and keep alive messages with the Variant, DataValue
+    or RawData field encoding. RawData encoded DataSets don't contain the types of their fields,
+    they can only be decoded if \l fieldTypes() is set. If the types are not set, the type of each
+    field is taken from the first key frame.
+
+    Only the DataSet fields are decoded, the timestamps and status codes of DataValue encoded fields
+    are skipped. Fields of a DataValue without value keep their last value. Signed and encrypted
+    messages, chunked messages and discovery messages are not supported and counted as dropped.
+*/
+
+/*!
+    \fn void QOpcUaPubSubReader::dataSetsReceived(QOpcUaDataSetBatch dataSets)
+
+    This signal is emitted when new DataSetMessages have been received.
+    \a dataSets contains all messages decoded since the last time this signal was emitted.
+*/
+
+namespace {
+
+// Size of the socket receive buffer, keeps bursts from being dropped while the event loop is busy
+constexpr int ReceiveBufferSize = 1024 * 1024;
+constexpr quint16 DefaultPort = 4840;
+
+// NetworkMessage header, OPC-UA part 14, 7.2.2.2.2
+constexpr quint8 UadpVersion = 1;
+constexpr quint8 UadpVersionMask = 0x0f;
+constexpr quint8 PublisherIdEnabled = 0x10;
+constexpr quint8 GroupHeaderEnabled = 0x20;
+constexpr quint8 PayloadHeaderEnabled = 0x40;
+constexpr quint8 ExtendedFlags1Enabled = 0x80;
+
+constexpr quint8 PublisherIdTypeMask = 0x07;
+constexpr quint8 DataSetClassIdEnabled = 0x08;
+constexpr quint8 SecurityEnabled = 0x10;
+constexpr quint8 TimestampEnabled = 0x20;
+constexpr quint8 PicoSecondsEnabled = 0x40;
+constexpr quint8 ExtendedFlags2Enabled = 0x80;
+
+constexpr quint8 ChunkMessage = 0x01;
+constexpr quint8 PromotedFieldsEnabled = 0x02;
+constexpr quint8 NetworkMessageTypeMask = 0x1c; // 0 for DataSetMessage payloads
+
+constexpr quint8 WriterGroupIdEnabled = 0x01;
+constexpr quint8 GroupVersionEnabled = 0x02;
+constexpr quint8 NetworkMessageNumberEnabled = 0x04;
+constexpr quint8 SequenceNumberEnabled = 0x08;
+
+// DataSetMessage header, OPC-UA part 14, 7.2.2.3.4
+constexpr quint8 DataSetMessageValid = 0x01;
+constexpr quint8 FieldEncodingMask = 0x06;
+constexpr quint8 DataSetSequenceNumberEnabled = 0x08;
+constexpr quint8 StatusEnabled = 0x10;
+constexpr quint8 ConfigurationVersionMajorEnabled = 0x20;
+constexpr quint8 ConfigurationVersionMinorEnabled = 0x40;
+constexpr quint8 DataSetFlags2Enabled = 0x80;
+
+constexpr quint8 DataSetMessageTypeMask = 0x0f;
+constexpr quint8 DataSetTimestampEnabled = 0x10;
+constexpr quint8 DataSetPicoSecondsEnabled = 0x20;
+
+enum DataSetMessageType : quint8 {
+    KeyFrame = 0,
+    DeltaFrame = 1,
+    Event = 2,
+    KeepAlive = 3
+};
+
+// Variant encoding mask, OPC-UA part 6, 5.2.2.16
+constexpr quint8 VariantTypeMask = 0x3f;
+constexpr quint8 VariantArrayDimensionsEncoded = 0x40;
+constexpr quint8 VariantArrayValuesEncoded = 0x80;
+
+// DataValue encoding mask, OPC-UA part 6, 5.2.2.17
+constexpr quint8 DataValueValue = 0x01;
+constexpr quint8 DataValueStatusCode = 0x02;
+constexpr quint8 DataValueSourceTimestamp = 0x04;
+constexpr quint8 DataValueServerTimestamp = 0x08;
+constexpr quint8 DataValueSourcePicoseconds = 0x10;
+constexpr quint8 DataValueServerPicoseconds = 0x20;
+
+// Types indexed by their builtin type id, OPC-UA part 6, 5.1.2
+const QOpcUa::Types builtinTypes[] = {
+    QOpcUa::Types::Undefined,
+    QOpcUa::Types::Boolean,
+    QOpcUa::Types::SByte,
+    QOpcUa::Types::Byte,
+    QOpcUa::Types::Int16,
+    QOpcUa::Types::UInt16,
+    QOpcUa::Types::Int32,
+    QOpcUa::Types::UInt32,
+    QOpcUa::Types::Int64,
+    QOpcUa::Types::UInt64,
+    QOpcUa::Types::Float,
+    QOpcUa::Types::Double,
+    QOpcUa::Types::String,
+    QOpcUa::Types::DateTime,
+    QOpcUa::Types::Guid,
+    QOpcUa::Types::ByteString,
+    QOpcUa::Types::XmlElement,
+    QOpcUa::Types::NodeId,
+    QOpcUa::Types::ExpandedNodeId,
+    QOpcUa::Types::StatusCode,
+    QOpcUa::Types::QualifiedName,
+    QOpcUa::Types::LocalizedText,
+    QOpcUa::Types::ExtensionObject
+};
+
+constexpr quint8 builtinTypeCount = sizeof(builtinTypes) / sizeof(builtinTypes[0]);
+
+QOpcUa::Types typeFromBuiltinTypeId(quint8 builtinTypeId)
+{
+    return builtinTypeId < builtinTypeCount ? builtinTypes[builtinTypeId] : QOpcUa::Types::Undefined;
+}
+
+quint8 builtinTypeIdFromType(QOpcUa::Types type)
+{
+    for (quint8 i = 1; i < builtinTypeCount; ++i) {
+        if (builtinTypes[i] == type)
+            return i;
+    }
+    return 0;
+}
+
+template <typename T>
+bool decodeScalar(QOpcUaBinaryDataEncoding &decoder, T &value)
+{
+    bool success = false;
+    value = decoder.decode<T>(success);
+    return success;
+}
+
+template <>
+bool decodeScalar<QDateTime>(QOpcUaBinaryDataEncoding &decoder, QDateTime &value)
+{
+    qint64 raw = 0;
+    if (!decodeScalar(decoder, raw))
+        return false;
+    value = QOpcUaRawTimestamp::toDateTime(raw);
+    return true;
+}
+
+QVariant decodeValue(QOpcUaBinaryDataEncoding &decoder, QOpcUa::Types type, bool &success)
+{
+    switch (type) {
+    case QOpcUa::Types::Boolean:
+        return decoder.decode<bool>(success);
+    case QOpcUa::Types::SByte:
+        return QVariant::fromValue(decoder.decode<qint8>(success));
+    case QOpcUa::Types::Byte:
+        return QVariant::fromValue(decoder.decode<quint8>(success));
+    case QOpcUa::Types::Int16:
+        return QVariant::fromValue(decoder.decode<qint16>(success));
+    case QOpcUa::Types::UInt16:
+        return QVariant::fromValue(decoder.decode<quint16>(success));
+    case QOpcUa::Types::Int32:
+        return QVariant::fromValue(decoder.decode<qint32>(success));
+    case QOpcUa::Types::UInt32:
+        return QVariant::fromValue(decoder.decode<quint32>(success));
+    case QOpcUa::Types::Int64:
+        return QVariant::fromValue(decoder.decode<qint64>(success));
+    case QOpcUa::Types::UInt64:
+        return QVariant::fromValue(decoder.decode<quint64>(success));
+    case QOpcUa::Types::Float:
+        return QVariant::fromValue(decoder.decode<float>(success));
+    case QOpcUa::Types::Double:
+        return QVariant::fromValue(decoder.decode<double>(success));
+    case QOpcUa::Types::String:
+    case QOpcUa::Types::XmlElement:
+        return decoder.decode<QString>(success);
+    case QOpcUa::Types::DateTime: {
+        QDateTime value;
+        success = decodeScalar(decoder, value);
+        return value;
+    }
+    case QOpcUa::Types::Guid:
+        return decoder.decode<QUuid>(success);
+    case QOpcUa::Types::ByteString:
+        return decoder.decode<QByteArray>(success);
+    case QOpcUa::Types::NodeId:
+        return decoder.decode<QString, QOpcUa::Types::NodeId>(success);
+    case QOpcUa::Types::ExpandedNodeId:
+        return QVariant::fromValue(decoder.decode<QOpcUaExpandedNodeId>(success));
+    case QOpcUa::Types::StatusCode:
+        return QVariant::fromValue(decoder.decode<QOpcUa::UaStatusCode>(success));
+    case QOpcUa::Types::QualifiedName:
+        return QVariant::fromValue(decoder.decode<QOpcUaQualifiedName>(success));
+    case QOpcUa::Types::LocalizedText:
+        return QVariant::fromValue(decoder.decode<QOpcUaLocalizedText>(success));
+    case QOpcUa::Types::ExtensionObject:
+        return QVariant::fromValue(decoder.decode<QOpcUaExtensionObject>(success));
+    default:
+        success = false;
+        return QVariant();
+    }
+}
+
+// Skips a value of type T
+template <typename T>
+bool skip(QOpcUaBinaryDataEncoding &decoder)
+{
+    T value;
+    return decodeScalar(decoder, value);
+}
+
+template <typename T>
+class TypedDataSetColumn : public QOpcUaDataSetColumn
+{
+public:
+    TypedDataSetColumn(QOpcUa::Types type, const QVariant &lastValue)
+        : QOpcUaDataSetColumn(type, builtinTypeIdFromType(type))
+        , m_last(lastValue.value<T>())
+    {}
+
+    bool isTyped() const override
+    {
+        return true;
+    }
+
+    bool decodeAndAppend(QOpcUaBinaryDataEncoding &decoder) override
+    {
+        T value;
+        if (!decodeScalar(decoder, value))
+            return false;
+        m_values.append(value);
+        m_last = std::move(value);
+        return true;
+    }
+
+    void append(const QVariant &value) override
+    {
+        m_last = value.value<T>();
+        m_values.append(m_last);
+    }
+
+    void repeatLast() override
+    {
+        m_values.append(m_last);
+    }
+
+    int size() const override
+    {
+        return m_values.size();
+    }
+
+    QVariant lastValue() const override
+    {
+        return QVariant::fromValue(m_last);
+    }
+
+    void setLastValue(const QVariant &value) override
+    {
+        m_last = value.value<T>();
+    }
+
+    QVariant take() override
+    {
+        const QVariant result = QVariant::fromValue(m_values);
+        m_values.clear();
+        return result;
+    }
+
+    QVariantList takeList() override
+    {
+        QVariantList result;
+        result.reserve(m_values.size());
+        for (const auto &value : qAsConst(m_values))
+            result.append(QVariant::fromValue(value));
+        m_values.clear();
+        return result;
+    }
+
+private:
+    QVector<T> m_values;
+    T m_last;
+};
+
+class GenericDataSetColumn : public QOpcUaDataSetColumn
+{
+public:
+    GenericDataSetColumn(QOpcUa::Types type, QVariantList values = QVariantList(), QVariant lastValue = QVariant())
+        : QOpcUaDataSetColumn(type, builtinTypeIdFromType(type))
+        , m_values(std::move(values))
+        , m_last(std::move(lastValue))
+    {}
+
+    bool isTyped() const override
+    {
+        return false;
+    }
+
+    bool decodeAndAppend(QOpcUaBinaryDataEncoding &decoder) override
+    {
+        bool success = false;
+        const QVariant value = decodeValue(decoder, type(), success);
+        if (!success)
+            return false;
+        append(value);
+        return true;
+    }
+
+    void append(const QVariant &value) override
+    {
+        m_values.append(value);
+        m_last = value;
+    }
+
+    void repeatLast() override
+    {
+        m_values.append(m_last);
+    }
+
+    int size() const override
+    {
+        return m_values.size();
+    }
+
+    QVariant lastValue() const override
+    {
+        return m_last;
+    }
+
+    void setLastValue(const QVariant &value) override
+    {
+        m_last = value;
+    }
+
+    QVariant take() override
+    {
+        const QVariant result = m_values;
+        m_values.clear();
+        return result;
+    }
+
+    QVariantList takeList() override
+    {
+        QVariantList result;
+        result.swap(m_values);
+        return result;
+    }
+
+private:
+    QVariantList m_values;
+    QVariant m_last;
+};
+
+std::unique_ptr<QOpcUaDataSetColumn> createColumn(QOpcUa::Types type, const QVariant &lastValue = QVariant())
+{
+    switch (type) {
+    case QOpcUa::Types::Boolean:
+        return std::make_unique<TypedDataSetColumn<bool>>(type, lastValue);
+    case QOpcUa::Types::SByte:
+        return std::make_unique<TypedDataSetColumn<qint8>>(type, lastValue);
+    case QOpcUa::Types::Byte:
+        return std::make_unique<TypedDataSetColumn<quint8>>(type, lastValue);
+    case QOpcUa::Types::Int16:
+        return std::make_unique<TypedDataSetColumn<qint16>>(type, lastValue);
+    case QOpcUa::Types::UInt16:
+        return std::make_unique<TypedDataSetColumn<quint16>>(type, lastValue);
+    case QOpcUa::Types::Int32:
+        return std::make_unique<TypedDataSetColumn<qint32>>(type, lastValue);
+    case QOpcUa::Types::UInt32:
+        return std::make_unique<TypedDataSetColumn<quint32>>(type, lastValue);
+    case QOpcUa::Types::Int64:
+        return std::make_unique<TypedDataSetColumn<qint64>>(type, lastValue);
+    case QOpcUa::Types::UInt64:
+        return std::make_unique<TypedDataSetColumn<quint64>>(type, lastValue);
+    case QOpcUa::Types::Float:
+        return std::make_unique<TypedDataSetColumn<float>>(type, lastValue);
+    case QOpcUa::Types::Double:
+        return std::make_unique<TypedDataSetColumn<double>>(type, lastValue);
+    case QOpcUa::Types::String:
+        return std::make_unique<TypedDataSetColumn<QString>>(type, lastValue);
+    case QOpcUa::Types::DateTime:
+        return std::make_unique<TypedDataSetColumn<QDateTime>>(type, lastValue);
+    default:
+        return std::make_unique<GenericDataSetColumn>(type, QVariantList(), lastValue);
+    }
+}
+
+} // namespace
+
+QOpcUaPubSubReaderPrivate::QOpcUaPubSubReaderPrivate()
+    : QObjectPrivate()
+{
+}
+
+QOpcUaPubSubReaderPrivate::~QOpcUaPubSubReaderPrivate()
+{
+}
+
+void QOpcUaPubSubReaderPrivate::readDatagrams()
+{
+    Q_Q(QOpcUaPubSubReader);
+
+    while (m_socket && m_socket->hasPendingDatagrams()) {
+        const qint64 size = m_socket->pendingDatagramSize();
+        if (size < 0)
+            break;
+
+        m_buffer.resize(static_cast<int>(size));
+        const qint64 received = m_socket->readDatagram(m_buffer.data(), size);
+        if (received < 0)
+            break;
+
+        m_buffer.resize(static_cast<int>(received));
+        decodeNetworkMessage(static_cast<int>(received));
+    }
+
+    if (m_messageCount)
+        m_completedBatches.append(takeDataSets());
+
+    const QVector<QOpcUaDataSetBatch> batches = std::move(m_completedBatches);
+    m_completedBatches.clear();
+
+    // A slot connected to dataSetsReceived() may delete the reader
+    QPointer<QOpcUaPubSubReader> guard(q);
+    for (const auto &batch : batches) {
+        if (!guard)
+            return;
+        emit q->dataSetsReceived(batch);
+    }
+}
+
+void QOpcUaPubSubReaderPrivate::resetColumns()
+{
+    m_columns.clear();
+    m_hasKeyFrame = false;
+    m_writerLastValues.clear();
+}
+
+void QOpcUaPubSubReaderPrivate::decodeNetworkMessage(int size)
+{
+    QOpcUaBinaryDataEncoding decoder(&m_buffer);
+
+    quint8 flags = 0;
+    if (!decodeScalar(decoder, flags) || (flags & UadpVersionMask) != UadpVersion) {
+        ++m_droppedMessages;
+        return;
+    }
+
+    quint8 extendedFlags1 = 0;
+    quint8 extendedFlags2 = 0;
+    bool success = true;
+
+    if (flags & ExtendedFlags1Enabled)
+        success = decodeScalar(decoder, extendedFlags1);
+    if (success && (extendedFlags1 & ExtendedFlags2Enabled))
+        success = decodeScalar(decoder, extendedFlags2);
+
+    if (!success || (extendedFlags1 & SecurityEnabled) || (extendedFlags2 & ChunkMessage)
+            || (extendedFlags2 & NetworkMessageTypeMask)) {
+        ++m_droppedMessages;
+        return;
+    }
+
+    QVariant publisherId;
+    if (flags & PublisherIdEnabled) {
+        switch (extendedFlags1 & PublisherIdTypeMask) {
+        case 0:
+            publisherId = QVariant::fromValue(decoder.decode<quint8>(success));
+            break;
+        case 1:
+            publisherId = QVariant::fromValue(decoder.decode<quint16>(success));
+            break;
+        case 2:
+            publisherId = QVariant::fromValue(decoder.decode<quint32>(success));
+            break;
+        case 3:
+            publisherId = QVariant::fromValue(decoder.decode<quint64>(success));
+            break;
+        case 4:
+            publisherId = decoder.decode<QString>(success);
+            break;
+        default:
+            success = false;
+        }
+    }
+
+    if (success && (extendedFlags1 & DataSetClassIdEnabled))
+        success = skip<QUuid>(decoder);
+
+    quint16 writerGroupId = 0;
+    if (success && (flags & GroupHeaderEnabled)) {
+        quint8 groupFlags = 0;
+        success = decodeScalar(decoder, groupFlags);
+        if (success && (groupFlags & WriterGroupIdEnabled))
+            success = decodeScalar(decoder, writerGroupId);
+        if (success && (groupFlags & GroupVersionEnabled))
+            success = skip<quint32>(decoder);
+        if (success && (groupFlags & NetworkMessageNumberEnabled))
+            success = skip<quint16>(decoder);
+        if (success && (groupFlags & SequenceNumberEnabled))
+            success = skip<quint16>(decoder);
+    }
+
+    QVarLengthArray<quint16, 32> dataSetWriterIds;
+    if (success && (flags & PayloadHeaderEnabled)) {
+        quint8 count = 0;
+        success = decodeScalar(decoder, count);
+        for (int i = 0; success && i < count; ++i) {
+            quint16 id = 0;
+            success = decodeScalar(decoder, id);
+            dataSetWriterIds.append(id);
+        }
+    } else {
+        dataSetWriterIds.append(0); // A NetworkMessage without payload header contains one DataSetMessage
+    }
+
+    qint64 timestamp = QOpcUaDataSetBatch::InvalidTimestamp;
+    if (success && (extendedFlags1 & TimestampEnabled)) {
+        qint64 raw = 0;
+        success = decodeScalar(decoder, raw);
+        timestamp = QOpcUaRawTimestamp::toMSecsSinceEpoch(raw);
+    }
+    if (success && (extendedFlags1 & PicoSecondsEnabled))
+        success = skip<quint16>(decoder);
+
+    if (success && (extendedFlags2 & PromotedFieldsEnabled)) {
+        quint16 promotedFieldsSize = 0;
+        success = decodeScalar(decoder, promotedFieldsSize) && decoder.offset() + promotedFieldsSize <= size;
+        if (success)
+            decoder.setOffset(decoder.offset() + promotedFieldsSize);
+    }
+
+    QVarLengthArray<quint16, 32> messageSizes;
+    for (int i = 0; success && dataSetWriterIds.size() > 1 && i < dataSetWriterIds.size(); ++i) {
+        quint16 messageSize = 0;
+        success = decodeScalar(decoder, messageSize);
+        messageSizes.append(messageSize);
+    }
+
+    if (!success) {
+        ++m_droppedMessages;
+        return;
+    }
+
+    if (m_writerGroupId && writerGroupId != m_writerGroupId)
+        return;
+
+    if (m_publisherId.isValid()) {
+        if (publisherId.userType() == QMetaType::QString || m_publisherId.userType() == QMetaType::QString) {
+            if (publisherId.userType() != QMetaType::QString || publisherId.toString() != m_publisherId.toString())
+                return;
+        } else {
+            bool ok = false;
+            if (!publisherId.isValid() || m_publisherId.toULongLong(&ok) != publisherId.toULongLong() || !ok)
+                return;
+        }
+    }
+
+    int offset = decoder.offset();
+    for (int i = 0; i < dataSetWriterIds.size(); ++i) {
+        const int end = messageSizes.isEmpty() ? size : offset + messageSizes.at(i);
+        if (end > size) {
+            m_droppedMessages += dataSetWriterIds.size() - i;
+            return;
+        }
+
+        // Without payload header, the DataSetWriterId is not known and the message is always decoded
+        const bool selected = !(flags & PayloadHeaderEnabled) || !m_dataSetWriterId
+                || dataSetWriterIds.at(i) == m_dataSetWriterId;
+
+        if (selected) {
+            decoder.setOffset(offset);
+            if (!decodeDataSetMessage(decoder, end, dataSetWriterIds.at(i), timestamp))
+                ++m_droppedMessages;
+        }
+
+        offset = end;
+    }
+}
+
+// Returns false if the message was dropped, a message which is only partially decoded is
+// added with status BadDecodingError and the last values for the missing fields.
+bool QOpcUaPubSubReaderPrivate::decodeDataSetMessage(QOpcUaBinaryDataEncoding &decoder, int end,
+                                                     quint16 dataSetWriterId, qint64 networkTimestamp)
+{
+    quint8 flags1 = 0;
+    if (!decodeScalar(decoder, flags1))
+        return false;
+
+    if (!(flags1 & DataSetMessageValid))
+        return true; // Messages marked as invalid are ignored by the reader
+
+    const quint8 encodingValue = (flags1 & FieldEncodingMask) >> 1;
+    if (encodingValue > static_cast<quint8>(FieldEncoding::DataValue))
+        return false;
+    const auto encoding = static_cast<FieldEncoding>(encodingValue);
+
+    quint8 flags2 = 0;
+    quint16 sequenceNumber = 0;
+    qint64 timestamp = networkTimestamp;
+    quint16 status = 0;
+    bool success = true;
+
+    if (flags1 & DataSetFlags2Enabled)
+        success = decodeScalar(decoder, flags2);
+    if (success && (flags1 & DataSetSequenceNumberEnabled))
+        success = decodeScalar(decoder, sequenceNumber);
+    if (success && (flags2 & DataSetTimestampEnabled)) {
+        qint64 raw = 0;
+        success = decodeScalar(decoder, raw);
+        timestamp = QOpcUaRawTimestamp::toMSecsSinceEpoch(raw);
+    }
+    if (success && (flags2 & DataSetPicoSecondsEnabled))
+        success = skip<quint16>(decoder);
+    if (success && (flags1 & StatusEnabled))
+        success = decodeScalar(decoder, status);
+    if (success && (flags1 & ConfigurationVersionMajorEnabled))
+        success = skip<quint32>(decoder);
+    if (success && (flags1 & ConfigurationVersionMinorEnabled))
+        success = skip<quint32>(decoder);
+
+    if (!success)
+        return false;
+
+    const quint8 messageType = flags2 & DataSetMessageTypeMask;
+    if (messageType == KeepAlive)
+        return true;
+
+    if (dataSetWriterId != m_currentWriterId)
+        switchWriter(dataSetWriterId);
+
+    bool complete = true;
+
+    if (messageType == KeyFrame) {
+        int fieldCount = 0;
+        if (encoding == FieldEncoding::RawData) {
+            // RawData doesn't contain the field count, it must be known from the configured types
+            if (m_fieldTypes.isEmpty())
+                return false;
+            fieldCount = m_fieldTypes.size();
+        } else {
+            quint16 count = 0;
+            if (!decodeScalar(decoder, count))
+                return false;
+            fieldCount = count;
+        }
+
+        if (!createColumns(fieldCount))
+            return false;
+
+        for (int i = 0; complete && i < fieldCount; ++i)
+            complete = decodeField(decoder, i, encoding);
+
+        m_hasKeyFrame = true;
+    } else if (messageType == DeltaFrame) {
+        if (!m_hasKeyFrame)
+            return false; // The values of the fields which are not contained are not known yet
+
+        quint16 count = 0;
+        if (!decodeScalar(decoder, count))
+            return false;
+
+        for (int i = 0; complete && i < count; ++i) {
+            quint16 index = 0;
+            complete = decodeScalar(decoder, index) && index < m_columns.size()
+                    && m_columns[index]->size() == m_messageCount // Each field is contained at most once
+                    && decodeField(decoder, index, encoding);
+        }
+    } else {
+        return false;
+    }
+
+    if (decoder.offset() > end)
+        complete = false;
+
+    for (int i = 0; i < static_cast<int>(m_columns.size()); ++i) {
+        if (!m_columns[i] || m_columns[i]->size() == m_messageCount)
+            repeatColumn(i);
+    }
+
+    m_messageWriterIds.append(dataSetWriterId);
+    m_messageSequenceNumbers.append(sequenceNumber);
+    m_messageTimestamps.append(timestamp);
+    // The DataSetMessage status contains the upper 16 bits of a status code
+    m_messageStatusCodes.append(complete ? QOpcUa::UaStatusCode(quint32(status) << 16)
+                                         : QOpcUa::UaStatusCode::BadDecodingError);
+    ++m_messageCount;
+    ++m_receivedMessages;
+
+    return true;
+}
+
+// Returns false if no value could be decoded for the field
+bool QOpcUaPubSubReaderPrivate::decodeField(QOpcUaBinaryDataEncoding &decoder, int index, FieldEncoding encoding)
+{
+    if (encoding == FieldEncoding::RawData)
+        return m_columns[index]->decodeAndAppend(decoder);
+
+    if (encoding == FieldEncoding::Variant)
+        return decodeVariantField(decoder, index);
+
+    quint8 mask = 0;
+    if (!decodeScalar(decoder, mask))
+        return false;
+
+    bool success = true;
+    if (mask & DataValueValue)
+        success = decodeVariantField(decoder, index);
+    else
+        repeatColumn(index);
+
+    // A missing status or timestamp is reported when the row is finished because the value is already appended
+    if (success && (mask & DataValueStatusCode))
+        skip<quint32>(decoder);
+    if (success && (mask & DataValueSourceTimestamp))
+        skip<qint64>(decoder);
+    if (success && (mask & DataValueSourcePicoseconds))
+        skip<quint16>(decoder);
+    if (success && (mask & DataValueServerTimestamp))
+        skip<qint64>(decoder);
+    if (success && (mask & DataValueServerPicoseconds))
+        skip<quint16>(decoder);
+
+    return success;
+}
+
+bool QOpcUaPubSubReaderPrivate::decodeVariantField(QOpcUaBinaryDataEncoding &decoder, int index)
+{
+    quint8 mask = 0;
+    if (!decodeScalar(decoder, mask))
+        return false;
+
+    const quint8 builtinTypeId = mask & VariantTypeMask;
+    const QOpcUa::Types type = typeFromBuiltinTypeId(builtinTypeId);
+    auto &column = m_columns[index];
+
+    if (!(mask & VariantArrayValuesEncoded)) {
+        if (!column)
+            column = createColumn(type);
+        // Fast path, the value is decoded directly into a typed column
+        if (builtinTypeId && column->builtinTypeId() == builtinTypeId)
+            return column->decodeAndAppend(decoder);
+    }
+
+    bool success = true;
+    QVariant value;
+
+    if (mask & VariantArrayValuesEncoded) {
+        qint32 length = 0;
+        if (!decodeScalar(decoder, length) || length > m_buffer.size() - decoder.offset())
+            return false;
+
+        QVariantList values;
+        values.reserve(qMax(length, 0));
+        for (int i = 0; success && i < length; ++i)
+            values.append(decodeValue(decoder, type, success));
+
+        if (success && (mask & VariantArrayDimensionsEncoded))
+            decoder.decodeArray<qint32>(success); // Multi dimensional arrays are delivered flattened
+
+        value = values;
+    } else if (builtinTypeId) {
+        value = decodeValue(decoder, type, success);
+    }
+
+    if (!success)
+        return false;
+
+    if (!column)
+        column = std::make_unique<GenericDataSetColumn>(type);
+    else if (column->isTyped())
+        degradeColumn(index);
+
+    column->append(value);
+    return true;
+}
+
+bool QOpcUaPubSubReaderPrivate::createColumns(int fieldCount)
+{
+    if (!m_fieldTypes.isEmpty() && m_fieldTypes.size() != fieldCount) {
+        qCWarning(QT_OPCUA) << "Dropping DataSetMessage with" << fieldCount << "fields, expected" << m_fieldTypes.size();
+        return false;
+    }
+
+    if (static_cast<int>(m_columns.size()) == fieldCount)
+        return true;
+
+    if (!m_columns.empty()) {
+        // The publisher has changed its DataSet, the messages decoded so far are delivered with the old layout
+        qCDebug(QT_OPCUA) << "DataSet field count changed from" << m_columns.size() << "to" << fieldCount;
+        if (m_messageCount)
+            m_completedBatches.append(takeDataSets());
+        resetColumns();
+    }
+
+    m_columns.resize(fieldCount);
+
+    // Without configured types, the columns are created from the first values of the fields
+    for (int i = 0; i < m_fieldTypes.size(); ++i)
+        m_columns[i] = createColumn(m_fieldTypes.at(i));
+
+    return true;
+}
+
+// Turns a typed column into a generic column until the next batch is emitted
+void QOpcUaPubSubReaderPrivate::degradeColumn(int index)
+{
+    auto &column = m_columns[index];
+    const QVariant lastValue = column->lastValue();
+    column = std::make_unique<GenericDataSetColumn>(column->type(), column->takeList(), lastValue);
+}
+
+void QOpcUaPubSubReaderPrivate::repeatColumn(int index)
+{
+    auto &column = m_columns[index];
+    if (!column)
+        column = std::make_unique<GenericDataSetColumn>(QOpcUa::Types::Undefined);
+    column->repeatLast();
+}
+
+// Delta frames are completed with the last values of their own DataSetWriter
+void QOpcUaPubSubReaderPrivate::switchWriter(quint16 dataSetWriterId)
+{
+    if (m_hasKeyFrame) {
+        QVariantList lastValues;
+        lastValues.reserve(static_cast<int>(m_columns.size()));
+        for (const auto &column : m_columns)
+            lastValues.append(column ? column->lastValue() : QVariant());
+        m_writerLastValues.insert(m_currentWriterId, lastValues);
+    }
+
+    m_currentWriterId = dataSetWriterId;
+    const QVariantList lastValues = m_writerLastValues.take(dataSetWriterId);
+    m_hasKeyFrame = !lastValues.isEmpty() && lastValues.size() == static_cast<int>(m_columns.size());
+    if (!m_hasKeyFrame)
+        return;
+
+    for (int i = 0; i < lastValues.size(); ++i) {
+        if (m_columns[i])
+            m_columns[i]->setLastValue(lastValues.at(i));
+    }
+}
+
+QOpcUaDataSetBatch QOpcUaPubSubReaderPrivate::takeDataSets()
+{
+    QVariantList fields;
+    fields.reserve(static_cast<int>(m_columns.size()));
+    for (auto &column : m_columns) {
+        fields.append(column->take());
+        // Columns which have been turned into generic columns by an unexpected value get their type back
+        if (!column->isTyped()) {
+            auto restored = createColumn(column->type(), column->lastValue());
+            if (restored->isTyped())
+                column = std::move(restored);
+        }
+    }
+
+    QOpcUaDataSetBatch batch;
+    batch.setCount(m_messageCount);
+    batch.setFieldNames(m_fieldNames);
+    batch.setFields(fields);
+    batch.setDataSetWriterIds(m_messageWriterIds);
+    batch.setSequenceNumbers(m_messageSequenceNumbers);
+    batch.setTimestamps(m_messageTimestamps);
+    batch.setStatusCodes(m_messageStatusCodes);
+
+    m_messageCount = 0;
+    m_messageWriterIds.clear();
+    m_messageSequenceNumbers.clear();
+    m_messageTimestamps.clear();
+    m_messageStatusCodes.clear();
+
+    return batch;
+}
+
+/*!
+    Creates a PubSub reader with parent \a parent.
+*/
+QOpcUaPubSubReader::QOpcUaPubSubReader(QObject *parent)
+    : QObject(*(new QOpcUaPubSubReaderPrivate()), parent)
+{
+}
+
+QOpcUaPubSubReader::~QOpcUaPubSubReader()
+{
+}
+
+/*!
+    Returns the PublisherId of the messages decoded by this reader.
+*/
+QVariant QOpcUaPubSubReader::publisherId() const
+{
+    Q_D(const QOpcUaPubSubReader);
+    return d->m_publisherId;
+}
+
+/*!
+    Sets the PublisherId of the messages decoded by this reader to \a publisherId.
+    Numeric PublisherIds are compared by value, string PublisherIds must be passed as QString.
+    If \a publisherId is invalid, which is the default, messages from all publishers are decoded.
+*/
+void QOpcUaPubSubReader::setPublisherId(const QVariant &publisherId)
+{
+    Q_D(QOpcUaPubSubReader);
+    d->m_publisherId = publisherId;
+}
+
+/*!
+    Returns the WriterGroupId of the messages decoded by this reader.
+*/
+quint16 QOpcUaPubSubReader::writerGroupId() const
+{
+    Q_D(const QOpcUaPubSubReader);
+    return d->m_writerGroupId;
+}
+
+/*!
+    Sets the WriterGroupId of the messages decoded by this reader to \a writerGroupId.
+    If \a writerGroupId is \c 0, which is the default, messages from all writer groups are decoded.
+*/
+void QOpcUaPubSubReader::setWriterGroupId(quint16 writerGroupId)
+{
+    Q_D(QOpcUaPubSubReader);
+    d->m_writerGroupId = writerGroupId;
+}
+
+/*!
+    Returns the DataSetWriterId of the DataSetMessages decoded by this reader.
+*/
+quint16 QOpcUaPubSubReader::dataSetWriterId() const
+{
+    Q_D(const QOpcUaPubSubReader);
+    return d->m_dataSetWriterId;
+}
+
+/*!
+    Sets the DataSetWriterId of the DataSetMessages decoded by this reader to \a dataSetWriterId.
+    If \a dataSetWriterId is \c 0, which is the default, the messages of all DataSetWriters are decoded.
+    All decoded messages must belong to DataSets with the same fields. The fields which are not
+    contained in a delta frame keep the last values of the DataSetWriter which sent it.
+*/
+void QOpcUaPubSubReader::setDataSetWriterId(quint16 dataSetWriterId)
+{
+    Q_D(QOpcUaPubSubReader);
+    d->m_dataSetWriterId = dataSetWriterId;
+}
+
+/*!
+    Returns the field names which are passed on in \l QOpcUaDataSetBatch::fieldNames().
+*/
+QStringList QOpcUaPubSubReader::fieldNames() const
+{
+    Q_D(const QOpcUaPubSubReader);
+    return d->m_fieldNames;
+}
+
+/*!
+    Sets the names of the DataSet fields to \a fieldNames.
+    UADP messages don't contain the field names, they are taken from the DataSetMetaData of the publisher.
+*/
+void QOpcUaPubSubReader::setFieldNames(const QStringList &fieldNames)
+{
+    Q_D(QOpcUaPubSubReader);
+    d->m_fieldNames = fieldNames;
+}
+
+/*!
+    Returns the expected types of the DataSet fields.
+*/
+QVector<QOpcUa::Types> QOpcUaPubSubReader::fieldTypes() const
+{
+    Q_D(const QOpcUaPubSubReader);
+    return d->m_fieldTypes;
+}
+
+/*!
+    Sets the expected types of the DataSet fields to \a fieldTypes.
+
+    The types are required to decode messages with RawData field encoding. For other encodings,
+    they determine the column types of the delivered batches and key frames with a different number
+    of fields are dropped.
+*/
+void QOpcUaPubSubReader::setFieldTypes(const QVector<QOpcUa::Types> &fieldTypes)
+{
+    Q_D(QOpcUaPubSubReader);
+    d->m_fieldTypes = fieldTypes;
+    d->resetColumns();
+}
+
+/*!
+    Starts receiving UADP NetworkMessages sent to \a address.
+
+    \a address must be an \c opc.udp URL with an IPv4 or IPv6 address and an optional port,
+    the default port is 4840. For a multicast address, the reader joins the multicast group on
+    the default interface. For a unicast address, the reader binds to the local interface with
+    this address.
+
+    Returns \c true if the socket has been bound. Calling this function closes the previous socket.
+
+    \sa close()
+*/
+bool QOpcUaPubSubReader::bind(const QUrl &address)
+{
+    Q_D(QOpcUaPubSubReader);
+
+    close();
+
+    if (address.scheme() != QLatin1String("opc.udp")) {
+        qCWarning(QT_OPCUA) << "Unsupported PubSub address" << address << "only opc.udp is supported";
+        return false;
+    }
+
+    const QHostAddress host(address.host());
+    if (host.isNull()) {
+        qCWarning(QT_OPCUA) << "The host of the PubSub address" << address << "must be an IP address";
+        return false;
+    }
+
+    const quint16 port = static_cast<quint16>(address.port(DefaultPort));
+    auto socket = new QUdpSocket(this);
+
+    bool success = false;
+    if (host.isMulticast()) {
+        const QHostAddress any = host.protocol() == QAbstractSocket::IPv6Protocol ? QHostAddress::AnyIPv6 : QHostAddress::AnyIPv4;
+        success = socket->bind(any, port, QAbstractSocket::ShareAddress | QAbstractSocket::ReuseAddressHint)
+                && socket->joinMulticastGroup(host);
+    } else {
+        success = socket->bind(host, port);
+    }
+
+    if (!success) {
+        qCWarning(QT_OPCUA) << "Failed to bind the PubSub reader to" << address << socket->errorString();
+        delete socket;
+        return false;
+    }
+
+    socket->setSocketOption(QAbstractSocket::ReceiveBufferSizeSocketOption, ReceiveBufferSize);
+    QObjectPrivate::connect(socket, &QUdpSocket::readyRead, d, &QOpcUaPubSubReaderPrivate::readDatagrams);
+
+    d->m_socket = socket;
+    d->resetColumns();
+    return true;
+}
+
+/*!
+    Stops receiving messages.
+*/
+void QOpcUaPubSubReader::close()
+{
+    Q_D(QOpcUaPubSubReader);
+
+    if (!d->m_socket)
+        return;
+
+    d->m_socket->close();
+    d->m_socket->deleteLater(); // close() may be called from a slot while the socket is being read
+    d->m_socket = nullptr;
+}
+
+/*!
+    Returns \c true if the reader is bound to an address.
+*/
+bool QOpcUaPubSubReader::isBound() const
+{
+    Q_D(const QOpcUaPubSubReader);
+    return d->m_socket && d->m_socket->state() == QAbstractSocket::BoundState;
+}
+
+/*!
+    Returns the number of DataSetMessages which have been delivered in \l dataSetsReceived()
+    since the reader was created.
+*/
+quint64 QOpcUaPubSubReader::receivedMessageCount() const
+{
+    Q_D(const QOpcUaPubSubReader);
+    return d->m_receivedMessages;
+}
+
+/*!
+    Returns the number of received messages which could not be decoded or use unsupported
+    features of UADP. Messages which don't match the configured PublisherId, WriterGroupId or
+    DataSetWriterId are not counted.
+*/
+quint64 QOpcUaPubSubReader::droppedMessageCount() const
+{
+    Q_D(const QOpcUaPubSubReader);
+    return d->m_droppedMessages;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,90 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef QOPCUAPUBSUBREADER_H
+#define QOPCUAPUBSUBREADER_H
+
+#include <QtOpcUa/qopcuadatasetbatch.h>
+#include <QtOpcUa/qopcuaglobal.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qobject.h>
+#include <QtCore/qurl.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaPubSubReaderPrivate;
+
+class Q_OPCUA_EXPORT QOpcUaPubSubReader : public QObject
+{
+    Q_OBJECT
+    Q_DECLARE_PRIVATE(QOpcUaPubSubReader)
+
+public:
+    explicit QOpcUaPubSubReader(QObject *parent = nullptr);
+    ~QOpcUaPubSubReader();
+
+    QVariant publisherId() const;
+    void setPublisherId(const QVariant &publisherId);
+
+    quint16 writerGroupId() const;
+    void setWriterGroupId(quint16 writerGroupId);
+
+    quint16 dataSetWriterId() const;
+    void setDataSetWriterId(quint16 dataSetWriterId);
+
+    QStringList fieldNames() const;
+    void setFieldNames(const QStringList &fieldNames);
+
+    QVector<QOpcUa::Types> fieldTypes() const;
+    void setFieldTypes(const QVector<QOpcUa::Types> &fieldTypes);
+
+    bool bind(const QUrl &address);
+    void close();
+    bool isBound() const;
+
+    quint64 receivedMessageCount() const;
+    quint64 droppedMessageCount() const;
+
+Q_SIGNALS:
+    void dataSetsReceived(QOpcUaDataSetBatch dataSets);
+
+private:
+    Q_DISABLE_COPY(QOpcUaPubSubReader)
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAPUBSUBREADER_H
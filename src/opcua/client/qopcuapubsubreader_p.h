@@ -0,0 +1,149 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef QOPCUAPUBSUBREADER_P_H
+#define QOPCUAPUBSUBREADER_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuapubsubreader.h>
+
+#include <private/qobject_p.h>
+
+#include <QtCore/qbytearray.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qvector.h>
+
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaBinaryDataEncoding;
+class QUdpSocket;
+
+// Values of one DataSet field received since the last batch was emitted
+class QOpcUaDataSetColumn
+{
+public:
+    QOpcUaDataSetColumn(QOpcUa::Types type, quint8 builtinTypeId)
+        : m_type(type)
+        , m_builtinTypeId(builtinTypeId)
+    {}
+    virtual ~QOpcUaDataSetColumn() = default;
+
+    QOpcUa::Types type() const { return m_type; }
+    quint8 builtinTypeId() const { return m_builtinTypeId; } // 0 if the type has no builtin type id
+
+    virtual bool isTyped() const = 0;
+    // Decodes a value of type() without encoding mask, nothing is appended if decoding fails
+    virtual bool decodeAndAppend(QOpcUaBinaryDataEncoding &decoder) = 0;
+    virtual void append(const QVariant &value) = 0; // Only supported by generic columns
+    virtual void repeatLast() = 0;
+    virtual int size() const = 0;
+    virtual QVariant lastValue() const = 0;
+    virtual void setLastValue(const QVariant &value) = 0;
+    virtual QVariant take() = 0;
+    virtual QVariantList takeList() = 0;
+
+private:
+    QOpcUa::Types m_type;
+    quint8 m_builtinTypeId;
+};
+
+class QOpcUaPubSubReaderPrivate : public QObjectPrivate
+{
+    Q_DECLARE_PUBLIC(QOpcUaPubSubReader)
+public:
+    QOpcUaPubSubReaderPrivate();
+    ~QOpcUaPubSubReaderPrivate();
+
+    void readDatagrams();
+    void resetColumns();
+
+    QVariant m_publisherId;
+    quint16 m_writerGroupId = 0;
+    quint16 m_dataSetWriterId = 0;
+    QStringList m_fieldNames;
+    QVector<QOpcUa::Types> m_fieldTypes;
+
+    QUdpSocket *m_socket = nullptr;
+    quint64 m_receivedMessages = 0;
+    quint64 m_droppedMessages = 0;
+
+private:
+    // Encoding of the fields of a DataSetMessage, OPC-UA part 14, 7.2.2.3.4
+    enum class FieldEncoding {
+        Variant = 0,
+        RawData = 1,
+        DataValue = 2
+    };
+
+    void decodeNetworkMessage(int size);
+    bool decodeDataSetMessage(QOpcUaBinaryDataEncoding &decoder, int end, quint16 dataSetWriterId, qint64 networkTimestamp);
+    bool decodeField(QOpcUaBinaryDataEncoding &decoder, int index, FieldEncoding encoding);
+    bool decodeVariantField(QOpcUaBinaryDataEncoding &decoder, int index);
+    bool createColumns(int fieldCount);
+    void degradeColumn(int index);
+    void repeatColumn(int index);
+    void switchWriter(quint16 dataSetWriterId);
+    QOpcUaDataSetBatch takeDataSets();
+
+    QByteArray m_buffer; // Reused for all datagrams
+    std::vector<std::unique_ptr<QOpcUaDataSetColumn>> m_columns; // Null until the type of the field is known
+    bool m_hasKeyFrame = false; // For the DataSetWriter of m_currentWriterId
+    quint16 m_currentWriterId = 0; // DataSetWriter whose last values are in m_columns
+    QHash<quint16, QVariantList> m_writerLastValues; // Last values of the other DataSetWriters with a key frame
+    QVector<QOpcUaDataSetBatch> m_completedBatches; // Decoded with a previous layout of the DataSet
+
+    int m_messageCount = 0;
+    QVector<quint16> m_messageWriterIds;
+    QVector<quint16> m_messageSequenceNumbers;
+    QVector<qint64> m_messageTimestamps;
+    QVector<QOpcUa::UaStatusCode> m_messageStatusCodes;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAPUBSUBREADER_P_H
@@ -35,6 +35,7 @@
 ****************************************************************************/
 
 #include "qopcuareadresult.h"
+#include "qopcuareadresult_p.h"
 
 QT_BEGIN_NAMESPACE
 
@@ -54,18 +55,43 @@ QT_BEGIN_NAMESPACE
     signal and contain the result of a read operation that was part of a \l QOpcUaClient::readNodeAttributes()
     request.
 
+    The timestamps are kept in the OPC UA DateTime encoding and are only converted to QDateTime
+    when \l sourceTimestamp() or \l serverTimestamp() is called. Code which just forwards the
+    timestamps can use \l sourceTimestampRaw() and \l sourceTimestampMSecsSinceEpoch() and their
+    server timestamp counterparts to avoid the conversion.
+
+    The QDateTime objects are returned in UTC. As QDateTime only has millisecond resolution,
+    the sub-millisecond part of a timestamp is only available from \l sourceTimestampRaw() and
+    \l serverTimestampRaw(). A timestamp which is not set is stored as \c 0 and returned as
+    invalid QDateTime, setting an invalid QDateTime clears the timestamp.
+
+    Backends may also defer the conversion of the value until \l value() is called for the
+    first time. Results which are discarded after checking \l statusCode() or a timestamp
+    never pay for the conversion.
+
     \sa QOpcUaClient::readNodeAttributes() QOpcUaClient::readNodeAttributesFinished() QOpcUaReadItem
 */
+
+/*!
+    \variable QOpcUaReadResult::InvalidTimestamp
+    \since QtOpcUa 6.0
+
+    The value returned by \l sourceTimestampMSecsSinceEpoch() and \l serverTimestampMSecsSinceEpoch()
+    if the timestamp is not set.
+*/
+constexpr qint64 QOpcUaReadResult::InvalidTimestamp;
+
 class QOpcUaReadResultData : public QSharedData
 {
 public:
-    QDateTime serverTimestamp;
-    QDateTime sourceTimestamp;
+    qint64 serverTimestamp {0};
+    qint64 sourceTimestamp {0};
     QOpcUa::UaStatusCode statusCode {QOpcUa::UaStatusCode::Good};
     QString nodeId;
     QOpcUa::NodeAttribute attribute {QOpcUa::NodeAttribute::Value};
     QString indexRange;
     QVariant value;
+    QExplicitlySharedDataPointer<QOpcUaLazyValue> lazyValue; // Replaces value if set
 };
 
 QOpcUaReadResult::QOpcUaReadResult()
@@ -100,6 +126,8 @@ QOpcUaReadResult::~QOpcUaReadResult()
 */
 QVariant QOpcUaReadResult::value() const
 {
+    if (data->lazyValue)
+        return data->lazyValue->value();
     return data->value;
 }
 
@@ -108,6 +136,7 @@ QVariant QOpcUaReadResult::value() const
 */
 void QOpcUaReadResult::setValue(const QVariant &value)
 {
+    data->lazyValue.reset();
     data->value = value;
 }
 
@@ -177,35 +206,141 @@ void QOpcUaReadResult::setStatusCode(QOpcUa::UaStatusCode statusCode)
 }
 
 /*!
-    Returns the source timestamp for \l value().
+    Returns the source timestamp for \l value() in UTC or an invalid QDateTime if the timestamp is not set.
+    The QDateTime is created from the stored OPC UA timestamp on each call, the sub-millisecond part is truncated.
+
+    \sa sourceTimestampRaw()
 */
 QDateTime QOpcUaReadResult::sourceTimestamp() const
 {
-    return data->sourceTimestamp;
+    return QOpcUaRawTimestamp::toDateTime(data->sourceTimestamp);
 }
 
 /*!
     Sets the source timestamp to \a sourceTimestamp.
+    An invalid QDateTime clears the timestamp.
 */
 void QOpcUaReadResult::setSourceTimestamp(const QDateTime &sourceTimestamp)
+{
+    data->sourceTimestamp = QOpcUaRawTimestamp::fromDateTime(sourceTimestamp);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Returns the source timestamp for \l value() as OPC UA DateTime, the number of
+    100 nanosecond intervals since 1601-01-01T00:00:00 UTC. \c 0 means that the
+    timestamp is not set.
+*/
+qint64 QOpcUaReadResult::sourceTimestampRaw() const
+{
+    return data->sourceTimestamp;
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Sets the source timestamp to the OPC UA DateTime \a sourceTimestamp.
+*/
+void QOpcUaReadResult::setSourceTimestampRaw(qint64 sourceTimestamp)
 {
     data->sourceTimestamp = sourceTimestamp;
 }
 
 /*!
-    Returns the server timestamp for \l value().
+    \since QtOpcUa 6.0
+
+    Returns the source timestamp for \l value() in milliseconds since 1970-01-01T00:00:00 UTC
+    or \l InvalidTimestamp if the timestamp is not set.
+*/
+qint64 QOpcUaReadResult::sourceTimestampMSecsSinceEpoch() const
+{
+    return QOpcUaRawTimestamp::toMSecsSinceEpoch(data->sourceTimestamp);
+}
+
+/*!
+    Returns the server timestamp for \l value() in UTC or an invalid QDateTime if the timestamp is not set.
+    The QDateTime is created from the stored OPC UA timestamp on each call, the sub-millisecond part is truncated.
+
+    \sa serverTimestampRaw()
 */
 QDateTime QOpcUaReadResult::serverTimestamp() const
 {
-    return data->serverTimestamp;
+    return QOpcUaRawTimestamp::toDateTime(data->serverTimestamp);
 }
 
 /*!
     Sets the server timestamp to \a serverTimestamp.
+    An invalid QDateTime clears the timestamp.
 */
 void QOpcUaReadResult::setServerTimestamp(const QDateTime &serverTimestamp)
+{
+    data->serverTimestamp = QOpcUaRawTimestamp::fromDateTime(serverTimestamp);
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Returns the server timestamp for \l value() as OPC UA DateTime.
+    \c 0 means that the timestamp is not set.
+
+    \sa sourceTimestampRaw()
+*/
+qint64 QOpcUaReadResult::serverTimestampRaw() const
+{
+    return data->serverTimestamp;
+}
+
+/*!
+    \since QtOpcUa 6.0
+
+    Sets the server timestamp to the OPC UA DateTime \a serverTimestamp.
+*/
+void QOpcUaReadResult::setServerTimestampRaw(qint64 serverTimestamp)
 {
     data->serverTimestamp = serverTimestamp;
 }
 
+/*!
+    \since QtOpcUa 6.0
+
+    Returns the server timestamp for \l value() in milliseconds since 1970-01-01T00:00:00 UTC
+    or \l InvalidTimestamp if the timestamp is not set.
+*/
+qint64 QOpcUaReadResult::serverTimestampMSecsSinceEpoch() const
+{
+    return QOpcUaRawTimestamp::toMSecsSinceEpoch(data->serverTimestamp);
+}
+
+QOpcUaLazyValue::~QOpcUaLazyValue()
+{
+}
+
+/*!
+    \internal
+
+    Returns the converted value, the conversion is done by the first call.
+*/
+QVariant QOpcUaLazyValue::value()
+{
+    QMutexLocker locker(&m_mutex);
+    if (!m_decoded) {
+        m_value = decode();
+        m_decoded = true;
+    }
+    return m_value;
+}
+
+/*!
+    \internal
+
+    Sets the value of \a result to \a value, which is converted on the first access.
+    \a result takes shared ownership of \a value.
+*/
+void qt_setLazyValue(QOpcUaReadResult &result, QOpcUaLazyValue *value)
+{
+    result.data->value.clear();
+    result.data->lazyValue.reset(value);
+}
+
 QT_END_NAMESPACE
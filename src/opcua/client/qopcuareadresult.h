@@ -41,12 +41,17 @@
 
 #include <QtCore/qdatetime.h>
 
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
+class QOpcUaLazyValue;
 class QOpcUaReadResultData;
 class Q_OPCUA_EXPORT QOpcUaReadResult
 {
 public:
+    static constexpr qint64 InvalidTimestamp = (std::numeric_limits<qint64>::min)();
+
     QOpcUaReadResult();
     QOpcUaReadResult(const QOpcUaReadResult &other);
     QOpcUaReadResult &operator=(const QOpcUaReadResult &rhs);
@@ -54,9 +59,15 @@ public:
 
     QDateTime serverTimestamp() const;
     void setServerTimestamp(const QDateTime &serverTimestamp);
+    qint64 serverTimestampRaw() const;
+    void setServerTimestampRaw(qint64 serverTimestamp);
+    qint64 serverTimestampMSecsSinceEpoch() const;
 
     QDateTime sourceTimestamp() const;
     void setSourceTimestamp(const QDateTime &sourceTimestamp);
+    qint64 sourceTimestampRaw() const;
+    void setSourceTimestampRaw(qint64 sourceTimestamp);
+    qint64 sourceTimestampMSecsSinceEpoch() const;
 
     QOpcUa::UaStatusCode statusCode() const;
     void setStatusCode(QOpcUa::UaStatusCode statusCode);
@@ -75,6 +86,8 @@ public:
 
 private:
     QSharedDataPointer<QOpcUaReadResultData> data;
+
+    friend Q_OPCUA_EXPORT void qt_setLazyValue(QOpcUaReadResult &result, QOpcUaLazyValue *value);
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,116 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUAREADRESULT_P_H
+#define QOPCUAREADRESULT_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuareadresult.h>
+
+#include <QtCore/qdatetime.h>
+#include <QtCore/qmutex.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qvariant.h>
+
+QT_BEGIN_NAMESPACE
+
+// Conversions of OPC UA DateTime values (OPC UA part 6, 5.2.2.5), which count 100 nanosecond
+// intervals since 1601-01-01T00:00:00 UTC. The value 0 is used for timestamps which are not set.
+// QDateTime only has millisecond resolution, the sub-millisecond part is truncated and the
+// QDateTime is returned in UTC.
+namespace QOpcUaRawTimestamp {
+
+static constexpr qint64 TicksPerMSec = 10000;
+static constexpr qint64 UnixEpochMSecs = Q_INT64_C(11644473600000); // 1601-01-01 to 1970-01-01
+
+inline qint64 toMSecsSinceEpoch(qint64 raw)
+{
+    if (!raw)
+        return QOpcUaReadResult::InvalidTimestamp;
+    return raw / TicksPerMSec - UnixEpochMSecs;
+}
+
+inline QDateTime toDateTime(qint64 raw)
+{
+    if (!raw)
+        return QDateTime();
+    return QDateTime::fromMSecsSinceEpoch(toMSecsSinceEpoch(raw), Qt::UTC);
+}
+
+inline qint64 fromDateTime(const QDateTime &dateTime)
+{
+    if (!dateTime.isValid())
+        return 0;
+    return (dateTime.toMSecsSinceEpoch() + UnixEpochMSecs) * TicksPerMSec;
+}
+
+} // namespace QOpcUaRawTimestamp
+
+// Value in the representation of a backend which is converted to a QVariant when QOpcUaReadResult::value()
+// is called for the first time. All copies of a read result share the same instance, possibly from
+// different threads, so the conversion is serialized and its result is kept.
+class Q_OPCUA_EXPORT QOpcUaLazyValue : public QSharedData
+{
+public:
+    virtual ~QOpcUaLazyValue();
+
+    QVariant value();
+
+protected:
+    // Called at most once, the backend representation can be released afterwards
+    virtual QVariant decode() = 0;
+
+private:
+    QMutex m_mutex;
+    QVariant m_value;
+    bool m_decoded = false;
+};
+
+Q_OPCUA_EXPORT void qt_setLazyValue(QOpcUaReadResult &result, QOpcUaLazyValue *value);
+
+QT_END_NAMESPACE
+
+#endif // QOPCUAREADRESULT_P_H
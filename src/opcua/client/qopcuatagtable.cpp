@@ -0,0 +1,272 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopcuatagtable.h"
+#include "qopcuatagtable_p.h"
+#include "qopcuareadresult_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QOpcUaTagTable
+    \inmodule QtOpcUa
+    \since QtOpcUa 6.0
+    \brief QOpcUaTagTable stores the values of a large number of monitored nodes.
+
+    Monitoring a node using \l QOpcUaNode requires two QObjects per node, which is
+    too expensive for applications monitoring tens of thousands of values.
+    A tag table stores the node ids, the last values, the status codes and the timestamps
+    of its tags in one array per property. A tag is identified by the index returned
+    from \l addTag().
+
+    The table is monitored using \l QOpcUaClient::enableMonitoring(). The backend writes
+    data changes directly into the table, the application can poll the values at any time.
+    \l QOpcUaClient::tagsChanged() is emitted once when the first tag changes after the
+    last call to \l takeChangedTags().
+
+    \code
+    QOpcUaTagTable table;
+    for (const QString &nodeId : nodeIds)
+        table.addTag(nodeId);
+
+    QObject::connect(client, &QOpcUaClient::tagsChanged, [](QOpcUaTagTable table) {
+        const QVector<int> changed = table.takeChangedTags();
+        for (int tag : changed)
+            qDebug() << table.nodeId(tag) << table.value(tag);
+    });
+
+    client->enableMonitoring(table, QOpcUaMonitoringParameters(100));
+    \endcode
+
+    Copies of a tag table refer to the same table. All functions are thread-safe.
+    Only the value attribute of the tags is monitored, tags added after monitoring
+    has been enabled are not monitored.
+
+    \sa QOpcUaClient::enableMonitoring() QOpcUaClient::tagsChanged()
+*/
+
+/*!
+    Constructs an empty tag table.
+*/
+QOpcUaTagTable::QOpcUaTagTable()
+    : d_ptr(new QOpcUaTagTablePrivate)
+{
+}
+
+/*!
+    Constructs a tag table which refers to the same table as \a other.
+*/
+QOpcUaTagTable::QOpcUaTagTable(const QOpcUaTagTable &other)
+    : d_ptr(other.d_ptr)
+{
+}
+
+/*!
+    Makes this object refer to the same table as \a rhs.
+*/
+QOpcUaTagTable &QOpcUaTagTable::operator=(const QOpcUaTagTable &rhs)
+{
+    d_ptr = rhs.d_ptr;
+    return *this;
+}
+
+/*!
+    Returns \c true if this object and \a rhs refer to the same table.
+*/
+bool QOpcUaTagTable::operator==(const QOpcUaTagTable &rhs) const
+{
+    return d_ptr == rhs.d_ptr;
+}
+
+QOpcUaTagTable::~QOpcUaTagTable()
+{
+}
+
+/*!
+    Adds a tag for the node \a nodeId and returns its index.
+
+    The status code of the new tag is \l {QOpcUa::UaStatusCode} {BadWaitingForInitialData}
+    until the first value has been received.
+*/
+int QOpcUaTagTable::addTag(const QString &nodeId)
+{
+    QMutexLocker locker(&d_ptr->mutex);
+    d_ptr->nodeIds.append(nodeId);
+    d_ptr->values.append(QOpcUaReadResult());
+    d_ptr->statusCodes.append(QOpcUa::UaStatusCode::BadWaitingForInitialData);
+    d_ptr->sourceTimestamps.append(0);
+    d_ptr->serverTimestamps.append(0);
+    d_ptr->changed.append(false);
+    return d_ptr->nodeIds.size() - 1;
+}
+
+/*!
+    Reserves space for \a size tags.
+*/
+void QOpcUaTagTable::reserve(int size)
+{
+    QMutexLocker locker(&d_ptr->mutex);
+    d_ptr->nodeIds.reserve(size);
+    d_ptr->values.reserve(size);
+    d_ptr->statusCodes.reserve(size);
+    d_ptr->sourceTimestamps.reserve(size);
+    d_ptr->serverTimestamps.reserve(size);
+    d_ptr->changed.reserve(size);
+}
+
+/*!
+    Returns the number of tags in the table.
+*/
+int QOpcUaTagTable::size() const
+{
+    QMutexLocker locker(&d_ptr->mutex);
+    return d_ptr->nodeIds.size();
+}
+
+/*!
+    Returns the node id of \a tag.
+*/
+QString QOpcUaTagTable::nodeId(int tag) const
+{
+    QMutexLocker locker(&d_ptr->mutex);
+    return d_ptr->nodeIds.value(tag);
+}
+
+/*!
+    Returns the last value received for \a tag.
+    Backends may store the value in their own representation, it is converted by the first call.
+*/
+QVariant QOpcUaTagTable::value(int tag) const
+{
+    QMutexLocker locker(&d_ptr->mutex);
+    return d_ptr->values.value(tag).value();
+}
+
+/*!
+    Returns the status code of \a tag.
+
+    If the monitored item for the tag could not be created or has been removed,
+    the status code of the operation is returned.
+*/
+QOpcUa::UaStatusCode QOpcUaTagTable::statusCode(int tag) const
+{
+    QMutexLocker locker(&d_ptr->mutex);
+    return d_ptr->statusCodes.value(tag, QOpcUa::UaStatusCode::BadNoEntryExists);
+}
+
+/*!
+    Returns the source timestamp of the last value received for \a tag in UTC.
+*/
+QDateTime QOpcUaTagTable::sourceTimestamp(int tag) const
+{
+    QMutexLocker locker(&d_ptr->mutex);
+    return QOpcUaRawTimestamp::toDateTime(d_ptr->sourceTimestamps.value(tag));
+}
+
+/*!
+    Returns the server timestamp of the last value received for \a tag in UTC.
+*/
+QDateTime QOpcUaTagTable::serverTimestamp(int tag) const
+{
+    QMutexLocker locker(&d_ptr->mutex);
+    return QOpcUaRawTimestamp::toDateTime(d_ptr->serverTimestamps.value(tag));
+}
+
+/*!
+    Returns the indices of the tags which have changed since the last call of this function
+    and resets the changed state. Each tag is contained at most once.
+*/
+QVector<int> QOpcUaTagTable::takeChangedTags()
+{
+    QMutexLocker locker(&d_ptr->mutex);
+    for (int tag : qAsConst(d_ptr->changedTags))
+        d_ptr->changed[tag] = false;
+    d_ptr->notificationPending = false;
+    QVector<int> result;
+    result.swap(d_ptr->changedTags);
+    return result;
+}
+
+/*!
+    \internal
+
+    Stores \a result as new value of \a tag.
+    Returns \c true if the client has to be notified about the change.
+*/
+bool QOpcUaTagTablePrivate::update(int tag, const QOpcUaReadResult &result)
+{
+    QMutexLocker locker(&mutex);
+    if (tag < 0 || tag >= nodeIds.size())
+        return false;
+
+    values[tag] = result;
+    statusCodes[tag] = result.statusCode();
+    sourceTimestamps[tag] = result.sourceTimestampRaw();
+    serverTimestamps[tag] = result.serverTimestampRaw();
+    return markChanged(tag);
+}
+
+/*!
+    \internal
+
+    Sets the status code of \a tag to \a statusCode, for example if the monitored item could not be created.
+    Returns \c true if the client has to be notified about the change.
+*/
+bool QOpcUaTagTablePrivate::setStatusCode(int tag, QOpcUa::UaStatusCode statusCode)
+{
+    QMutexLocker locker(&mutex);
+    if (tag < 0 || tag >= nodeIds.size())
+        return false;
+
+    statusCodes[tag] = statusCode;
+    return markChanged(tag);
+}
+
+bool QOpcUaTagTablePrivate::markChanged(int tag)
+{
+    if (!changed.at(tag)) {
+        changed[tag] = true;
+        changedTags.append(tag);
+    }
+
+    if (notificationPending)
+        return false;
+
+    notificationPending = true;
+    return true;
+}
+
+QT_END_NAMESPACE
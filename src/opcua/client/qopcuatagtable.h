@@ -0,0 +1,79 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUATAGTABLE_H
+#define QOPCUATAGTABLE_H
+
+#include <QtOpcUa/qopcuatype.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qsharedpointer.h>
+#include <QtCore/qvariant.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpcUaTagTablePrivate;
+class Q_OPCUA_EXPORT QOpcUaTagTable
+{
+public:
+    QOpcUaTagTable();
+    QOpcUaTagTable(const QOpcUaTagTable &other);
+    QOpcUaTagTable &operator=(const QOpcUaTagTable &rhs);
+    bool operator==(const QOpcUaTagTable &rhs) const;
+    ~QOpcUaTagTable();
+
+    int addTag(const QString &nodeId);
+    void reserve(int size);
+    int size() const;
+
+    QString nodeId(int tag) const;
+    QVariant value(int tag) const;
+    QOpcUa::UaStatusCode statusCode(int tag) const;
+    QDateTime sourceTimestamp(int tag) const;
+    QDateTime serverTimestamp(int tag) const;
+
+    QVector<int> takeChangedTags();
+
+private:
+    QSharedPointer<QOpcUaTagTablePrivate> d_ptr;
+    friend class QOpcUaTagTablePrivate;
+};
+
+QT_END_NAMESPACE
+
+Q_DECLARE_METATYPE(QOpcUaTagTable)
+
+#endif // QOPCUATAGTABLE_H
@@ -0,0 +1,94 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPCUATAGTABLE_P_H
+#define QOPCUATAGTABLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <QtOpcUa/qopcuareadresult.h>
+#include <QtOpcUa/qopcuatagtable.h>
+
+#include <QtCore/qmutex.h>
+
+QT_BEGIN_NAMESPACE
+
+class Q_OPCUA_EXPORT QOpcUaTagTablePrivate
+{
+public:
+    // Handles of tags have the highest bit set, the table id in the upper and the tag index in the lower half
+    static constexpr quint64 TagHandleFlag = Q_UINT64_C(0x8000000000000000);
+
+    static bool isTagHandle(quint64 handle) { return handle & TagHandleFlag; }
+    static quint64 tagHandle(quint32 tableId, int tag) { return TagHandleFlag | (quint64(tableId) << 32) | quint32(tag); }
+    static quint32 tableId(quint64 handle) { return quint32((handle & ~TagHandleFlag) >> 32); }
+    static int tagIndex(quint64 handle) { return int(quint32(handle)); }
+
+    static QOpcUaTagTablePrivate *get(const QOpcUaTagTable &table) { return table.d_ptr.data(); }
+
+    bool update(int tag, const QOpcUaReadResult &result);
+    bool setStatusCode(int tag, QOpcUa::UaStatusCode statusCode);
+
+    mutable QMutex mutex;
+    quint32 id = 0; // Assigned by the client when the table is monitored for the first time
+
+    // One entry per tag
+    QVector<QString> nodeIds;
+    QVector<QOpcUaReadResult> values; // Lazy values are converted by value()
+    QVector<QOpcUa::UaStatusCode> statusCodes;
+    QVector<qint64> sourceTimestamps; // OPC UA DateTime, converted on access
+    QVector<qint64> serverTimestamps;
+    QVector<bool> changed;
+
+    QVector<int> changedTags;
+    bool notificationPending = false;
+
+private:
+    bool markChanged(int tag);
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPCUATAGTABLE_P_H
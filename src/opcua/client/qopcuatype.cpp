@@ -35,9 +35,9 @@
 ****************************************************************************/
 
 #include "qopcuatype.h"
+#include "qopcuatype_p.h"
 
 #include <QMetaEnum>
-#include <QRegularExpression>
 #include <QUuid>
 
 QT_BEGIN_NAMESPACE
@@ -665,33 +665,60 @@ QString QOpcUa::nodeIdFromReferenceType(QOpcUa::ReferenceTypeId referenceType)
 */
 bool QOpcUa::nodeIdStringSplit(const QString &nodeIdString, quint16 *nsIndex, QString *identifier, char *identifierType)
 {
-    quint16 namespaceIndex = 0;
+    QStringView identifierView;
+    if (!qt_splitNodeIdString(nodeIdString, nsIndex, &identifierView, identifierType))
+        return false;
 
-    QStringList components = nodeIdString.split(QLatin1String(";"));
+    if (identifier)
+        *identifier = identifierView.toString();
 
-    if (components.size() > 2)
-        return false;
+    return true;
+}
 
-    if (components.size() == 2 && components.at(0).contains(QRegularExpression(QLatin1String("^ns=[0-9]+")))) {
-        bool success = false;
-        uint ns = QStringView(components.at(0)).mid(3).toUInt(&success);
-        if (!success || ns > (std::numeric_limits<quint16>::max)())
+/*!
+    \internal
+
+    Allocation free variant of QOpcUa::nodeIdStringSplit().
+    \a identifier references the identifier part of \a nodeIdString and is only valid
+    as long as the data of \a nodeIdString is valid.
+*/
+bool qt_splitNodeIdString(QStringView nodeIdString, quint16 *nsIndex, QStringView *identifier, char *identifierType)
+{
+    quint16 namespaceIndex = 0;
+    QStringView identifierPart = nodeIdString;
+
+    const qsizetype separator = nodeIdString.indexOf(QLatin1Char(';'));
+    if (separator != -1) {
+        if (nodeIdString.indexOf(QLatin1Char(';'), separator + 1) != -1)
             return false;
-        namespaceIndex = ns;
+
+        const QStringView namespacePart = nodeIdString.left(separator);
+        identifierPart = nodeIdString.mid(separator + 1);
+
+        // A first component which is not a namespace index is ignored
+        if (namespacePart.size() > 3 && namespacePart.startsWith(QLatin1String("ns=")) &&
+                namespacePart.at(3) >= QLatin1Char('0') && namespacePart.at(3) <= QLatin1Char('9')) {
+            bool success = false;
+            uint ns = namespacePart.mid(3).toUInt(&success);
+            if (!success || ns > (std::numeric_limits<quint16>::max)())
+                return false;
+            namespaceIndex = ns;
+        }
     }
 
-    if (components.last().size() < 3)
+    if (identifierPart.size() < 3)
         return false;
 
-    if (!components.last().contains(QRegularExpression(QLatin1String("^[isgb]="))))
+    const char type = identifierPart.at(0).toLatin1();
+    if (identifierPart.at(1) != QLatin1Char('=') || (type != 'i' && type != 's' && type != 'g' && type != 'b'))
         return false;
 
     if (nsIndex)
         *nsIndex = namespaceIndex;
     if (identifier)
-        *identifier = QStringView(components.last()).mid(2).toString();
+        *identifier = identifierPart.mid(2);
     if (identifierType)
-        *identifierType = components.last().at(0).toLatin1();
+        *identifierType = type;
 
     return true;
 }
@@ -55,6 +55,12 @@
 #include <QtOpcUa/qopcuaexpandednodeid.h>
 #include <QtOpcUa/qopcuarelativepathelement.h>
 #include <QtOpcUa/qopcuabrowsepathtarget.h>
+#include <QtOpcUa/qopcuamonitoringitem.h>
+#include <QtOpcUa/qopcuatagtable.h>
+#include <QtOpcUa/qopcuahistorydata.h>
+#include <QtOpcUa/qopcuahistoryreadrequest.h>
+#include <QtOpcUa/qopcuaeventbatch.h>
+#include <QtOpcUa/qopcuadatasetbatch.h>
 
 #include <private/qfactoryloader_p.h>
 #include <QtCore/qjsonarray.h>
@@ -177,10 +183,20 @@ QOpcUaProvider::QOpcUaProvider(QObject *parent)
     qRegisterMetaType<QOpcUaReadResult>();
     qRegisterMetaType<QVector<QOpcUaReadItem>>();
     qRegisterMetaType<QVector<QOpcUaReadResult>>();
+    qRegisterMetaType<QVector<QPair<quint64, QOpcUaReadResult>>>();
     qRegisterMetaType<QOpcUaWriteItem>();
     qRegisterMetaType<QOpcUaWriteResult>();
     qRegisterMetaType<QVector<QOpcUaWriteItem>>();
     qRegisterMetaType<QVector<QOpcUaWriteResult>>();
+    qRegisterMetaType<QOpcUaMonitoringItem>();
+    qRegisterMetaType<QVector<QOpcUaMonitoringItem>>();
+    qRegisterMetaType<QOpcUaTagTable>();
+    qRegisterMetaType<QOpcUaHistoryReadRequest>();
+    qRegisterMetaType<QOpcUaHistoryData>();
+    qRegisterMetaType<QVector<QOpcUaHistoryData>>();
+    qRegisterMetaType<QOpcUaEventBatch>();
+    qRegisterMetaType<QOpcUaDataSetBatch>();
+    qRegisterMetaType<QVector<quint64>>();
     qRegisterMetaType<QOpcUaNodeCreationAttributes>();
     qRegisterMetaType<QOpcUaAddNodeItem>();
     qRegisterMetaType<QOpcUaAddReferenceItem>();
@@ -234,6 +250,83 @@ static QOpcUaPlugin *loadPlugin(const QString &key)
         \li Unified Automation
         \li Tells the backend to print additional output to the terminal. The backend specific logging
             level is set to \c OPCUA_TRACE_OUTPUT_LEVEL_ALL.
+    \row
+        \li addressSpaceCacheDirectory
+        \li open62541
+        \li Enables a persistent cache for browse results and attributes which usually don't change,
+            like DisplayName, DataType or AccessLevel. QOpcUaNode::browse() and QOpcUaNode::readAttributes()
+            are answered from the cache if it contains all requested information. There is one file
+            per server application URI in the given directory, its content is discarded if the namespace
+            array of the server has changed. Model change events of the server and changes made by the client
+            remove the affected entries. The Value attribute and user specific attributes are never cached.
+    \row
+        \li crawlRequestsInFlight
+        \li open62541
+        \li The number of browse requests QOpcUaClient::crawl() keeps in flight at the same time.
+            The default value is 4, 0 removes the limit.
+    \row
+        \li disableDataChangeBatching
+        \li open62541
+        \li By default, the backend hands all data change notifications received in one publish
+            cycle over to the client thread at once. This parameter makes the backend deliver
+            each data change notification separately as it was done in previous versions.
+    \row
+        \li maxNodesPerRead
+        \li open62541
+        \li Replaces the MaxNodesPerRead operation limit of the server, for servers which enforce
+            a limit without exposing it. QOpcUaClient::readNodeAttributes() splits larger requests
+            into chunks of this size. The default value 0 uses the limit reported by the server.
+    \row
+        \li maxNodesPerWrite
+        \li open62541
+        \li Replaces the MaxNodesPerWrite operation limit of the server, see maxNodesPerRead.
+    \row
+        \li maxRequestsInFlight
+        \li open62541
+        \li The backend sends read, write, browse, method call and browse path requests without
+            waiting for the responses of previous requests. This parameter limits the number of requests
+            waiting for a response, additional requests are sent as soon as a response arrives.
+            The default value is 32, 0 removes the limit.
+    \row
+        \li nodeIdCacheSize
+        \li open62541
+        \li The maximum number of parsed node ids the backend keeps for node id strings
+            which are used repeatedly, for example in QOpcUaClient::readNodeAttributes().
+            Cached node ids don't have to be parsed again. The cache is disabled by default.
+    \row
+        \li requestCoalescingInterval
+        \li open62541
+        \li Enables coalescing of the reads and writes issued by QOpcUaNode. Requests for different nodes
+            arriving within this interval in microseconds are combined into a single Read or Write request,
+            the results are delivered to each node as usual. The interval is rounded up to full milliseconds,
+            0 combines the requests which are already waiting to be processed by the backend.
+            Coalescing is disabled by default.
+    \row
+        \li reconnectInterval
+        \li open62541
+        \li If the connection to the server is lost, the backend tries to reconnect every reconnectInterval
+            milliseconds until it succeeds or disconnectFromEndpoint() is called. Subscriptions and monitored
+            items are created again for the new session and QOpcUaClient::connectionRecovered() is emitted
+            instead of QOpcUaClient::connected().
+            Automatic reconnects are disabled by default.
+    \row
+        \li requestCoalescingMaxItems
+        \li open62541
+        \li The maximum number of attributes in a coalesced request, a full request is sent immediately.
+            The server's MaxNodesPerRead and MaxNodesPerWrite limits are respected as well.
+            The default value is 1000, 0 only applies the server limits.
+    \row
+        \li typedArrays
+        \li open62541
+        \li One-dimensional arrays of numeric types are returned as typed vectors like QVector<double>
+            or QVector<qint32> instead of a QVariantList. This avoids converting each element of large
+            arrays to a QVariant. Typed vectors are accepted for writes regardless of this parameter.
+    \row
+        \li zeroCopyExtensionObjects
+        \li open62541
+        \li The encoded bodies of extension objects which are not decoded by the backend are handed over
+            to QOpcUaExtensionObject without copying them. Decoding them with QOpcUaBinaryDataEncoding
+            or accessing them using QOpcUaExtensionObject::encodedBodyRef() doesn't copy them either.
     \endtable
 */
 QOpcUaClient *QOpcUaProvider::createClient(const QString &backend, const QVariantMap &backendProperties)
@@ -14,8 +14,11 @@ qtConfig(open62541):!qtConfig(system-open62541) {
 }
 
 HEADERS += \
+    qopen62541addressspacecache.h \
     qopen62541backend.h \
     qopen62541client.h \
+    qopen62541commandqueue.h \
+    qopen62541eventfilter.h \
     qopen62541node.h \
     qopen62541plugin.h \
     qopen62541subscription.h \
@@ -24,8 +27,10 @@ HEADERS += \
     qopen62541utils.h
 
 SOURCES += \
+    qopen62541addressspacecache.cpp \
     qopen62541backend.cpp \
     qopen62541client.cpp \
+    qopen62541eventfilter.cpp \
     qopen62541node.cpp \
     qopen62541plugin.cpp \
     qopen62541subscription.cpp \
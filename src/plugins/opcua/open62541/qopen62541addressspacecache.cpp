@@ -0,0 +1,531 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopen62541addressspacecache.h"
+
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <private/qopcuabackend_p.h>
+
+#include <QtCore/qcryptographichash.h>
+#include <QtCore/qdir.h>
+#include <QtCore/qloggingcategory.h>
+#include <QtCore/qsavefile.h>
+
+#include <algorithm>
+
+QT_BEGIN_NAMESPACE
+
+Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
+
+/*
+    File layout, encoded with the OPC UA binary encoding:
+
+    UInt32 magic, UInt32 version
+    String applicationUri, String[] namespaceArray
+    Int32 node count, for each node:
+        String nodeId, Int32 entry count, for each entry:
+            String key, ByteString entry
+
+    Attribute entries are keyed by the attribute and contain a type tag and the value,
+    browse entries are keyed by the browse parameters and contain the reference descriptions.
+*/
+static const quint32 cacheFileMagic = 0x43415551; // "QUAC"
+static const quint32 cacheFileVersion = 1;
+
+// Attributes which are not expected to change while the address space stays the same.
+// Value and the user specific attributes are always read from the server.
+static const QOpcUa::NodeAttributes cacheableAttributes = QOpcUa::NodeAttribute::NodeId | QOpcUa::NodeAttribute::NodeClass
+        | QOpcUa::NodeAttribute::BrowseName | QOpcUa::NodeAttribute::DisplayName | QOpcUa::NodeAttribute::Description
+        | QOpcUa::NodeAttribute::WriteMask | QOpcUa::NodeAttribute::IsAbstract | QOpcUa::NodeAttribute::Symmetric
+        | QOpcUa::NodeAttribute::InverseName | QOpcUa::NodeAttribute::ContainsNoLoops | QOpcUa::NodeAttribute::EventNotifier
+        | QOpcUa::NodeAttribute::DataType | QOpcUa::NodeAttribute::ValueRank | QOpcUa::NodeAttribute::ArrayDimensions
+        | QOpcUa::NodeAttribute::AccessLevel | QOpcUa::NodeAttribute::MinimumSamplingInterval
+        | QOpcUa::NodeAttribute::Historizing | QOpcUa::NodeAttribute::Executable;
+
+enum class CachedValueType : quint8 {
+    Bool,
+    Int32,
+    UInt32,
+    Byte,
+    Double,
+    String,
+    QualifiedName,
+    LocalizedText,
+    List,
+    UInt32Vector
+};
+
+static QString attributeKey(QOpcUa::NodeAttribute attribute)
+{
+    return QStringLiteral("a%1").arg(static_cast<int>(attribute));
+}
+
+static bool encodeValue(QOpcUaBinaryDataEncoding &encoder, const QVariant &value)
+{
+    const int type = value.userType();
+
+    if (type == QMetaType::Bool)
+        return encoder.encode<quint8>(quint8(CachedValueType::Bool)) && encoder.encode<bool>(value.toBool());
+    if (type == QMetaType::Int)
+        return encoder.encode<quint8>(quint8(CachedValueType::Int32)) && encoder.encode<qint32>(value.toInt());
+    if (type == QMetaType::UInt)
+        return encoder.encode<quint8>(quint8(CachedValueType::UInt32)) && encoder.encode<quint32>(value.toUInt());
+    if (type == QMetaType::UChar)
+        return encoder.encode<quint8>(quint8(CachedValueType::Byte)) && encoder.encode<quint8>(value.value<quint8>());
+    if (type == QMetaType::Double)
+        return encoder.encode<quint8>(quint8(CachedValueType::Double)) && encoder.encode<double>(value.toDouble());
+    if (type == QMetaType::QString)
+        return encoder.encode<quint8>(quint8(CachedValueType::String)) && encoder.encode<QString>(value.toString());
+    if (type == qMetaTypeId<QOpcUaQualifiedName>()) {
+        return encoder.encode<quint8>(quint8(CachedValueType::QualifiedName))
+                && encoder.encode<QOpcUaQualifiedName>(value.value<QOpcUaQualifiedName>());
+    }
+    if (type == qMetaTypeId<QOpcUaLocalizedText>()) {
+        return encoder.encode<quint8>(quint8(CachedValueType::LocalizedText))
+                && encoder.encode<QOpcUaLocalizedText>(value.value<QOpcUaLocalizedText>());
+    }
+    if (type == qMetaTypeId<QVector<quint32>>()) {
+        return encoder.encode<quint8>(quint8(CachedValueType::UInt32Vector))
+                && encoder.encodeArray<quint32>(value.value<QVector<quint32>>());
+    }
+    if (type == QMetaType::QVariantList) {
+        const QVariantList list = value.toList();
+        if (!encoder.encode<quint8>(quint8(CachedValueType::List)) || !encoder.encode<qint32>(list.size()))
+            return false;
+        for (const auto &element : list) {
+            if (!encodeValue(encoder, element))
+                return false;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+static QVariant decodeValue(QOpcUaBinaryDataEncoding &decoder, bool &success)
+{
+    const auto type = static_cast<CachedValueType>(decoder.decode<quint8>(success));
+    if (!success)
+        return QVariant();
+
+    switch (type) {
+    case CachedValueType::Bool:
+        return decoder.decode<bool>(success);
+    case CachedValueType::Int32:
+        return decoder.decode<qint32>(success);
+    case CachedValueType::UInt32:
+        return decoder.decode<quint32>(success);
+    case CachedValueType::Byte:
+        return QVariant::fromValue(decoder.decode<quint8>(success));
+    case CachedValueType::Double:
+        return decoder.decode<double>(success);
+    case CachedValueType::String:
+        return decoder.decode<QString>(success);
+    case CachedValueType::QualifiedName:
+        return QVariant::fromValue(decoder.decode<QOpcUaQualifiedName>(success));
+    case CachedValueType::LocalizedText:
+        return QVariant::fromValue(decoder.decode<QOpcUaLocalizedText>(success));
+    case CachedValueType::UInt32Vector:
+        return QVariant::fromValue(decoder.decodeArray<quint32>(success));
+    case CachedValueType::List: {
+        const qint32 size = decoder.decode<qint32>(success);
+        QVariantList list;
+        for (qint32 i = 0; success && i < size; ++i)
+            list.append(decodeValue(decoder, success));
+        return list;
+    }
+    }
+
+    success = false;
+    return QVariant();
+}
+
+static bool encodeExpandedNodeId(QOpcUaBinaryDataEncoding &encoder, const QOpcUaExpandedNodeId &id)
+{
+    return encoder.encode<QString>(id.nodeId()) && encoder.encode<QString>(id.namespaceUri())
+            && encoder.encode<quint32>(id.serverIndex());
+}
+
+static QOpcUaExpandedNodeId decodeExpandedNodeId(QOpcUaBinaryDataEncoding &decoder, bool &success)
+{
+    const QString nodeId = decoder.decode<QString>(success);
+    const QString namespaceUri = decoder.decode<QString>(success);
+    const quint32 serverIndex = decoder.decode<quint32>(success);
+    return QOpcUaExpandedNodeId(namespaceUri, nodeId, serverIndex);
+}
+
+Open62541AddressSpaceCache::Open62541AddressSpaceCache()
+    : m_open(false)
+    , m_modified(false)
+    , m_map(nullptr)
+{
+}
+
+Open62541AddressSpaceCache::~Open62541AddressSpaceCache()
+{
+    close();
+}
+
+QString Open62541AddressSpaceCache::directory() const
+{
+    return m_directory;
+}
+
+void Open62541AddressSpaceCache::setDirectory(const QString &directory)
+{
+    close();
+    m_directory = directory;
+}
+
+bool Open62541AddressSpaceCache::isOpen() const
+{
+    return m_open;
+}
+
+/*
+    Opens the cache file of the server with \a applicationUri. The entries are discarded
+    if the server's namespace array is not the same as when they were stored.
+    Opening the cache for the same server again only checks the namespace array.
+*/
+void Open62541AddressSpaceCache::open(const QString &applicationUri, const QStringList &namespaceArray)
+{
+    if (m_directory.isEmpty())
+        return;
+
+    if (m_open && applicationUri == m_applicationUri) {
+        if (namespaceArray != m_namespaceArray) {
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "The namespace array has changed, clearing the address space cache";
+            clear();
+            m_namespaceArray = namespaceArray;
+        }
+        return;
+    }
+
+    close();
+
+    m_applicationUri = applicationUri;
+    m_namespaceArray = namespaceArray;
+    m_open = true;
+
+    const QByteArray hash = QCryptographicHash::hash(applicationUri.toUtf8(), QCryptographicHash::Sha1).toHex();
+    m_file.setFileName(QDir(m_directory).filePath(QString::fromLatin1(hash) + QLatin1String(".cache")));
+
+    if (!load()) {
+        // An outdated or damaged file is replaced when the cache is closed
+        m_entries.clear();
+        unmap();
+        m_modified = m_file.exists();
+    }
+
+    qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Opened the address space cache" << m_file.fileName()
+                                        << "with entries for" << m_entries.size() << "nodes";
+}
+
+void Open62541AddressSpaceCache::close()
+{
+    if (!m_open)
+        return;
+
+    if (m_modified && !save())
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to write the address space cache" << m_file.fileName();
+
+    m_entries.clear();
+    unmap();
+    m_open = false;
+    m_modified = false;
+}
+
+bool Open62541AddressSpaceCache::isCacheable(QOpcUa::NodeAttributes attributes)
+{
+    return !!attributes && !(attributes & ~cacheableAttributes);
+}
+
+bool Open62541AddressSpaceCache::readAttributes(const QString &nodeId, QOpcUa::NodeAttributes attributes,
+                                                QVector<QOpcUaReadResult> *results) const
+{
+    const auto node = m_entries.constFind(nodeId);
+    if (node == m_entries.constEnd())
+        return false;
+
+    bool success = true;
+    QVector<QOpcUaReadResult> cached;
+
+    qt_forEachAttribute(attributes, [&](QOpcUa::NodeAttribute attribute) {
+        if (!success)
+            return;
+
+        auto entry = node->value(attributeKey(attribute));
+        if (entry.isNull()) {
+            success = false;
+            return;
+        }
+
+        QOpcUaBinaryDataEncoding decoder(&entry);
+        QOpcUaReadResult result;
+        result.setAttribute(attribute);
+        result.setValue(decodeValue(decoder, success));
+        result.setStatusCode(QOpcUa::UaStatusCode::Good);
+        cached.push_back(result);
+    });
+
+    if (!success)
+        return false;
+
+    *results = cached;
+    return true;
+}
+
+void Open62541AddressSpaceCache::insertAttribute(const QString &nodeId, QOpcUa::NodeAttribute attribute, const QVariant &value)
+{
+    if (!m_open || !isCacheable(attribute))
+        return;
+
+    QByteArray entry;
+    QOpcUaBinaryDataEncoding encoder(&entry);
+    if (!encodeValue(encoder, value))
+        return; // Attributes with unexpected types are always read from the server
+
+    m_entries[nodeId].insert(attributeKey(attribute), entry);
+    m_modified = true;
+}
+
+QString Open62541AddressSpaceCache::browseKey(const QOpcUaBrowseRequest &request)
+{
+    return QStringLiteral("b%1;%2;%3;%4").arg(static_cast<int>(request.browseDirection()))
+            .arg(request.referenceTypeId()).arg(request.includeSubtypes())
+            .arg(static_cast<quint32>(request.nodeClassMask()));
+}
+
+bool Open62541AddressSpaceCache::references(const QString &nodeId, const QString &browseKey,
+                                            QVector<QOpcUaReferenceDescription> *references) const
+{
+    const auto node = m_entries.constFind(nodeId);
+    if (node == m_entries.constEnd())
+        return false;
+
+    auto entry = node->value(browseKey);
+    if (entry.isNull())
+        return false;
+
+    QOpcUaBinaryDataEncoding decoder(&entry);
+    bool success = true;
+    const qint32 size = decoder.decode<qint32>(success);
+
+    QVector<QOpcUaReferenceDescription> cached;
+    cached.reserve(success ? qBound(0, size, 1024) : 0);
+
+    for (qint32 i = 0; success && i < size; ++i) {
+        QOpcUaReferenceDescription reference;
+        reference.setTargetNodeId(decodeExpandedNodeId(decoder, success));
+        reference.setTypeDefinition(decodeExpandedNodeId(decoder, success));
+        reference.setRefTypeId(decoder.decode<QString>(success));
+        reference.setNodeClass(static_cast<QOpcUa::NodeClass>(decoder.decode<quint32>(success)));
+        reference.setBrowseName(decoder.decode<QOpcUaQualifiedName>(success));
+        reference.setDisplayName(decoder.decode<QOpcUaLocalizedText>(success));
+        reference.setIsForwardReference(decoder.decode<bool>(success));
+        cached.push_back(reference);
+    }
+
+    if (!success)
+        return false;
+
+    *references = cached;
+    return true;
+}
+
+void Open62541AddressSpaceCache::insertReferences(const QString &nodeId, const QString &browseKey,
+                                                  const QVector<QOpcUaReferenceDescription> &references)
+{
+    if (!m_open)
+        return;
+
+    QByteArray entry;
+    QOpcUaBinaryDataEncoding encoder(&entry);
+    bool success = encoder.encode<qint32>(references.size());
+
+    for (const auto &reference : references) {
+        success = success
+                && encodeExpandedNodeId(encoder, reference.targetNodeId())
+                && encodeExpandedNodeId(encoder, reference.typeDefinition())
+                && encoder.encode<QString>(reference.refTypeId())
+                && encoder.encode<quint32>(static_cast<quint32>(reference.nodeClass()))
+                && encoder.encode<QOpcUaQualifiedName>(reference.browseName())
+                && encoder.encode<QOpcUaLocalizedText>(reference.displayName())
+                && encoder.encode<bool>(reference.isForwardReference());
+    }
+
+    if (!success)
+        return;
+
+    m_entries[nodeId].insert(browseKey, entry);
+    m_modified = true;
+}
+
+void Open62541AddressSpaceCache::invalidate(const QString &nodeId)
+{
+    if (m_entries.remove(nodeId))
+        m_modified = true;
+}
+
+void Open62541AddressSpaceCache::clear()
+{
+    if (!m_entries.isEmpty())
+        m_modified = true;
+    m_entries.clear();
+}
+
+/*
+    Builds the index of the entries in the cache file. The entries themselves are not copied,
+    they point into the mapped file until they are requested.
+*/
+bool Open62541AddressSpaceCache::load()
+{
+    if (!m_file.exists())
+        return false;
+
+    if (!m_file.open(QIODevice::ReadOnly) || m_file.size() > std::numeric_limits<int>::max()) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to open the address space cache" << m_file.fileName();
+        return false;
+    }
+
+    m_map = m_file.map(0, m_file.size());
+    if (!m_map) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to map the address space cache" << m_file.fileName();
+        return false;
+    }
+
+    QByteArray data = QByteArray::fromRawData(reinterpret_cast<const char *>(m_map), static_cast<int>(m_file.size()));
+    QOpcUaBinaryDataEncoding decoder(&data);
+
+    bool success = true;
+    const quint32 magic = decoder.decode<quint32>(success);
+    const quint32 version = decoder.decode<quint32>(success);
+    if (!success || magic != cacheFileMagic || version != cacheFileVersion) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Ignoring invalid address space cache" << m_file.fileName();
+        return false;
+    }
+
+    const QString applicationUri = decoder.decode<QString>(success);
+    const QVector<QString> namespaceArray = decoder.decodeArray<QString>(success);
+    if (!success || applicationUri != m_applicationUri
+            || !std::equal(namespaceArray.constBegin(), namespaceArray.constEnd(),
+                           m_namespaceArray.constBegin(), m_namespaceArray.constEnd())) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "The namespace array has changed, discarding the address space cache";
+        return false;
+    }
+
+    const qint32 nodeCount = decoder.decode<qint32>(success);
+    m_entries.reserve(success ? qBound(0, nodeCount, 65536) : 0);
+
+    for (qint32 i = 0; success && i < nodeCount; ++i) {
+        const QString nodeId = decoder.decode<QString>(success);
+        const qint32 entryCount = decoder.decode<qint32>(success);
+        auto &entries = m_entries[nodeId];
+
+        for (qint32 j = 0; success && j < entryCount; ++j) {
+            const QString key = decoder.decode<QString>(success);
+            const qint32 size = decoder.decode<qint32>(success);
+            if (!success || size < 0 || size > data.size() - decoder.offset()) {
+                success = false;
+                break;
+            }
+            entries.insert(key, QByteArray::fromRawData(data.constData() + decoder.offset(), size));
+            decoder.setOffset(decoder.offset() + size);
+        }
+    }
+
+    if (!success) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Ignoring damaged address space cache" << m_file.fileName();
+        return false;
+    }
+
+    return true;
+}
+
+/*
+    Writes all entries to a new file which replaces the old one. The mapping of the old file
+    is removed before the new file is put in place, the entries are cleared as they point into it.
+*/
+bool Open62541AddressSpaceCache::save()
+{
+    if (!QDir().mkpath(m_directory))
+        return false;
+
+    QSaveFile file(m_file.fileName());
+    if (!file.open(QIODevice::WriteOnly))
+        return false;
+
+    QByteArray buffer;
+    QOpcUaBinaryDataEncoding encoder(&buffer);
+    encoder.encode<quint32>(cacheFileMagic);
+    encoder.encode<quint32>(cacheFileVersion);
+    encoder.encode<QString>(m_applicationUri);
+    encoder.encodeArray<QString>(QVector<QString>(m_namespaceArray.constBegin(), m_namespaceArray.constEnd()));
+    encoder.encode<qint32>(m_entries.size());
+
+    for (auto node = m_entries.constBegin(); node != m_entries.constEnd(); ++node) {
+        encoder.encode<QString>(node.key());
+        encoder.encode<qint32>(node->size());
+        for (auto entry = node->constBegin(); entry != node->constEnd(); ++entry) {
+            encoder.encode<QString>(entry.key());
+            encoder.encode<qint32>(entry->size());
+            buffer.append(*entry);
+        }
+
+        if (buffer.size() >= 1024 * 1024) {
+            file.write(buffer);
+            buffer.clear();
+        }
+    }
+    file.write(buffer);
+
+    m_entries.clear();
+    unmap();
+    m_modified = false;
+
+    return file.commit();
+}
+
+void Open62541AddressSpaceCache::unmap()
+{
+    if (m_map) {
+        m_file.unmap(m_map);
+        m_map = nullptr;
+    }
+    m_file.close();
+}
+
+QT_END_NAMESPACE
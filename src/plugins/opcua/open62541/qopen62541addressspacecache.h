@@ -0,0 +1,102 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPEN62541ADDRESSSPACECACHE_H
+#define QOPEN62541ADDRESSSPACECACHE_H
+
+#include <QtOpcUa/qopcuabrowserequest.h>
+#include <QtOpcUa/qopcuareadresult.h>
+#include <QtOpcUa/qopcuareferencedescription.h>
+#include <QtOpcUa/qopcuatype.h>
+
+#include <QtCore/qfile.h>
+#include <QtCore/qhash.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qvector.h>
+
+QT_BEGIN_NAMESPACE
+
+// Persistent cache for browse results and attributes which don't change while the address space stays the same.
+// There is one file per server, its entries are only used if the namespace array of the server is still the same.
+// The file is memory mapped, entries are decoded when they are requested and written back when the cache is closed.
+class Open62541AddressSpaceCache
+{
+public:
+    Open62541AddressSpaceCache();
+    ~Open62541AddressSpaceCache();
+
+    QString directory() const;
+    void setDirectory(const QString &directory); // An empty directory disables the cache
+
+    bool isOpen() const;
+    void open(const QString &applicationUri, const QStringList &namespaceArray);
+    void close();
+
+    static bool isCacheable(QOpcUa::NodeAttributes attributes);
+
+    bool readAttributes(const QString &nodeId, QOpcUa::NodeAttributes attributes, QVector<QOpcUaReadResult> *results) const;
+    void insertAttribute(const QString &nodeId, QOpcUa::NodeAttribute attribute, const QVariant &value);
+
+    static QString browseKey(const QOpcUaBrowseRequest &request);
+    bool references(const QString &nodeId, const QString &browseKey, QVector<QOpcUaReferenceDescription> *references) const;
+    void insertReferences(const QString &nodeId, const QString &browseKey, const QVector<QOpcUaReferenceDescription> &references);
+
+    void invalidate(const QString &nodeId);
+    void clear();
+
+private:
+    Q_DISABLE_COPY(Open62541AddressSpaceCache)
+
+    bool load();
+    bool save();
+    void unmap();
+
+    QString m_directory;
+    QString m_applicationUri;
+    QStringList m_namespaceArray;
+    bool m_open;
+    bool m_modified;
+
+    QFile m_file;
+    uchar *m_map;
+
+    // Node id -> Entry key -> Encoded entry, entries loaded from the file point into the mapped memory
+    QHash<QString, QHash<QString, QByteArray>> m_entries;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPEN62541ADDRESSSPACECACHE_H
@@ -39,6 +39,7 @@
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
 #include <private/qopcuaclient_p.h>
+#include <private/qopcuatagtable_p.h>
 
 #include "qopcuaauthenticationinformation.h"
 #include <qopcuaerrorstate.h>
@@ -49,6 +50,12 @@
 #include <QtCore/qstringlist.h>
 #include <QtCore/qurl.h>
 
+#include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <QtOpcUa/qopcuasimpleattributeoperand.h>
+
+#include <algorithm>
+#include <limits>
+
 QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
@@ -58,17 +65,68 @@ Open62541AsyncBackend::Open62541AsyncBackend(QOpen62541Client *parent)
     , m_uaclient(nullptr)
     , m_clientImpl(parent)
     , m_useStateCallback(false)
+    , m_batchDataChanges(true)
+    , m_conversionFlags(QOpen62541ValueConverter::NoConversionFlags)
+    , m_maxRequestsInFlight(32)
+    , m_coalescingInterval(-1)
+    , m_coalescingMaxItems(1000)
+    , m_reconnectInterval(0)
+    , m_crawlRequestsInFlight(4)
+    , m_configuredMaxNodesPerRead(0)
+    , m_configuredMaxNodesPerWrite(0)
+    , m_draining(false)
     , m_subscriptionTimer(this)
+    , m_socketNotifier(nullptr)
     , m_sendPublishRequests(false)
     , m_minPublishingInterval(0)
+    , m_maxNodesPerRead(0)
+    , m_maxNodesPerWrite(0)
+    , m_maxMonitoredItemsPerCall(0)
+    , m_maxNodesPerBrowse(0)
+    , m_maxNodesPerRegisterNodes(0)
+    , m_maxNodesPerHistoryReadData(0)
+    , m_maxNodesPerTranslateBrowsePaths(0)
+    , m_nextChunkedRequestId(1)
+    , m_reconnectTimer(this)
+    , m_nextNodeRegistrationId(1)
+    , m_coalescingTimer(this)
+    , m_readSequence(0)
+    , m_cacheClearedSequence(0)
 {
     m_subscriptionTimer.setSingleShot(true);
-    QObject::connect(&m_subscriptionTimer, &QTimer::timeout,
-                     this, &Open62541AsyncBackend::sendPublishRequest);
+    QObject::connect(&m_subscriptionTimer, &QTimer::timeout, this, [this]() {
+        // Pick up commands posted since the last iteration before waiting for the server
+        drainCommandQueue();
+        sendPublishRequest();
+    });
+
+    m_reconnectTimer.setSingleShot(true);
+    QObject::connect(&m_reconnectTimer, &QTimer::timeout,
+                     this, &Open62541AsyncBackend::reconnect);
+
+    m_coalescingTimer.setSingleShot(true);
+    m_coalescingTimer.setTimerType(Qt::PreciseTimer);
+    QObject::connect(&m_coalescingTimer, &QTimer::timeout,
+                     this, &Open62541AsyncBackend::flushCoalescedRequests);
 }
 
 Open62541AsyncBackend::~Open62541AsyncBackend()
 {
+    // Nobody is listening anymore, drop the requests without reporting them
+    for (const auto &request : qAsConst(m_queuedRequests))
+        UA_delete(request.request, request.requestType);
+    m_queuedRequests.clear();
+    m_pendingRequests.clear();
+
+    for (auto &readId : m_coalescedReadIds)
+        UA_ReadValueId_deleteMembers(&readId);
+    for (auto &writeValue : m_coalescedWriteValues)
+        UA_WriteValue_deleteMembers(&writeValue);
+    clearCrawlFrontier();
+    clearRegisteredNodes();
+    m_addressSpaceCache.close();
+
+    releaseSocketNotifier();
     cleanupSubscriptions();
     if (m_uaclient)
         UA_Client_delete(m_uaclient);
@@ -76,56 +134,49 @@ Open62541AsyncBackend::~Open62541AsyncBackend()
 
 void Open62541AsyncBackend::readAttributes(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, QString indexRange)
 {
-    UA_ReadRequest req;
-    UA_ReadRequest_init(&req);
-    QVector<UA_ReadValueId> valueIds;
+    UaDeleter<UA_NodeId> nodeIdDeleter(&id, UA_NodeId_deleteMembers);
 
-    UA_ReadValueId readId;
-    UA_ReadValueId_init(&readId);
-    UaDeleter<UA_ReadValueId> readIdDeleter(&readId, UA_ReadValueId_deleteMembers);
-    readId.nodeId = id;
+    // Keep the order of reads and writes
+    if (!m_coalescedWriteValues.isEmpty())
+        flushCoalescedWrites();
 
-    QVector<QOpcUaReadResult> vec;
+    QVector<UA_ReadValueId> readIds;
+    QVector<QOpcUaReadResult> results;
+
+    // Static attributes are served from the address space cache if all of them are known
+    QString cacheNodeId;
+    if (m_addressSpaceCache.isOpen() && indexRange.isEmpty()) {
+        cacheNodeId = Open62541Utils::nodeIdToQString(id);
+        if (Open62541AddressSpaceCache::isCacheable(attr) && m_addressSpaceCache.readAttributes(cacheNodeId, attr, &results)) {
+            emitCachedAttributes(handle, results);
+            return;
+        }
+    }
+
+    substituteRegisteredNodeId(&id);
 
     qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
+        UA_ReadValueId readId;
+        UA_ReadValueId_init(&readId);
         readId.attributeId = QOpen62541ValueConverter::toUaAttributeId(attribute);
+        UA_NodeId_copy(&id, &readId.nodeId);
         if (indexRange.length())
             QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(indexRange, &readId.indexRange);
-        valueIds.push_back(readId);
+        readIds.push_back(readId);
         QOpcUaReadResult temp;
         temp.setAttribute(attribute);
-        vec.push_back(temp);
+        temp.setNodeId(cacheNodeId);
+        results.push_back(temp);
     });
 
-    UA_ReadResponse res;
-    UA_ReadResponse_init(&res);
-    req.nodesToRead = valueIds.data();
-    req.nodesToReadSize = valueIds.size();
-    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
-
-    res = UA_Client_Service_read(m_uaclient, req);
+    if (!m_coalescedReadIds.isEmpty() && m_coalescedReadIds.size() + readIds.size() > maxCoalescedItems(m_maxNodesPerRead))
+        flushCoalescedReads();
 
-    UaDeleter<UA_ReadResponse> responseDeleter(&res, UA_ReadResponse_deleteMembers);
+    m_coalescedReadIds += readIds;
+    m_coalescedRead.readResults += results;
+    m_coalescedRead.handleRanges.push_back(qMakePair(handle, results.size()));
 
-    for (int i = 0; i < vec.size(); ++i) {
-        // Use the service result as status code if there is no specific result for the current value.
-        // This ensures a result for each attribute when UA_Client_Service_read is called for a disconnected client.
-        if (static_cast<size_t>(i) >= res.resultsSize) {
-            vec[i].setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
-            continue;
-        }
-        if (res.results[i].hasStatus)
-            vec[i].setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.results[i].status));
-        else
-            vec[i].setStatusCode(QOpcUa::UaStatusCode::Good);
-        if (res.results[i].hasValue && res.results[i].value.data)
-                vec[i].setValue(QOpen62541ValueConverter::toQVariant(res.results[i].value));
-        if (res.results[i].hasServerTimestamp)
-            vec[i].setSourceTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&res.results[i].sourceTimestamp));
-        if (res.results[i].hasSourceTimestamp)
-            vec[i].setServerTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&res.results[i].serverTimestamp));
-    }
-    emit attributesRead(handle, vec, static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
+    scheduleCoalescedRequests(m_coalescedReadIds.size(), m_maxNodesPerRead);
 }
 
 void Open62541AsyncBackend::writeAttribute(quint64 handle, UA_NodeId id, QOpcUa::NodeAttribute attrId, QVariant value, QOpcUa::Types type, QString indexRange)
@@ -133,27 +184,31 @@ void Open62541AsyncBackend::writeAttribute(quint64 handle, UA_NodeId id, QOpcUa:
     if (type == QOpcUa::Types::Undefined && attrId != QOpcUa::NodeAttribute::Value)
         type = attributeIdToTypeId(attrId);
 
-    UA_WriteRequest req;
-    UA_WriteRequest_init(&req);
-    UaDeleter<UA_WriteRequest> requestDeleter(&req, UA_WriteRequest_deleteMembers);
-    req.nodesToWriteSize = 1;
-    req.nodesToWrite = UA_WriteValue_new();
-
-    UA_WriteValue_init(req.nodesToWrite);
-    req.nodesToWrite->attributeId = QOpen62541ValueConverter::toUaAttributeId(attrId);
-    req.nodesToWrite->nodeId = id;
-    req.nodesToWrite->value.value = QOpen62541ValueConverter::toOpen62541Variant(value, type);
-    req.nodesToWrite->value.hasValue = true;
-    if (indexRange.length())
-        QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(indexRange, &req.nodesToWrite->indexRange);
+    if (!m_coalescedReadIds.isEmpty())
+        flushCoalescedReads();
 
-    UA_WriteResponse res = UA_Client_Service_write(m_uaclient, req);
-    UaDeleter<UA_WriteResponse> responseDeleter(&res, UA_WriteResponse_deleteMembers);
+    if (m_addressSpaceCache.isOpen() && attrId != QOpcUa::NodeAttribute::Value)
+        invalidateCachedNode(Open62541Utils::nodeIdToQString(id));
+
+    substituteRegisteredNodeId(&id);
+
+    if (!m_coalescedWriteValues.isEmpty() && m_coalescedWriteValues.size() + 1 > maxCoalescedItems(m_maxNodesPerWrite))
+        flushCoalescedWrites();
+
+    UA_WriteValue writeValue;
+    UA_WriteValue_init(&writeValue);
+    writeValue.attributeId = QOpen62541ValueConverter::toUaAttributeId(attrId);
+    writeValue.nodeId = id;
+    writeValue.value.value = QOpen62541ValueConverter::toOpen62541Variant(value, type);
+    writeValue.value.hasValue = true;
+    if (indexRange.length())
+        QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(indexRange, &writeValue.indexRange);
 
-    QOpcUa::UaStatusCode status = res.resultsSize ?
-                static_cast<QOpcUa::UaStatusCode>(res.results[0]) : static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+    m_coalescedWriteValues.push_back(writeValue);
+    m_coalescedWrite.writtenAttributes.push_back(qMakePair(attrId, value));
+    m_coalescedWrite.handleRanges.push_back(qMakePair(handle, 1));
 
-    emit attributeWritten(handle, attrId, value, status);
+    scheduleCoalescedRequests(m_coalescedWriteValues.size(), m_maxNodesPerWrite);
 }
 
 void Open62541AsyncBackend::writeAttributes(quint64 handle, UA_NodeId id, QOpcUaNode::AttributeMap toWrite, QOpcUa::Types valueAttributeType)
@@ -166,31 +221,236 @@ void Open62541AsyncBackend::writeAttributes(quint64 handle, UA_NodeId id, QOpcUa
         return;
     }
 
-    UA_WriteRequest req;
-    UA_WriteRequest_init(&req);
-    UaDeleter<UA_WriteRequest> requestDeleter(&req, UA_WriteRequest_deleteMembers);
-    req.nodesToWriteSize = toWrite.size();
-    req.nodesToWrite = static_cast<UA_WriteValue *>(UA_Array_new(req.nodesToWriteSize, &UA_TYPES[UA_TYPES_WRITEVALUE]));
-    size_t index = 0;
-    for (auto it = toWrite.begin(); it != toWrite.end(); ++it, ++index) {
-        UA_WriteValue_init(&(req.nodesToWrite[index]));
-        req.nodesToWrite[index].attributeId = QOpen62541ValueConverter::toUaAttributeId(it.key());
-        UA_NodeId_copy(&id, &(req.nodesToWrite[index].nodeId));
+    if (!m_coalescedReadIds.isEmpty())
+        flushCoalescedReads();
+
+    if (m_addressSpaceCache.isOpen())
+        invalidateCachedNode(Open62541Utils::nodeIdToQString(id));
+
+    substituteRegisteredNodeId(&id);
+
+    if (!m_coalescedWriteValues.isEmpty() && m_coalescedWriteValues.size() + toWrite.size() > maxCoalescedItems(m_maxNodesPerWrite))
+        flushCoalescedWrites();
+
+    for (auto it = toWrite.begin(); it != toWrite.end(); ++it) {
+        UA_WriteValue writeValue;
+        UA_WriteValue_init(&writeValue);
+        writeValue.attributeId = QOpen62541ValueConverter::toUaAttributeId(it.key());
+        UA_NodeId_copy(&id, &writeValue.nodeId);
         QOpcUa::Types type = it.key() == QOpcUa::NodeAttribute::Value ? valueAttributeType : attributeIdToTypeId(it.key());
-        req.nodesToWrite[index].value.value = QOpen62541ValueConverter::toOpen62541Variant(it.value(), type);
+        writeValue.value.value = QOpen62541ValueConverter::toOpen62541Variant(it.value(), type);
+        m_coalescedWriteValues.push_back(writeValue);
+        m_coalescedWrite.writtenAttributes.push_back(qMakePair(it.key(), it.value()));
+    }
+    m_coalescedWrite.handleRanges.push_back(qMakePair(handle, toWrite.size()));
+
+    scheduleCoalescedRequests(m_coalescedWriteValues.size(), m_maxNodesPerWrite);
+}
+
+/*
+    Per-node reads and writes are collected and sent as one request once the coalescing interval has passed
+    or the maximum number of items has been reached. Without coalescing, they are sent immediately.
+*/
+void Open62541AsyncBackend::scheduleCoalescedRequests(int itemCount, quint32 serverLimit)
+{
+    if (m_coalescingInterval < 0 || itemCount >= maxCoalescedItems(serverLimit)) {
+        flushCoalescedRequests();
+        return;
+    }
+
+    if (!m_coalescingTimer.isActive()) {
+        // QTimer has a resolution of one millisecond
+        m_coalescingTimer.start((m_coalescingInterval + 999) / 1000);
+    }
+}
+
+int Open62541AsyncBackend::maxCoalescedItems(quint32 serverLimit) const
+{
+    int limit = m_coalescingMaxItems > 0 ? m_coalescingMaxItems : std::numeric_limits<int>::max();
+    if (serverLimit > 0 && serverLimit < static_cast<quint32>(limit))
+        limit = static_cast<int>(serverLimit);
+    return limit;
+}
+
+void Open62541AsyncBackend::flushCoalescedRequests()
+{
+    m_coalescingTimer.stop();
+    flushCoalescedReads();
+    flushCoalescedWrites();
+}
+
+void Open62541AsyncBackend::drainCommandQueue()
+{
+    // Commands must not run nested inside another command, they are executed in the order they were posted
+    if (m_draining)
+        return;
+
+    m_draining = true;
+    m_commandQueue.drain();
+    m_draining = false;
+}
+
+void Open62541AsyncBackend::flushCoalescedReads()
+{
+    if (m_coalescedReadIds.isEmpty())
+        return;
+
+    // The members of the collected read value ids are moved to the request
+    UA_ReadRequest *req = UA_ReadRequest_new();
+    req->timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    req->nodesToReadSize = m_coalescedReadIds.size();
+    req->nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(req->nodesToReadSize, &UA_TYPES[UA_TYPES_READVALUEID]));
+    std::copy(m_coalescedReadIds.constBegin(), m_coalescedReadIds.constEnd(), req->nodesToRead);
+    m_coalescedReadIds.clear();
+
+    ServiceRequest request = m_coalescedRead;
+    m_coalescedRead = ServiceRequest();
+
+    request.type = ServiceRequest::Type::ReadAttributes;
+    request.readSequence = ++m_readSequence;
+    m_cacheHitsAfterRead.insert(request.readSequence, {});
+    request.request = req;
+    request.requestType = &UA_TYPES[UA_TYPES_READREQUEST];
+    request.responseType = &UA_TYPES[UA_TYPES_READRESPONSE];
+    sendServiceRequest(request);
+}
+
+// Finishes the reads and writes which are still waiting to be coalesced without sending them
+void Open62541AsyncBackend::abortCoalescedRequests(QOpcUa::UaStatusCode status)
+{
+    m_coalescingTimer.stop();
+
+    for (auto &id : m_coalescedReadIds)
+        UA_ReadValueId_deleteMembers(&id);
+    m_coalescedReadIds.clear();
+    for (auto &value : m_coalescedWriteValues)
+        UA_WriteValue_deleteMembers(&value);
+    m_coalescedWriteValues.clear();
+
+    ServiceRequest read = m_coalescedRead;
+    m_coalescedRead = ServiceRequest();
+    if (!read.handleRanges.isEmpty()) {
+        read.type = ServiceRequest::Type::ReadAttributes;
+        read.responseType = &UA_TYPES[UA_TYPES_READRESPONSE];
+        finishServiceRequest(read, status);
+    }
+
+    ServiceRequest write = m_coalescedWrite;
+    m_coalescedWrite = ServiceRequest();
+    if (!write.handleRanges.isEmpty()) {
+        write.type = ServiceRequest::Type::WriteAttributes;
+        write.responseType = &UA_TYPES[UA_TYPES_WRITERESPONSE];
+        finishServiceRequest(write, status);
+    }
+}
+
+/*
+    Results from the address space cache must not overtake reads requested before them.
+    They are emitted after the results of the last read request if it hasn't finished yet.
+*/
+void Open62541AsyncBackend::emitCachedAttributes(quint64 handle, const QVector<QOpcUaReadResult> &results)
+{
+    if (!m_coalescedReadIds.isEmpty())
+        flushCoalescedReads();
+
+    auto it = m_cacheHitsAfterRead.find(m_readSequence);
+    if (it != m_cacheHitsAfterRead.end())
+        it->push_back(qMakePair(handle, results));
+    else
+        emit attributesRead(handle, results, QOpcUa::UaStatusCode::Good);
+}
+
+/*
+    Invalidates the cached attributes of the node with \a nodeId, which may be given in any notation.
+    Results of reads which have been sent before are not inserted into the cache when they arrive.
+*/
+void Open62541AsyncBackend::invalidateCachedNode(const QString &nodeId)
+{
+    if (!m_addressSpaceCache.isOpen())
+        return;
+
+    // The cache uses the notation of nodeIdToQString(), e.g. "ns=0;i=85" for "i=85"
+    UA_NodeId id = Open62541Utils::nodeIdFromQString(nodeId);
+    UaDeleter<UA_NodeId> nodeIdDeleter(&id, UA_NodeId_deleteMembers);
+    const QString normalized = Open62541Utils::nodeIdToQString(id);
+
+    m_addressSpaceCache.invalidate(normalized);
+    if (!m_cacheHitsAfterRead.isEmpty())
+        m_cacheInvalidations.insert(normalized, m_readSequence);
+}
+
+void Open62541AsyncBackend::clearAddressSpaceCache()
+{
+    m_addressSpaceCache.clear();
+    m_cacheClearedSequence = m_readSequence;
+    m_cacheInvalidations.clear();
+}
+
+// Results of a read sent before the node was invalidated may contain the old attributes
+bool Open62541AsyncBackend::isCacheInsertAllowed(const QString &nodeId, quint64 readSequence) const
+{
+    return readSequence > m_cacheClearedSequence && m_cacheInvalidations.value(nodeId, 0) < readSequence;
+}
+
+// Invalidations are only kept while reads which have been sent before them are outstanding
+void Open62541AsyncBackend::pruneCacheInvalidations()
+{
+    if (m_cacheInvalidations.isEmpty())
+        return;
+
+    if (m_cacheHitsAfterRead.isEmpty()) {
+        m_cacheInvalidations.clear();
+        return;
     }
-    UA_WriteResponse res = UA_Client_Service_write(m_uaclient, req);
-    UaDeleter<UA_WriteResponse> responseDeleter(&res, UA_WriteResponse_deleteMembers);
 
-    index = 0;
-    for (auto it = toWrite.begin(); it != toWrite.end(); ++it, ++index) {
-        QOpcUa::UaStatusCode status = index < res.resultsSize ?
-                    static_cast<QOpcUa::UaStatusCode>(res.results[index]) : static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
-        emit attributeWritten(handle, it.key(), it.value(), status);
+    const quint64 oldestRead = *std::min_element(m_cacheHitsAfterRead.keyBegin(), m_cacheHitsAfterRead.keyEnd());
+    for (auto it = m_cacheInvalidations.begin(); it != m_cacheInvalidations.end();) {
+        if (it.value() < oldestRead)
+            it = m_cacheInvalidations.erase(it);
+        else
+            ++it;
     }
 }
 
+void Open62541AsyncBackend::flushCoalescedWrites()
+{
+    if (m_coalescedWriteValues.isEmpty())
+        return;
+
+    UA_WriteRequest *req = UA_WriteRequest_new();
+    req->nodesToWriteSize = m_coalescedWriteValues.size();
+    req->nodesToWrite = static_cast<UA_WriteValue *>(UA_Array_new(req->nodesToWriteSize, &UA_TYPES[UA_TYPES_WRITEVALUE]));
+    std::copy(m_coalescedWriteValues.constBegin(), m_coalescedWriteValues.constEnd(), req->nodesToWrite);
+    m_coalescedWriteValues.clear();
+
+    ServiceRequest request = m_coalescedWrite;
+    m_coalescedWrite = ServiceRequest();
+
+    request.type = ServiceRequest::Type::WriteAttributes;
+    request.request = req;
+    request.requestType = &UA_TYPES[UA_TYPES_WRITEREQUEST];
+    request.responseType = &UA_TYPES[UA_TYPES_WRITERESPONSE];
+    sendServiceRequest(request);
+}
+
 void Open62541AsyncBackend::enableMonitoring(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
+{
+    if (handle == ModelChangeEventHandle) {
+        UA_NodeId_deleteMembers(&id);
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored item, the handle is reserved by the backend";
+        qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
+            QOpcUaMonitoringParameters s;
+            s.setStatusCode(QOpcUa::UaStatusCode::BadInvalidArgument);
+            emit monitoringEnableDisable(handle, attribute, true, s);
+        });
+        return;
+    }
+
+    addMonitoredAttributes(handle, id, attr, settings);
+}
+
+void Open62541AsyncBackend::addMonitoredAttributes(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr,
+                                                   const QOpcUaMonitoringParameters &settings)
 {
     UaDeleter<UA_NodeId> nodeIdDeleter(&id, UA_NodeId_deleteMembers);
 
@@ -245,8 +505,11 @@ void Open62541AsyncBackend::enableMonitoring(quint64 handle, UA_NodeId id, QOpcU
 
 void Open62541AsyncBackend::disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr)
 {
+    // Deliver data changes received before the monitoring is disabled
+    flushDataChanges();
+
     qt_forEachAttribute(attr, [&](QOpcUa::NodeAttribute attribute){
-        QOpen62541Subscription *sub = getSubscriptionForItem(handle, attribute);
+        QOpen62541Subscription *sub = getClientSubscriptionForItem(handle, attribute);
         if (sub) {
             sub->removeAttributeMonitoredItem(handle, attribute);
             m_attributeMapping[handle].remove(attribute);
@@ -259,7 +522,7 @@ void Open62541AsyncBackend::disableMonitoring(quint64 handle, QOpcUa::NodeAttrib
 
 void Open62541AsyncBackend::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
 {
-    QOpen62541Subscription *subscription = getSubscriptionForItem(handle, attr);
+    QOpen62541Subscription *subscription = getClientSubscriptionForItem(handle, attr);
     if (!subscription) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify" << item << ", the monitored item does not exist";
         QOpcUaMonitoringParameters p;
@@ -272,6 +535,314 @@ void Open62541AsyncBackend::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribu
     modifyPublishRequests();
 }
 
+static bool hasSameSubscriptionParameters(const QOpcUaMonitoringParameters &lhs, const QOpcUaMonitoringParameters &rhs)
+{
+    return qFuzzyCompare(lhs.publishingInterval(), rhs.publishingInterval()) &&
+            lhs.lifetimeCount() == rhs.lifetimeCount() &&
+            lhs.maxKeepAliveCount() == rhs.maxKeepAliveCount() &&
+            lhs.maxNotificationsPerPublish() == rhs.maxNotificationsPerPublish() &&
+            lhs.priority() == rhs.priority() &&
+            lhs.isPublishingEnabled() == rhs.isPublishingEnabled();
+}
+
+void Open62541AsyncBackend::createMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items)
+{
+    // One entry per attribute of each item, the results are emitted in this order
+    QVector<QOpen62541Subscription::MonitoredItemRequest> requests;
+    QVector<QOpen62541Subscription *> requestSubscriptions;
+    QVector<QString> requestNodeIds;
+    QSet<QPair<quint64, QOpcUa::NodeAttribute>> requestedAttributes;
+
+    // Exclusive items with identical parameters from the same call share one new subscription
+    QVector<QPair<QOpcUaMonitoringParameters, QOpen62541Subscription *>> exclusiveSubscriptions;
+
+    for (int i = 0; i < items.size() && i < handles.size(); ++i) {
+        const QOpcUaMonitoringItem &item = items.at(i);
+        const quint64 handle = handles.at(i);
+        const QOpcUaMonitoringParameters &settings = item.parameters();
+
+        qt_forEachAttribute(item.attributes(), [&](QOpcUa::NodeAttribute attribute) {
+            QOpen62541Subscription::MonitoredItemRequest request;
+            request.handle = handle;
+            request.attr = attribute;
+            request.nodeId = m_nodeIdCache.nodeIdFromQString(item.nodeId());
+            request.parameters = settings;
+            request.lazyValue = true; // Delivered by QOpcUaClient::dataChangesOccurred()
+
+            QOpen62541Subscription *usedSubscription = nullptr;
+            QOpcUa::UaStatusCode status = QOpcUa::UaStatusCode::Good;
+
+            if (handle == ModelChangeEventHandle) {
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored item, the handle is reserved by the backend";
+                status = QOpcUa::UaStatusCode::BadInvalidArgument;
+            } else if (UA_NodeId_isNull(&request.nodeId)) {
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored item, invalid node id" << item.nodeId();
+                status = QOpcUa::UaStatusCode::BadNodeIdInvalid;
+            } else if (getSubscriptionForItem(handle, attribute) || requestedAttributes.contains(qMakePair(handle, attribute))) {
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Monitored item for" << attribute << "has already been created";
+                status = QOpcUa::UaStatusCode::BadEntryExists;
+            } else if (settings.subscriptionId()) {
+                usedSubscription = m_subscriptions.value(settings.subscriptionId(), nullptr);
+                if (!usedSubscription) {
+                    qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no subscription with id" << settings.subscriptionId();
+                    status = QOpcUa::UaStatusCode::BadSubscriptionIdInvalid;
+                }
+            } else {
+                if (settings.subscriptionType() == QOpcUaMonitoringParameters::SubscriptionType::Exclusive) {
+                    for (const auto &entry : qAsConst(exclusiveSubscriptions)) {
+                        if (hasSameSubscriptionParameters(entry.first, settings)) {
+                            usedSubscription = entry.second;
+                            break;
+                        }
+                    }
+                }
+                if (!usedSubscription) {
+                    usedSubscription = getSubscription(settings);
+                    if (usedSubscription && settings.subscriptionType() == QOpcUaMonitoringParameters::SubscriptionType::Exclusive)
+                        exclusiveSubscriptions.append(qMakePair(settings, usedSubscription));
+                }
+                if (!usedSubscription) {
+                    qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create subscription with interval" << settings.publishingInterval();
+                    status = QOpcUa::UaStatusCode::BadSubscriptionIdInvalid;
+                }
+            }
+
+            if (status != QOpcUa::UaStatusCode::Good) {
+                request.parameters = QOpcUaMonitoringParameters();
+                request.parameters.setStatusCode(status);
+            } else {
+                requestedAttributes.insert(qMakePair(handle, attribute));
+            }
+
+            requests.append(request);
+            requestSubscriptions.append(usedSubscription);
+            requestNodeIds.append(item.nodeId());
+        });
+    }
+
+    // Send one request per subscription
+    QHash<QOpen62541Subscription *, QVector<int>> subscriptionRequests;
+    for (int i = 0; i < requests.size(); ++i) {
+        if (requestSubscriptions.at(i))
+            subscriptionRequests[requestSubscriptions.at(i)].append(i);
+    }
+
+    for (auto it = subscriptionRequests.constBegin(); it != subscriptionRequests.constEnd(); ++it) {
+        QVector<QOpen62541Subscription::MonitoredItemRequest> subscriptionItems;
+        subscriptionItems.reserve(it.value().size());
+        for (int index : it.value())
+            subscriptionItems.append(requests.at(index));
+
+        it.key()->addAttributeMonitoredItems(subscriptionItems);
+
+        for (int i = 0; i < subscriptionItems.size(); ++i) {
+            const auto &result = subscriptionItems.at(i);
+            if (result.parameters.statusCode() == QOpcUa::UaStatusCode::Good)
+                m_attributeMapping[result.handle][result.attr] = it.key();
+            requests[it.value().at(i)].parameters = result.parameters;
+        }
+
+        if (it.key()->monitoredItemsCount() == 0)
+            removeSubscription(it.key()->subscriptionId()); // No items were added
+    }
+
+    QVector<QOpcUaMonitoringItem> results;
+    results.reserve(requests.size());
+    for (int i = 0; i < requests.size(); ++i) {
+        UA_NodeId_deleteMembers(&requests[i].nodeId);
+        results.append(QOpcUaMonitoringItem(requestNodeIds.at(i), requests.at(i).attr, requests.at(i).parameters));
+    }
+
+    modifyPublishRequests();
+
+    emit enableMonitoringFinished(results);
+}
+
+/*
+    All tags of a table are monitored in one subscription. Their handles are derived from
+    the table id, data changes are written into the table by queueDataChange().
+*/
+void Open62541AsyncBackend::createTagMonitoredItems(quint32 tableId, const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings)
+{
+    registerTagTable(tableId, table);
+    const int tagCount = table.size();
+
+    QOpen62541Subscription *sub = settings.subscriptionId() ? m_subscriptions.value(settings.subscriptionId(), nullptr)
+                                                            : getSubscription(settings);
+    if (!sub) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not find or create a subscription for the tag table";
+        for (int i = 0; i < tagCount; ++i)
+            setTagStatusCode(QOpcUaTagTablePrivate::tagHandle(tableId, i), QOpcUa::UaStatusCode::BadSubscriptionIdInvalid);
+        return;
+    }
+
+    QVector<QOpen62541Subscription::MonitoredItemRequest> requests;
+    requests.reserve(tagCount);
+    for (int i = 0; i < tagCount; ++i) {
+        QOpen62541Subscription::MonitoredItemRequest request;
+        request.handle = QOpcUaTagTablePrivate::tagHandle(tableId, i);
+        request.attr = QOpcUa::NodeAttribute::Value;
+        request.nodeId = m_nodeIdCache.nodeIdFromQString(table.nodeId(i));
+        request.parameters = settings;
+        request.lazyValue = true; // Converted when the application reads the tag
+
+        if (UA_NodeId_isNull(&request.nodeId)) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored item, invalid node id" << table.nodeId(i);
+            setTagStatusCode(request.handle, QOpcUa::UaStatusCode::BadNodeIdInvalid);
+            continue;
+        }
+        requests.append(request);
+    }
+
+    sub->addAttributeMonitoredItems(requests);
+
+    for (auto &request : requests) {
+        if (request.parameters.statusCode() != QOpcUa::UaStatusCode::Good)
+            setTagStatusCode(request.handle, request.parameters.statusCode());
+        UA_NodeId_deleteMembers(&request.nodeId);
+    }
+
+    if (sub->monitoredItemsCount() == 0) {
+        removeSubscription(sub->subscriptionId()); // No items were added
+        return;
+    }
+
+    m_tagTableSubscriptions[tableId] = sub->subscriptionId();
+    modifyPublishRequests();
+}
+
+void Open62541AsyncBackend::deleteTagMonitoredItems(quint32 tableId)
+{
+    const QOpcUaTagTable table = tagTable(tableId);
+    unregisterTagTable(tableId);
+
+    QOpen62541Subscription *sub = m_subscriptions.value(m_tagTableSubscriptions.take(tableId), nullptr);
+    if (!sub)
+        return;
+
+    QVector<QOpen62541Subscription::MonitoredItemRequest> requests(table.size());
+    for (int i = 0; i < requests.size(); ++i) {
+        requests[i].handle = QOpcUaTagTablePrivate::tagHandle(tableId, i);
+        requests[i].attr = QOpcUa::NodeAttribute::Value;
+        UA_NodeId_init(&requests[i].nodeId);
+    }
+
+    sub->removeAttributeMonitoredItems(requests);
+
+    if (sub->monitoredItemsCount() == 0)
+        removeSubscription(sub->subscriptionId());
+}
+
+void Open62541AsyncBackend::deleteMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items)
+{
+    // Deliver data changes received before the monitoring is disabled
+    flushDataChanges();
+
+    QVector<QOpen62541Subscription::MonitoredItemRequest> requests;
+    QVector<QString> requestNodeIds;
+    QHash<QOpen62541Subscription *, QVector<int>> subscriptionRequests;
+
+    for (int i = 0; i < items.size() && i < handles.size(); ++i) {
+        const quint64 handle = handles.at(i);
+        qt_forEachAttribute(items.at(i).attributes(), [&](QOpcUa::NodeAttribute attribute) {
+            QOpen62541Subscription::MonitoredItemRequest request;
+            request.handle = handle;
+            request.attr = attribute;
+            UA_NodeId_init(&request.nodeId);
+
+            QOpen62541Subscription *sub = getClientSubscriptionForItem(handle, attribute);
+            if (sub)
+                subscriptionRequests[sub].append(requests.size());
+            else
+                request.parameters.setStatusCode(QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+
+            requests.append(request);
+            requestNodeIds.append(items.at(i).nodeId());
+        });
+    }
+
+    for (auto it = subscriptionRequests.constBegin(); it != subscriptionRequests.constEnd(); ++it) {
+        QVector<QOpen62541Subscription::MonitoredItemRequest> subscriptionItems;
+        subscriptionItems.reserve(it.value().size());
+        for (int index : it.value())
+            subscriptionItems.append(requests.at(index));
+
+        it.key()->removeAttributeMonitoredItems(subscriptionItems);
+
+        for (int i = 0; i < subscriptionItems.size(); ++i) {
+            const auto &result = subscriptionItems.at(i);
+            auto mapping = m_attributeMapping.find(result.handle);
+            if (mapping != m_attributeMapping.end()) {
+                mapping->remove(result.attr);
+                if (mapping->isEmpty())
+                    m_attributeMapping.erase(mapping);
+            }
+            requests[it.value().at(i)].parameters = result.parameters;
+        }
+
+        if (it.key()->monitoredItemsCount() == 0)
+            removeSubscription(it.key()->subscriptionId());
+    }
+
+    QVector<QOpcUaMonitoringItem> results;
+    results.reserve(requests.size());
+    for (int i = 0; i < requests.size(); ++i)
+        results.append(QOpcUaMonitoringItem(requestNodeIds.at(i), requests.at(i).attr, requests.at(i).parameters));
+
+    modifyPublishRequests();
+
+    emit disableMonitoringFinished(results);
+}
+
+void Open62541AsyncBackend::modifyMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items)
+{
+    QVector<QOpen62541Subscription::MonitoredItemRequest> requests;
+    QVector<QString> requestNodeIds;
+    QHash<QOpen62541Subscription *, QVector<int>> subscriptionRequests;
+
+    for (int i = 0; i < items.size() && i < handles.size(); ++i) {
+        const quint64 handle = handles.at(i);
+        qt_forEachAttribute(items.at(i).attributes(), [&](QOpcUa::NodeAttribute attribute) {
+            QOpen62541Subscription::MonitoredItemRequest request;
+            request.handle = handle;
+            request.attr = attribute;
+            UA_NodeId_init(&request.nodeId);
+            request.parameters = items.at(i).parameters();
+
+            QOpen62541Subscription *sub = getClientSubscriptionForItem(handle, attribute);
+            if (sub) {
+                subscriptionRequests[sub].append(requests.size());
+            } else {
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify monitored item for" << attribute << ", the monitored item does not exist";
+                request.parameters = QOpcUaMonitoringParameters();
+                request.parameters.setStatusCode(QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+            }
+
+            requests.append(request);
+            requestNodeIds.append(items.at(i).nodeId());
+        });
+    }
+
+    for (auto it = subscriptionRequests.constBegin(); it != subscriptionRequests.constEnd(); ++it) {
+        QVector<QOpen62541Subscription::MonitoredItemRequest> subscriptionItems;
+        subscriptionItems.reserve(it.value().size());
+        for (int index : it.value())
+            subscriptionItems.append(requests.at(index));
+
+        it.key()->modifyAttributeMonitoredItems(subscriptionItems);
+
+        for (int i = 0; i < subscriptionItems.size(); ++i)
+            requests[it.value().at(i)].parameters = subscriptionItems.at(i).parameters;
+    }
+
+    QVector<QOpcUaMonitoringItem> results;
+    results.reserve(requests.size());
+    for (int i = 0; i < requests.size(); ++i)
+        results.append(QOpcUaMonitoringItem(requestNodeIds.at(i), requests.at(i).attr, requests.at(i).parameters));
+
+    emit modifyMonitoringFinished(results);
+}
+
 QOpen62541Subscription *Open62541AsyncBackend::getSubscription(const QOpcUaMonitoringParameters &settings)
 {
     if (settings.subscriptionType() == QOpcUaMonitoringParameters::SubscriptionType::Shared) {
@@ -312,85 +883,56 @@ bool Open62541AsyncBackend::removeSubscription(UA_UInt32 subscriptionId)
 
 void Open62541AsyncBackend::callMethod(quint64 handle, UA_NodeId objectId, UA_NodeId methodId, QVector<QOpcUa::TypedVariant> args)
 {
-    UaDeleter<UA_NodeId> objectIdDeleter(&objectId, UA_NodeId_deleteMembers);
-    UaDeleter<UA_NodeId> methodIdDeleter(&methodId, UA_NodeId_deleteMembers);
+    ServiceRequest request;
+    request.type = ServiceRequest::Type::CallMethod;
+    request.handle = handle;
+    request.methodNodeId = Open62541Utils::nodeIdToQString(methodId);
 
-    UA_Variant *inputArgs = nullptr;
+    UA_CallRequest *req = UA_CallRequest_new();
+    req->methodsToCallSize = 1;
+    req->methodsToCall = UA_CallMethodRequest_new();
+    req->methodsToCall->objectId = objectId;
+    req->methodsToCall->methodId = methodId;
 
     if (args.size()) {
-        inputArgs = static_cast<UA_Variant *>(UA_Array_new(args.size(), &UA_TYPES[UA_TYPES_VARIANT]));
+        req->methodsToCall->inputArgumentsSize = args.size();
+        req->methodsToCall->inputArguments = static_cast<UA_Variant *>(UA_Array_new(args.size(), &UA_TYPES[UA_TYPES_VARIANT]));
         for (int i = 0; i < args.size(); ++i)
-            inputArgs[i] = QOpen62541ValueConverter::toOpen62541Variant(args[i].first, args[i].second);
+            req->methodsToCall->inputArguments[i] = QOpen62541ValueConverter::toOpen62541Variant(args[i].first, args[i].second);
     }
-    UaArrayDeleter<UA_TYPES_VARIANT> inputArgsDeleter(inputArgs, args.size());
 
-    size_t outputSize = 0;
-    UA_Variant *outputArguments = nullptr;
-    UA_StatusCode res = UA_Client_call(m_uaclient, objectId, methodId, args.size(), inputArgs, &outputSize, &outputArguments);
-    UaArrayDeleter<UA_TYPES_VARIANT> outputArgsDeleter(outputArguments, outputSize);
-
-    if (res != UA_STATUSCODE_GOOD)
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not call method:" << UA_StatusCode_name(res);
-
-    QVariant result;
-
-    if (outputSize > 1 && res == UA_STATUSCODE_GOOD) {
-        QVariantList temp;
-        for (size_t i = 0; i < outputSize; ++i)
-            temp.append(QOpen62541ValueConverter::toQVariant(outputArguments[i]));
-
-        result = temp;
-    } else if (outputSize == 1 && res == UA_STATUSCODE_GOOD) {
-        result = QOpen62541ValueConverter::toQVariant(outputArguments[0]);
-    }
-
-    emit methodCallFinished(handle, Open62541Utils::nodeIdToQString(methodId), result, static_cast<QOpcUa::UaStatusCode>(res));
+    request.request = req;
+    request.requestType = &UA_TYPES[UA_TYPES_CALLREQUEST];
+    request.responseType = &UA_TYPES[UA_TYPES_CALLRESPONSE];
+    sendServiceRequest(request);
 }
 
 void Open62541AsyncBackend::resolveBrowsePath(quint64 handle, UA_NodeId startNode, const QVector<QOpcUaRelativePathElement> &path)
 {
-    UA_TranslateBrowsePathsToNodeIdsRequest req;
-    UA_TranslateBrowsePathsToNodeIdsRequest_init(&req);
-    UaDeleter<UA_TranslateBrowsePathsToNodeIdsRequest> requestDeleter(
-                &req,UA_TranslateBrowsePathsToNodeIdsRequest_deleteMembers);
+    UA_TranslateBrowsePathsToNodeIdsRequest *req = UA_TranslateBrowsePathsToNodeIdsRequest_new();
 
-    req.browsePathsSize = 1;
-    req.browsePaths = UA_BrowsePath_new();
-    UA_BrowsePath_init(req.browsePaths);
-    req.browsePaths->startingNode = startNode;
-    req.browsePaths->relativePath.elementsSize = path.size();
-    req.browsePaths->relativePath.elements = static_cast<UA_RelativePathElement *>(UA_Array_new(path.size(), &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]));
+    req->browsePathsSize = 1;
+    req->browsePaths = UA_BrowsePath_new();
+    req->browsePaths->startingNode = startNode;
+    req->browsePaths->relativePath.elementsSize = path.size();
+    req->browsePaths->relativePath.elements = static_cast<UA_RelativePathElement *>(UA_Array_new(path.size(), &UA_TYPES[UA_TYPES_RELATIVEPATHELEMENT]));
 
     for (int i = 0 ; i < path.size(); ++i) {
-        req.browsePaths->relativePath.elements[i].includeSubtypes = path[i].includeSubtypes();
-        req.browsePaths->relativePath.elements[i].isInverse = path[i].isInverse();
-        req.browsePaths->relativePath.elements[i].referenceTypeId = Open62541Utils::nodeIdFromQString(path[i].referenceTypeId());
-        req.browsePaths->relativePath.elements[i].targetName = UA_QUALIFIEDNAME_ALLOC(path[i].targetName().namespaceIndex(),
-                                                                                      path[i].targetName().name().toUtf8().constData());
-    }
-
-    UA_TranslateBrowsePathsToNodeIdsResponse res = UA_Client_Service_translateBrowsePathsToNodeIds(m_uaclient, req);
-    UaDeleter<UA_TranslateBrowsePathsToNodeIdsResponse> responseDeleter(
-                &res, UA_TranslateBrowsePathsToNodeIdsResponse_deleteMembers);
-
-    if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD || res.resultsSize != 1) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Translate browse path failed:" << UA_StatusCode_name(res.responseHeader.serviceResult);
-        emit resolveBrowsePathFinished(handle, QVector<QOpcUaBrowsePathTarget>(), path,
-                                         static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult));
-        return;
-    }
-
-    QVector<QOpcUaBrowsePathTarget> ret;
-    for (size_t i = 0; i < res.results[0].targetsSize ; ++i) {
-        QOpcUaBrowsePathTarget temp;
-        temp.setRemainingPathIndex(res.results[0].targets[i].remainingPathIndex);
-        temp.targetIdRef().setNamespaceUri(QString::fromUtf8(reinterpret_cast<char *>(res.results[0].targets[i].targetId.namespaceUri.data)));
-        temp.targetIdRef().setServerIndex(res.results[0].targets[i].targetId.serverIndex);
-        temp.targetIdRef().setNodeId(Open62541Utils::nodeIdToQString(res.results[0].targets[i].targetId.nodeId));
-        ret.append(temp);
+        req->browsePaths->relativePath.elements[i].includeSubtypes = path[i].includeSubtypes();
+        req->browsePaths->relativePath.elements[i].isInverse = path[i].isInverse();
+        req->browsePaths->relativePath.elements[i].referenceTypeId = m_nodeIdCache.nodeIdFromQString(path[i].referenceTypeId());
+        req->browsePaths->relativePath.elements[i].targetName = UA_QUALIFIEDNAME_ALLOC(path[i].targetName().namespaceIndex(),
+                                                                                       path[i].targetName().name().toUtf8().constData());
     }
 
-    emit resolveBrowsePathFinished(handle, ret, path, static_cast<QOpcUa::UaStatusCode>(res.results[0].statusCode));
+    ServiceRequest request;
+    request.type = ServiceRequest::Type::ResolveBrowsePath;
+    request.handle = handle;
+    request.path = path;
+    request.request = req;
+    request.requestType = &UA_TYPES[UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST];
+    request.responseType = &UA_TYPES[UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSRESPONSE];
+    sendServiceRequest(request);
 }
 
 void Open62541AsyncBackend::findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris)
@@ -443,56 +985,34 @@ void Open62541AsyncBackend::readNodeAttributes(const QVector<QOpcUaReadItem> &no
         return;
     }
 
-    UA_ReadRequest req;
-    UA_ReadRequest_init(&req);
-    UaDeleter<UA_ReadRequest> requestDeleter(&req, UA_ReadRequest_deleteMembers);
-
-    req.nodesToReadSize = nodesToRead.size();
-    req.nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(nodesToRead.size(), &UA_TYPES[UA_TYPES_READVALUEID]));
-    req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
-
-    for (int i = 0; i < nodesToRead.size(); ++i) {
-        UA_ReadValueId_init(&req.nodesToRead[i]);
-        req.nodesToRead[i].attributeId = QOpen62541ValueConverter::toUaAttributeId(nodesToRead.at(i).attribute());
-        req.nodesToRead[i].nodeId = Open62541Utils::nodeIdFromQString(nodesToRead.at(i).nodeId());
-        if (!nodesToRead[i].indexRange().isEmpty())
-            QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(nodesToRead.at(i).indexRange(),
-                                                                       &req.nodesToRead[i].indexRange);
-    }
-
-    UA_ReadResponse res = UA_Client_Service_read(m_uaclient, req);
-    UaDeleter<UA_ReadResponse> responseDeleter(&res, UA_ReadResponse_deleteMembers);
+    const int itemsPerChunk = chunkSize(m_maxNodesPerRead, nodesToRead.size());
+    const quint64 chunkedRequestId = beginChunkedRequest(nodesToRead.size(), itemsPerChunk);
 
-    QOpcUa::UaStatusCode serviceResult = static_cast<QOpcUa::UaStatusCode>(res.responseHeader.serviceResult);
+    for (int offset = 0; offset < nodesToRead.size(); offset += itemsPerChunk) {
+        const QVector<QOpcUaReadItem> chunk = nodesToRead.mid(offset, itemsPerChunk);
 
-    if (serviceResult != QOpcUa::UaStatusCode::Good) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch read failed:" << serviceResult;
-        emit readNodeAttributesFinished(QVector<QOpcUaReadResult>(), serviceResult);
-    } else {
-        QVector<QOpcUaReadResult> ret;
+        UA_ReadRequest *req = UA_ReadRequest_new();
+        req->nodesToReadSize = chunk.size();
+        req->nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(chunk.size(), &UA_TYPES[UA_TYPES_READVALUEID]));
+        req->timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
 
-        for (int i = 0; i < nodesToRead.size(); ++i) {
-            QOpcUaReadResult item;
-            item.setAttribute(nodesToRead.at(i).attribute());
-            item.setNodeId(nodesToRead.at(i).nodeId());
-            item.setIndexRange(nodesToRead.at(i).indexRange());
-            if (static_cast<size_t>(i) < res.resultsSize) {
-                if (res.results[i].hasServerTimestamp)
-                    item.setServerTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime>(&res.results[i].serverTimestamp));
-                if (res.results[i].hasSourceTimestamp)
-                    item.setSourceTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime>(&res.results[i].sourceTimestamp));
-                if (res.results[i].hasValue)
-                    item.setValue(QOpen62541ValueConverter::toQVariant(res.results[i].value));
-                if (res.results[i].hasStatus)
-                    item.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res.results[i].status));
-                else
-                    item.setStatusCode(serviceResult);
-            } else {
-                item.setStatusCode(serviceResult);
-            }
-            ret.push_back(item);
+        for (int i = 0; i < chunk.size(); ++i) {
+            req->nodesToRead[i].attributeId = QOpen62541ValueConverter::toUaAttributeId(chunk.at(i).attribute());
+            req->nodesToRead[i].nodeId = requestNodeId(chunk.at(i).nodeId());
+            if (!chunk[i].indexRange().isEmpty())
+                QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(chunk.at(i).indexRange(),
+                                                                           &req->nodesToRead[i].indexRange);
         }
-        emit readNodeAttributesFinished(ret, serviceResult);
+
+        ServiceRequest request;
+        request.type = ServiceRequest::Type::ReadNodeAttributes;
+        request.readItems = chunk;
+        request.chunkedRequestId = chunkedRequestId;
+        request.chunkOffset = offset;
+        request.request = req;
+        request.requestType = &UA_TYPES[UA_TYPES_READREQUEST];
+        request.responseType = &UA_TYPES[UA_TYPES_READRESPONSE];
+        sendServiceRequest(request);
     }
 }
 
@@ -503,84 +1023,566 @@ void Open62541AsyncBackend::writeNodeAttributes(const QVector<QOpcUaWriteItem> &
         return;
     }
 
-    UA_WriteRequest req;
-    UA_WriteRequest_init(&req);
-    UaDeleter<UA_WriteRequest> requestDeleter(&req, UA_WriteRequest_deleteMembers);
-
-    req.nodesToWriteSize = nodesToWrite.size();
-    req.nodesToWrite = static_cast<UA_WriteValue *>(UA_Array_new(nodesToWrite.size(), &UA_TYPES[UA_TYPES_WRITEVALUE]));
-
-    for (int i = 0; i < nodesToWrite.size(); ++i) {
-        const auto &currentItem = nodesToWrite.at(i);
-        auto &currentUaItem = req.nodesToWrite[i];
-        currentUaItem.attributeId = QOpen62541ValueConverter::toUaAttributeId(currentItem.attribute());
-        currentUaItem.nodeId = Open62541Utils::nodeIdFromQString(currentItem.nodeId());
-        if (currentItem.hasStatusCode()) {
-            currentUaItem.value.status = currentItem.statusCode();
-            currentUaItem.value.hasStatus = UA_TRUE;
-        }
-        if (!currentItem.indexRange().isEmpty())
-            QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(currentItem.indexRange(), &currentUaItem.indexRange);
-        if (!currentItem.value().isNull()) {
-            currentUaItem.value.hasValue = true;
-            currentUaItem.value.value = QOpen62541ValueConverter::toOpen62541Variant(currentItem.value(), currentItem.type());
-        }
-        if (currentItem.sourceTimestamp().isValid()) {
-            QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(currentItem.sourceTimestamp(),
-                                                                           &currentUaItem.value.sourceTimestamp);
-            currentUaItem.value.hasSourceTimestamp = UA_TRUE;
-        }
-        if (currentItem.serverTimestamp().isValid()) {
-            QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(currentItem.serverTimestamp(),
-                                                                           &currentUaItem.value.serverTimestamp);
-            currentUaItem.value.hasServerTimestamp = UA_TRUE;
+    if (m_addressSpaceCache.isOpen()) {
+        for (const auto &item : nodesToWrite) {
+            if (item.attribute() != QOpcUa::NodeAttribute::Value)
+                invalidateCachedNode(item.nodeId());
         }
     }
 
-    UA_WriteResponse res = UA_Client_Service_write(m_uaclient, req);
-    UaDeleter<UA_WriteResponse> responseDeleter(&res, UA_WriteResponse_deleteMembers);
+    const int itemsPerChunk = chunkSize(m_maxNodesPerWrite, nodesToWrite.size());
+    const quint64 chunkedRequestId = beginChunkedRequest(nodesToWrite.size(), itemsPerChunk);
 
-    QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode(res.responseHeader.serviceResult);
+    for (int offset = 0; offset < nodesToWrite.size(); offset += itemsPerChunk) {
+        const QVector<QOpcUaWriteItem> chunk = nodesToWrite.mid(offset, itemsPerChunk);
 
-    if (serviceResult != QOpcUa::UaStatusCode::Good) {
-        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch write failed:" << serviceResult;
-        emit writeNodeAttributesFinished(QVector<QOpcUaWriteResult>(), serviceResult);
-    } else {
-        QVector<QOpcUaWriteResult> ret;
+        UA_WriteRequest *req = UA_WriteRequest_new();
+        req->nodesToWriteSize = chunk.size();
+        req->nodesToWrite = static_cast<UA_WriteValue *>(UA_Array_new(chunk.size(), &UA_TYPES[UA_TYPES_WRITEVALUE]));
 
-        for (int i = 0; i < nodesToWrite.size(); ++i) {
-            QOpcUaWriteResult item;
-            item.setAttribute(nodesToWrite.at(i).attribute());
-            item.setNodeId(nodesToWrite.at(i).nodeId());
-            item.setIndexRange(nodesToWrite.at(i).indexRange());
-            if (static_cast<size_t>(i) < res.resultsSize)
-                item.setStatusCode(QOpcUa::UaStatusCode(res.results[i]));
-            else
-                item.setStatusCode(serviceResult);
-            ret.push_back(item);
+        for (int i = 0; i < chunk.size(); ++i) {
+            const auto &currentItem = chunk.at(i);
+            auto &currentUaItem = req->nodesToWrite[i];
+            currentUaItem.attributeId = QOpen62541ValueConverter::toUaAttributeId(currentItem.attribute());
+            currentUaItem.nodeId = requestNodeId(currentItem.nodeId());
+            if (currentItem.hasStatusCode()) {
+                currentUaItem.value.status = currentItem.statusCode();
+                currentUaItem.value.hasStatus = UA_TRUE;
+            }
+            if (!currentItem.indexRange().isEmpty())
+                QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(currentItem.indexRange(), &currentUaItem.indexRange);
+            if (!currentItem.value().isNull()) {
+                currentUaItem.value.hasValue = true;
+                currentUaItem.value.value = QOpen62541ValueConverter::toOpen62541Variant(currentItem.value(), currentItem.type());
+            }
+            if (currentItem.sourceTimestamp().isValid()) {
+                QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(currentItem.sourceTimestamp(),
+                                                                               &currentUaItem.value.sourceTimestamp);
+                currentUaItem.value.hasSourceTimestamp = UA_TRUE;
+            }
+            if (currentItem.serverTimestamp().isValid()) {
+                QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(currentItem.serverTimestamp(),
+                                                                               &currentUaItem.value.serverTimestamp);
+                currentUaItem.value.hasServerTimestamp = UA_TRUE;
+            }
         }
-        emit writeNodeAttributesFinished(ret, serviceResult);
+
+        ServiceRequest request;
+        request.type = ServiceRequest::Type::WriteNodeAttributes;
+        request.writeItems = chunk;
+        request.chunkedRequestId = chunkedRequestId;
+        request.chunkOffset = offset;
+        request.request = req;
+        request.requestType = &UA_TYPES[UA_TYPES_WRITEREQUEST];
+        request.responseType = &UA_TYPES[UA_TYPES_WRITERESPONSE];
+        sendServiceRequest(request);
     }
 }
 
-void Open62541AsyncBackend::addNode(const QOpcUaAddNodeItem &nodeToAdd)
+void Open62541AsyncBackend::registerNodes(quint64 handle, const QStringList &nodeIds)
 {
-    UA_AddNodesRequest req;
-    UA_AddNodesRequest_init(&req);
-    UaDeleter<UA_AddNodesRequest> requestDeleter(&req, UA_AddNodesRequest_deleteMembers);
-    req.nodesToAddSize = 1;
-    req.nodesToAdd = UA_AddNodesItem_new();
-    UA_AddNodesItem_init(req.nodesToAdd);
+    if (nodeIds.isEmpty()) {
+        emit registerNodesFinished(handle, nodeIds, QStringList(), QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
 
-    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
-                nodeToAdd.parentNodeId(), &req.nodesToAdd->parentNodeId);
+    const quint64 id = m_nextNodeRegistrationId++;
+    NodeRegistration &registration = m_nodeRegistrations[id];
+    registration.handle = handle;
+    registration.nodeIds = nodeIds;
+
+    // Nodes which are already registered or waiting for their alias only get their use count increased
+    QStringList newNodeIds;
+    for (const auto &nodeId : nodeIds) {
+        const bool isNew = !m_registeredNodes.contains(nodeId);
+        RegisteredNode &node = m_registeredNodes[nodeId];
+        if (isNew) {
+            node.registrationId = id;
+            newNodeIds.push_back(nodeId);
+        }
+        ++node.useCount;
+    }
 
-    req.nodesToAdd->referenceTypeId = Open62541Utils::nodeIdFromQString(nodeToAdd.referenceTypeId());
+    if (newNodeIds.isEmpty())
+        finishNodeRegistration(id);
+    else
+        sendRegisterNodesRequests(id, newNodeIds);
+}
 
-    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
-                nodeToAdd.requestedNewNodeId(), &req.nodesToAdd->requestedNewNodeId);
+void Open62541AsyncBackend::unregisterNodes(quint64 handle, const QStringList &nodeIds)
+{
+    // A node destroyed before its registration has finished leaves the release to the registration
+    if (handle != 0) {
+        for (auto &registration : m_nodeRegistrations) {
+            if (registration.handle == handle && !registration.released && registration.nodeIds == nodeIds) {
+                registration.released = true;
+                return;
+            }
+        }
+    }
 
-    QOpen62541ValueConverter::scalarFromQt<UA_QualifiedName, QOpcUaQualifiedName>(
+    const QVector<UA_NodeId> aliases = releaseRegisteredNodes(nodeIds);
+    if (aliases.isEmpty()) {
+        emit unregisterNodesFinished(handle, nodeIds, QOpcUa::UaStatusCode::Good);
+        return;
+    }
+
+    const quint64 id = m_nextNodeRegistrationId++;
+    NodeRegistration &unregistration = m_nodeUnregistrations[id];
+    unregistration.handle = handle;
+    unregistration.nodeIds = nodeIds;
+    sendUnregisterNodesRequests(id, aliases);
+}
+
+/*
+    Registers nodeIds in chunks of at most MaxNodesPerRegisterNodes, the aliases are stored by
+    processRegisterNodesResponse(). reconnect() uses this to renew the aliases of all registered nodes.
+*/
+void Open62541AsyncBackend::sendRegisterNodesRequests(quint64 registrationId, const QStringList &nodeIds)
+{
+    const int itemsPerChunk = chunkSize(m_maxNodesPerRegisterNodes, nodeIds.size());
+
+    // All chunks are counted before the first one is sent, a chunk failing immediately must not finish the registration
+    m_nodeRegistrations[registrationId].pendingChunks = (nodeIds.size() + itemsPerChunk - 1) / itemsPerChunk;
+
+    for (int offset = 0; offset < nodeIds.size(); offset += itemsPerChunk) {
+        const QStringList chunk = nodeIds.mid(offset, itemsPerChunk);
+
+        UA_RegisterNodesRequest *req = UA_RegisterNodesRequest_new();
+        req->nodesToRegisterSize = chunk.size();
+        req->nodesToRegister = static_cast<UA_NodeId *>(UA_Array_new(chunk.size(), &UA_TYPES[UA_TYPES_NODEID]));
+        for (int i = 0; i < chunk.size(); ++i) {
+            req->nodesToRegister[i] = m_nodeIdCache.nodeIdFromQString(chunk.at(i));
+            RegisteredNode &node = m_registeredNodes[chunk.at(i)];
+            node.nodeIdKey = Open62541NodeIdKey(req->nodesToRegister[i]);
+            m_registeredNodeKeys.insert(node.nodeIdKey, chunk.at(i));
+        }
+
+        ServiceRequest request;
+        request.type = ServiceRequest::Type::RegisterNodes;
+        request.chunkedRequestId = registrationId;
+        request.registeredNodeKeys = chunk;
+        request.request = req;
+        request.requestType = &UA_TYPES[UA_TYPES_REGISTERNODESREQUEST];
+        request.responseType = &UA_TYPES[UA_TYPES_REGISTERNODESRESPONSE];
+        sendServiceRequest(request);
+    }
+}
+
+void Open62541AsyncBackend::processRegisterNodesResponse(const ServiceRequest &request, UA_RegisterNodesResponse *res,
+                                                         QOpcUa::UaStatusCode serviceResult)
+{
+    UA_StatusCode status = static_cast<UA_StatusCode>(serviceResult);
+    if (status == UA_STATUSCODE_GOOD && res->registeredNodeIdsSize != static_cast<size_t>(request.registeredNodeKeys.size()))
+        status = UA_STATUSCODE_BADUNEXPECTEDERROR;
+
+    if (status == UA_STATUSCODE_GOOD) {
+        QVector<UA_NodeId> staleAliases;
+        for (int i = 0; i < request.registeredNodeKeys.size(); ++i) {
+            const auto it = m_registeredNodes.find(request.registeredNodeKeys.at(i));
+            UA_NodeId alias;
+            UA_NodeId_copy(&res->registeredNodeIds[i], &alias);
+            // The node has been unregistered while the request was pending
+            if (it == m_registeredNodes.end() || it->registrationId != request.chunkedRequestId) {
+                staleAliases.push_back(alias);
+                continue;
+            }
+            UA_NodeId_deleteMembers(&it->alias);
+            it->alias = alias;
+        }
+        sendUnregisterNodesRequests(0, staleAliases);
+    }
+
+    const auto it = m_nodeRegistrations.find(request.chunkedRequestId);
+    if (it == m_nodeRegistrations.end())
+        return;
+
+    if (status != UA_STATUSCODE_GOOD && it->status == UA_STATUSCODE_GOOD)
+        it->status = status;
+
+    if (--it->pendingChunks > 0)
+        return;
+
+    finishNodeRegistration(it.key());
+}
+
+void Open62541AsyncBackend::finishNodeRegistration(quint64 registrationId)
+{
+    const NodeRegistration registration = m_nodeRegistrations.take(registrationId);
+
+    // Renewed aliases have no requester, nodes without an alias use their node id
+    if (registration.nodeIds.isEmpty()) {
+        if (registration.status != UA_STATUSCODE_GOOD)
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to register nodes again, their node ids are used instead:"
+                                                << static_cast<QOpcUa::UaStatusCode>(registration.status);
+        return;
+    }
+
+    if (registration.status != UA_STATUSCODE_GOOD || registration.released) {
+        // Undo the use counts, chunks registered before the error release their aliases
+        sendUnregisterNodesRequests(0, releaseRegisteredNodes(registration.nodeIds));
+        if (registration.released)
+            return;
+
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to register nodes:" << static_cast<QOpcUa::UaStatusCode>(registration.status);
+        QStringList registeredNodeIds;
+        for (int i = 0; i < registration.nodeIds.size(); ++i)
+            registeredNodeIds.push_back(QString());
+        emit registerNodesFinished(registration.handle, registration.nodeIds, registeredNodeIds,
+                                   static_cast<QOpcUa::UaStatusCode>(registration.status));
+        return;
+    }
+
+    QStringList registeredNodeIds;
+    registeredNodeIds.reserve(registration.nodeIds.size());
+    for (const auto &nodeId : registration.nodeIds) {
+        const RegisteredNode node = m_registeredNodes.value(nodeId);
+        registeredNodeIds.push_back(UA_NodeId_isNull(&node.alias) ? nodeId : Open62541Utils::nodeIdToQString(node.alias));
+    }
+
+    emit registerNodesFinished(registration.handle, registration.nodeIds, registeredNodeIds, QOpcUa::UaStatusCode::Good);
+}
+
+/*
+    Decreases the use counts of nodeIds and removes the nodes which are no longer used.
+    Returns the aliases of the removed nodes, the caller takes ownership.
+*/
+QVector<UA_NodeId> Open62541AsyncBackend::releaseRegisteredNodes(const QStringList &nodeIds)
+{
+    QVector<UA_NodeId> aliases;
+    for (const auto &nodeId : nodeIds) {
+        auto it = m_registeredNodes.find(nodeId);
+        if (it == m_registeredNodes.end() || --it->useCount > 0)
+            continue;
+        if (!UA_NodeId_isNull(&it->alias))
+            aliases.push_back(it->alias);
+        if (m_registeredNodeKeys.value(it->nodeIdKey) == nodeId)
+            m_registeredNodeKeys.remove(it->nodeIdKey);
+        m_registeredNodes.erase(it);
+    }
+    return aliases;
+}
+
+/*
+    Releases aliases in chunks of at most MaxNodesPerRegisterNodes and takes ownership of them.
+    Releases without an unregistration id are not reported.
+*/
+void Open62541AsyncBackend::sendUnregisterNodesRequests(quint64 unregistrationId, const QVector<UA_NodeId> &aliases)
+{
+    if (aliases.isEmpty())
+        return;
+
+    const int itemsPerChunk = chunkSize(m_maxNodesPerRegisterNodes, aliases.size());
+
+    if (unregistrationId)
+        m_nodeUnregistrations[unregistrationId].pendingChunks = (aliases.size() + itemsPerChunk - 1) / itemsPerChunk;
+
+    for (int offset = 0; offset < aliases.size(); offset += itemsPerChunk) {
+        const int count = qMin(itemsPerChunk, aliases.size() - offset);
+
+        UA_UnregisterNodesRequest *req = UA_UnregisterNodesRequest_new();
+        req->nodesToUnregisterSize = count;
+        req->nodesToUnregister = static_cast<UA_NodeId *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_NODEID]));
+        std::copy(aliases.constBegin() + offset, aliases.constBegin() + offset + count, req->nodesToUnregister);
+
+        ServiceRequest request;
+        request.type = ServiceRequest::Type::UnregisterNodes;
+        request.chunkedRequestId = unregistrationId;
+        request.request = req;
+        request.requestType = &UA_TYPES[UA_TYPES_UNREGISTERNODESREQUEST];
+        request.responseType = &UA_TYPES[UA_TYPES_UNREGISTERNODESRESPONSE];
+        sendServiceRequest(request);
+    }
+}
+
+void Open62541AsyncBackend::processUnregisterNodesResponse(const ServiceRequest &request, QOpcUa::UaStatusCode serviceResult)
+{
+    if (serviceResult != QOpcUa::UaStatusCode::Good)
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to unregister nodes:" << serviceResult;
+
+    const auto it = m_nodeUnregistrations.find(request.chunkedRequestId);
+    if (it == m_nodeUnregistrations.end())
+        return;
+
+    if (serviceResult != QOpcUa::UaStatusCode::Good && it->status == UA_STATUSCODE_GOOD)
+        it->status = static_cast<UA_StatusCode>(serviceResult);
+
+    if (--it->pendingChunks > 0)
+        return;
+
+    const NodeRegistration unregistration = it.value();
+    m_nodeUnregistrations.erase(it);
+    emit unregisterNodesFinished(unregistration.handle, unregistration.nodeIds,
+                                 static_cast<QOpcUa::UaStatusCode>(unregistration.status));
+}
+
+void Open62541AsyncBackend::clearRegisteredNodes()
+{
+    for (auto &node : m_registeredNodes)
+        UA_NodeId_deleteMembers(&node.alias);
+    m_registeredNodes.clear();
+    m_registeredNodeKeys.clear();
+    m_nodeRegistrations.clear();
+    m_nodeUnregistrations.clear();
+}
+
+/*
+    Returns the node id to be sent to the server for nodeId, the alias if the node has been registered.
+*/
+UA_NodeId Open62541AsyncBackend::requestNodeId(const QString &nodeId)
+{
+    const auto it = m_registeredNodes.constFind(nodeId);
+    if (it == m_registeredNodes.constEnd() || UA_NodeId_isNull(&it->alias))
+        return m_nodeIdCache.nodeIdFromQString(nodeId);
+
+    UA_NodeId alias;
+    UA_NodeId_copy(&it->alias, &alias);
+    return alias;
+}
+
+/*
+    Replaces the node id of a QOpcUaNode by its alias if the node has been registered.
+    The string conversion is only necessary if there are registered nodes at all.
+*/
+void Open62541AsyncBackend::substituteRegisteredNodeId(UA_NodeId *id) const
+{
+    if (m_registeredNodes.isEmpty())
+        return;
+
+    // Numeric node ids are looked up without allocating, string ids are copied once
+    const auto key = m_registeredNodeKeys.constFind(Open62541NodeIdKey(*id));
+    if (key == m_registeredNodeKeys.constEnd())
+        return;
+
+    const auto it = m_registeredNodes.constFind(key.value());
+    if (it == m_registeredNodes.constEnd() || UA_NodeId_isNull(&it->alias))
+        return;
+
+    UA_NodeId_deleteMembers(id);
+    UA_NodeId_copy(&it->alias, id);
+}
+
+#ifdef UA_ENABLE_HISTORIZING
+/*
+    Requests for more nodes than the server accepts in a single HistoryRead call are split
+    into chunks which are sent in parallel. Each chunk continues its nodes independently.
+*/
+void Open62541AsyncBackend::readHistoryData(const QOpcUaHistoryReadRequest &request)
+{
+    const QStringList nodeIds = request.nodeIds();
+    if (nodeIds.isEmpty()) {
+        emit historyReadFinished(request, QOpcUa::UaStatusCode::BadNothingToDo);
+        return;
+    }
+
+    const int itemsPerChunk = chunkSize(m_maxNodesPerHistoryReadData, nodeIds.size());
+    const quint64 id = m_nextHistoryReadId++;
+
+    // All chunks are counted before the first one is sent, a chunk failing immediately must not finish the read
+    HistoryRead &read = m_historyReads[id];
+    read.request = request;
+    read.pendingRequests = (nodeIds.size() + itemsPerChunk - 1) / itemsPerChunk;
+
+    for (int offset = 0; offset < nodeIds.size(); offset += itemsPerChunk) {
+        const QStringList chunk = nodeIds.mid(offset, itemsPerChunk);
+        sendHistoryReadRequest(id, createHistoryReadRequest(request, chunk), chunk);
+    }
+}
+
+static UA_DateTime historyReadTimestamp(const QDateTime &timestamp)
+{
+    // An invalid timestamp leaves the bound unspecified
+    UA_DateTime result = 0;
+    if (timestamp.isValid())
+        QOpen62541ValueConverter::scalarFromQt<UA_DateTime, QDateTime>(timestamp, &result);
+    return result;
+}
+
+UA_HistoryReadRequest *Open62541AsyncBackend::createHistoryReadRequest(const QOpcUaHistoryReadRequest &request,
+                                                                       const QStringList &nodeIds)
+{
+    UA_HistoryReadRequest *uaRequest = UA_HistoryReadRequest_new();
+    uaRequest->timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+    uaRequest->nodesToRead = static_cast<UA_HistoryReadValueId *>(
+                UA_Array_new(nodeIds.size(), &UA_TYPES[UA_TYPES_HISTORYREADVALUEID]));
+    uaRequest->nodesToReadSize = nodeIds.size();
+    for (int i = 0; i < nodeIds.size(); ++i)
+        uaRequest->nodesToRead[i].nodeId = requestNodeId(nodeIds.at(i));
+
+    UA_ExtensionObject &details = uaRequest->historyReadDetails;
+    details.encoding = UA_EXTENSIONOBJECT_DECODED;
+
+    switch (request.type()) {
+    case QOpcUaHistoryReadRequest::Type::RawModified: {
+        UA_ReadRawModifiedDetails *raw = UA_ReadRawModifiedDetails_new();
+        raw->isReadModified = request.readModified();
+        raw->startTime = historyReadTimestamp(request.startTimestamp());
+        raw->endTime = historyReadTimestamp(request.endTimestamp());
+        raw->numValuesPerNode = request.numValuesPerNode();
+        raw->returnBounds = request.returnBounds();
+        details.content.decoded.type = &UA_TYPES[UA_TYPES_READRAWMODIFIEDDETAILS];
+        details.content.decoded.data = raw;
+        break;
+    }
+    case QOpcUaHistoryReadRequest::Type::Processed: {
+        UA_ReadProcessedDetails *processed = UA_ReadProcessedDetails_new();
+        processed->startTime = historyReadTimestamp(request.startTimestamp());
+        processed->endTime = historyReadTimestamp(request.endTimestamp());
+        processed->processingInterval = request.processingInterval();
+        processed->aggregateType = UA_NodeId_new();
+        *processed->aggregateType = m_nodeIdCache.nodeIdFromQString(request.aggregateType());
+        processed->aggregateTypeSize = 1;
+        processed->aggregateConfiguration.useServerCapabilitiesDefaults = true;
+        details.content.decoded.type = &UA_TYPES[UA_TYPES_READPROCESSEDDETAILS];
+        details.content.decoded.data = processed;
+        break;
+    }
+    case QOpcUaHistoryReadRequest::Type::AtTime: {
+        UA_ReadAtTimeDetails *atTime = UA_ReadAtTimeDetails_new();
+        const QVector<QDateTime> timestamps = request.requestedTimestamps();
+        if (!timestamps.isEmpty()) {
+            atTime->reqTimes = static_cast<UA_DateTime *>(UA_Array_new(timestamps.size(), &UA_TYPES[UA_TYPES_DATETIME]));
+            atTime->reqTimesSize = timestamps.size();
+            for (int i = 0; i < timestamps.size(); ++i)
+                atTime->reqTimes[i] = historyReadTimestamp(timestamps.at(i));
+        }
+        atTime->useSimpleBounds = request.useSimpleBounds();
+        details.content.decoded.type = &UA_TYPES[UA_TYPES_READATTIMEDETAILS];
+        details.content.decoded.data = atTime;
+        break;
+    }
+    }
+
+    return uaRequest;
+}
+
+void Open62541AsyncBackend::sendHistoryReadRequest(quint64 id, UA_HistoryReadRequest *request, const QStringList &nodeIds)
+{
+    ServiceRequest serviceRequest;
+    serviceRequest.type = ServiceRequest::Type::HistoryRead;
+    serviceRequest.handle = id;
+    serviceRequest.request = request;
+    serviceRequest.requestType = &UA_TYPES[UA_TYPES_HISTORYREADREQUEST];
+    serviceRequest.responseType = &UA_TYPES[UA_TYPES_HISTORYREADRESPONSE];
+    serviceRequest.historyNodeIds = nodeIds;
+    sendServiceRequest(serviceRequest);
+}
+
+static qint64 historyDataTimestamp(bool hasTimestamp, UA_DateTime timestamp)
+{
+    if (!hasTimestamp)
+        return QOpcUaHistoryData::InvalidTimestamp;
+    return (timestamp - UA_DATETIME_UNIX_EPOCH) / UA_DATETIME_MSEC;
+}
+
+/*
+    Reports the values of a history read response as soon as they arrive and continues
+    all nodes with a continuation point in a single follow-up request.
+*/
+void Open62541AsyncBackend::processHistoryReadResponse(const ServiceRequest &request, UA_HistoryReadResponse *res,
+                                                       QOpcUa::UaStatusCode serviceResult)
+{
+    auto it = m_historyReads.find(request.handle);
+    if (it == m_historyReads.end())
+        return;
+
+    --it->pendingRequests;
+
+    if (serviceResult != QOpcUa::UaStatusCode::Good) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "History read request failed:" << serviceResult;
+        it->status = serviceResult;
+    } else {
+        const size_t resultsSize = qMin(res->resultsSize, static_cast<size_t>(request.historyNodeIds.size()));
+        if (resultsSize < static_cast<size_t>(request.historyNodeIds.size()))
+            it->status = QOpcUa::UaStatusCode::BadUnexpectedError;
+
+        QVector<QOpcUaHistoryData> data;
+        data.reserve(static_cast<int>(resultsSize));
+        QStringList continuedNodeIds;
+        QVector<size_t> continued;
+
+        for (size_t i = 0; i < resultsSize; ++i) {
+            const UA_HistoryReadResult &result = res->results[i];
+
+            QOpcUaHistoryData entry;
+            entry.setNodeId(request.historyNodeIds.at(static_cast<int>(i)));
+            entry.setStatusCode(static_cast<QOpcUa::UaStatusCode>(result.statusCode));
+
+            if (result.historyData.encoding >= UA_EXTENSIONOBJECT_DECODED &&
+                    result.historyData.content.decoded.type == &UA_TYPES[UA_TYPES_HISTORYDATA]) {
+                const auto history = static_cast<const UA_HistoryData *>(result.historyData.content.decoded.data);
+                const int count = static_cast<int>(history->dataValuesSize);
+
+                QVector<qint64> sourceTimestamps(count);
+                QVector<qint64> serverTimestamps(count);
+                QVector<QOpcUa::UaStatusCode> statusCodes(count);
+                for (int j = 0; j < count; ++j) {
+                    const UA_DataValue &value = history->dataValues[j];
+                    sourceTimestamps[j] = historyDataTimestamp(value.hasSourceTimestamp, value.sourceTimestamp);
+                    serverTimestamps[j] = historyDataTimestamp(value.hasServerTimestamp, value.serverTimestamp);
+                    statusCodes[j] = static_cast<QOpcUa::UaStatusCode>(value.hasStatus ? value.status : UA_STATUSCODE_GOOD);
+                }
+
+                entry.setValues(QOpen62541ValueConverter::seriesToQVariant(history->dataValues, history->dataValuesSize,
+                                                                           m_conversionFlags));
+                entry.setSourceTimestamps(sourceTimestamps);
+                entry.setServerTimestamps(serverTimestamps);
+                entry.setStatusCodes(statusCodes);
+            }
+
+            data.push_back(entry);
+
+            if (result.continuationPoint.length) {
+                continued.push_back(i);
+                continuedNodeIds.push_back(entry.nodeId());
+            }
+        }
+
+        if (!data.isEmpty())
+            emit historyDataReceived(it->request, data);
+
+        if (!continued.isEmpty()) {
+            UA_HistoryReadRequest *next = createHistoryReadRequest(it->request, continuedNodeIds);
+            for (int i = 0; i < continued.size(); ++i)
+                UA_ByteString_copy(&res->results[continued.at(i)].continuationPoint, &next->nodesToRead[i].continuationPoint);
+
+            ++it->pendingRequests;
+            sendHistoryReadRequest(request.handle, next, continuedNodeIds);
+
+            // The follow-up request may already have failed and finished the read
+            it = m_historyReads.find(request.handle);
+            if (it == m_historyReads.end())
+                return;
+        }
+    }
+
+    if (it->pendingRequests > 0)
+        return;
+
+    const HistoryRead read = it.value();
+    m_historyReads.erase(it);
+    emit historyReadFinished(read.request, read.status);
+}
+#endif
+
+void Open62541AsyncBackend::addNode(const QOpcUaAddNodeItem &nodeToAdd)
+{
+    UA_AddNodesRequest req;
+    UA_AddNodesRequest_init(&req);
+    UaDeleter<UA_AddNodesRequest> requestDeleter(&req, UA_AddNodesRequest_deleteMembers);
+    req.nodesToAddSize = 1;
+    req.nodesToAdd = UA_AddNodesItem_new();
+    UA_AddNodesItem_init(req.nodesToAdd);
+
+    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
+                nodeToAdd.parentNodeId(), &req.nodesToAdd->parentNodeId);
+
+    req.nodesToAdd->referenceTypeId = Open62541Utils::nodeIdFromQString(nodeToAdd.referenceTypeId());
+
+    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
+                nodeToAdd.requestedNewNodeId(), &req.nodesToAdd->requestedNewNodeId);
+
+    QOpen62541ValueConverter::scalarFromQt<UA_QualifiedName, QOpcUaQualifiedName>(
                 nodeToAdd.browseName(), &req.nodesToAdd->browseName);
 
     req.nodesToAdd->nodeClass = static_cast<UA_NodeClass>(nodeToAdd.nodeClass());
@@ -592,6 +1594,8 @@ void Open62541AsyncBackend::addNode(const QOpcUaAddNodeItem &nodeToAdd)
         QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
                     nodeToAdd.typeDefinition(), &req.nodesToAdd->typeDefinition);
 
+    invalidateCachedNode(nodeToAdd.parentNodeId().nodeId());
+
     UA_AddNodesResponse res = UA_Client_Service_addNodes(m_uaclient, req);
     UaDeleter<UA_AddNodesResponse> responseDeleter(&res, UA_AddNodesResponse_deleteMembers);
 
@@ -619,6 +1623,9 @@ void Open62541AsyncBackend::deleteNode(const QString &nodeId, bool deleteTargetR
 
     UA_StatusCode res = UA_Client_deleteNode(m_uaclient, id, deleteTargetReferences);
 
+    // The nodes referencing the deleted node are unknown, none of the cached browse results can be trusted
+    clearAddressSpaceCache();
+
     QOpcUa::UaStatusCode resultStatus = static_cast<QOpcUa::UaStatusCode>(res);
 
     if (resultStatus != QOpcUa::UaStatusCode::Good) {
@@ -634,122 +1641,759 @@ void Open62541AsyncBackend::addReference(const QOpcUaAddReferenceItem &reference
     UA_ExpandedNodeId_init(&target);
     UaDeleter<UA_ExpandedNodeId> nodeIdDeleter(&target, UA_ExpandedNodeId_deleteMembers);
 
-    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
-                referenceToAdd.targetNodeId(), &target);
+    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
+                referenceToAdd.targetNodeId(), &target);
+
+    UA_String serverUri;
+    UaDeleter<UA_String> serverUriDeleter(&serverUri, UA_String_deleteMembers);
+    QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(
+                referenceToAdd.targetServerUri(), &serverUri);
+
+    UA_NodeClass nodeClass = static_cast<UA_NodeClass>(referenceToAdd.targetNodeClass());
+
+    invalidateCachedNode(referenceToAdd.sourceNodeId());
+    invalidateCachedNode(referenceToAdd.targetNodeId().nodeId());
+
+    UA_StatusCode res = UA_Client_addReference(m_uaclient,
+                                               Open62541Utils::nodeIdFromQString(referenceToAdd.sourceNodeId()),
+                                               Open62541Utils::nodeIdFromQString(referenceToAdd.referenceTypeId()),
+                                               referenceToAdd.isForwardReference(), serverUri, target, nodeClass);
+
+    QOpcUa::UaStatusCode statusCode = static_cast<QOpcUa::UaStatusCode>(res);
+    if (res != UA_STATUSCODE_GOOD)
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to add reference from" << referenceToAdd.sourceNodeId() << "to"
+                                            << referenceToAdd.targetNodeId().nodeId() << ":" << statusCode;
+
+    emit addReferenceFinished(referenceToAdd.sourceNodeId(), referenceToAdd.referenceTypeId(),
+                              referenceToAdd.targetNodeId(),
+                              referenceToAdd.isForwardReference(), statusCode);
+}
+
+void Open62541AsyncBackend::deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete)
+{
+    UA_ExpandedNodeId target;
+    UA_ExpandedNodeId_init(&target);
+    UaDeleter<UA_ExpandedNodeId> targetDeleter(&target, UA_ExpandedNodeId_deleteMembers);
+    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
+                referenceToDelete.targetNodeId(), &target);
+
+    invalidateCachedNode(referenceToDelete.sourceNodeId());
+    invalidateCachedNode(referenceToDelete.targetNodeId().nodeId());
+
+    UA_StatusCode res = UA_Client_deleteReference(m_uaclient,
+                                                  Open62541Utils::nodeIdFromQString(referenceToDelete.sourceNodeId()),
+                                                  Open62541Utils::nodeIdFromQString(referenceToDelete.referenceTypeId()),
+                                                  referenceToDelete.isForwardReference(),
+                                                  target, referenceToDelete.deleteBidirectional());
+
+    QOpcUa::UaStatusCode statusCode = static_cast<QOpcUa::UaStatusCode>(res);
+    if (res != UA_STATUSCODE_GOOD)
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to delete reference from" << referenceToDelete.sourceNodeId() << "to"
+                                            << referenceToDelete.targetNodeId().nodeId() << ":" << statusCode;
+
+    emit deleteReferenceFinished(referenceToDelete.sourceNodeId(), referenceToDelete.referenceTypeId(),
+                                 referenceToDelete.targetNodeId(),
+                                 referenceToDelete.isForwardReference(), statusCode);
+}
+
+static void convertBrowseResult(UA_BrowseResult *src, quint32 referencesSize, QVector<QOpcUaReferenceDescription> &dst)
+{
+    if (!src)
+        return;
+
+    for (size_t i = 0; i < referencesSize; ++i) {
+        QOpcUaReferenceDescription temp;
+        temp.setTargetNodeId(QOpen62541ValueConverter::scalarToQt<QOpcUaExpandedNodeId>(&src->references[i].nodeId));
+        temp.setTypeDefinition(QOpen62541ValueConverter::scalarToQt<QOpcUaExpandedNodeId>(&src->references[i].typeDefinition));
+        temp.setRefTypeId(Open62541Utils::nodeIdToQString(src->references[i].referenceTypeId));
+        temp.setNodeClass(static_cast<QOpcUa::NodeClass>(src->references[i].nodeClass));
+        temp.setBrowseName(QOpen62541ValueConverter::scalarToQt<QOpcUaQualifiedName, UA_QualifiedName>(&src->references[i].browseName));
+        temp.setDisplayName(QOpen62541ValueConverter::scalarToQt<QOpcUaLocalizedText, UA_LocalizedText>(&src->references[i].displayName));
+        temp.setIsForwardReference(src->references[i].isForward);
+        dst.push_back(temp);
+    }
+}
+
+void Open62541AsyncBackend::browse(quint64 handle, UA_NodeId id, const QOpcUaBrowseRequest &request)
+{
+    ServiceRequest serviceRequest;
+
+    if (m_addressSpaceCache.isOpen()) {
+        serviceRequest.cacheNodeId = Open62541Utils::nodeIdToQString(id);
+        serviceRequest.cacheKey = Open62541AddressSpaceCache::browseKey(request);
+
+        QVector<QOpcUaReferenceDescription> references;
+        if (m_addressSpaceCache.references(serviceRequest.cacheNodeId, serviceRequest.cacheKey, &references)) {
+            UA_NodeId_deleteMembers(&id);
+            emit browseFinished(handle, references, QOpcUa::UaStatusCode::Good);
+            return;
+        }
+    }
+
+    UA_BrowseRequest *uaRequest = UA_BrowseRequest_new();
+
+    uaRequest->nodesToBrowse = UA_BrowseDescription_new();
+    uaRequest->nodesToBrowseSize = 1;
+    uaRequest->nodesToBrowse->browseDirection = static_cast<UA_BrowseDirection>(request.browseDirection());
+    uaRequest->nodesToBrowse->includeSubtypes = request.includeSubtypes();
+    uaRequest->nodesToBrowse->nodeClassMask = static_cast<quint32>(request.nodeClassMask());
+    uaRequest->nodesToBrowse->nodeId = id;
+    uaRequest->nodesToBrowse->resultMask = UA_BROWSERESULTMASK_ALL;
+    uaRequest->nodesToBrowse->referenceTypeId = m_nodeIdCache.nodeIdFromQString(request.referenceTypeId());
+    uaRequest->requestedMaxReferencesPerNode = 0; // Let the server choose a maximum value
+
+    serviceRequest.type = ServiceRequest::Type::Browse;
+    serviceRequest.handle = handle;
+    serviceRequest.request = uaRequest;
+    serviceRequest.requestType = &UA_TYPES[UA_TYPES_BROWSEREQUEST];
+    serviceRequest.responseType = &UA_TYPES[UA_TYPES_BROWSERESPONSE];
+    sendServiceRequest(serviceRequest);
+}
+
+void Open62541AsyncBackend::crawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request, int maxDepth)
+{
+    // A new crawl replaces a crawl which has not been finished yet
+    clearCrawlFrontier();
+    const quint64 id = m_crawl.id + 1;
+    m_crawl = Crawl();
+    m_crawl.id = id;
+    m_crawl.active = true;
+    m_crawl.request = request;
+    m_crawl.maxDepth = maxDepth;
+
+    // A maximum depth of 0 doesn't follow any references, the crawl is finished immediately
+    for (const auto &nodeId : startNodeIds) {
+        if (maxDepth == 0 || m_crawl.visited.contains(nodeId))
+            continue;
+
+        m_crawl.visited.insert(nodeId);
+        const UA_NodeId uaNodeId = m_nodeIdCache.nodeIdFromQString(nodeId);
+        if (UA_NodeId_isNull(&uaNodeId)) {
+            m_crawl.status = QOpcUa::UaStatusCode::BadNodeIdInvalid;
+            continue;
+        }
+        m_crawl.frontier.enqueue({uaNodeId, nodeId, 0});
+    }
+
+    continueCrawl();
+}
+
+/*
+    Sends browse requests for the frontier of the current crawl until the maximum number
+    of crawl requests is in flight. The frontier is spread evenly over the free slots,
+    so a small frontier is browsed in parallel instead of in a single request.
+*/
+void Open62541AsyncBackend::continueCrawl()
+{
+    if (!m_crawl.active)
+        return;
+
+    while (!m_crawl.frontier.isEmpty() &&
+           (m_crawlRequestsInFlight <= 0 || m_crawl.requestsInFlight < m_crawlRequestsInFlight)) {
+        const int freeSlots = m_crawlRequestsInFlight > 0 ? m_crawlRequestsInFlight - m_crawl.requestsInFlight : 1;
+        const int batchSize = chunkSize(m_maxNodesPerBrowse, (m_crawl.frontier.size() + freeSlots - 1) / freeSlots);
+
+        UA_BrowseRequest *uaRequest = UA_BrowseRequest_new();
+        uaRequest->nodesToBrowse = static_cast<UA_BrowseDescription *>(
+                    UA_Array_new(batchSize, &UA_TYPES[UA_TYPES_BROWSEDESCRIPTION]));
+        uaRequest->nodesToBrowseSize = batchSize;
+        uaRequest->requestedMaxReferencesPerNode = 0; // Let the server choose a maximum value
+
+        ServiceRequest serviceRequest;
+        serviceRequest.type = ServiceRequest::Type::Crawl;
+        serviceRequest.handle = m_crawl.id;
+        serviceRequest.request = uaRequest;
+        serviceRequest.requestType = &UA_TYPES[UA_TYPES_BROWSEREQUEST];
+        serviceRequest.responseType = &UA_TYPES[UA_TYPES_BROWSERESPONSE];
+        serviceRequest.crawlNodes.reserve(batchSize);
+
+        for (int i = 0; i < batchSize; ++i) {
+            const CrawlNode node = m_crawl.frontier.dequeue();
+            UA_BrowseDescription &desc = uaRequest->nodesToBrowse[i];
+            desc.browseDirection = static_cast<UA_BrowseDirection>(m_crawl.request.browseDirection());
+            desc.includeSubtypes = m_crawl.request.includeSubtypes();
+            desc.nodeClassMask = static_cast<quint32>(m_crawl.request.nodeClassMask());
+            desc.nodeId = node.nodeId; // Ownership is transferred to the request
+            desc.resultMask = UA_BROWSERESULTMASK_ALL;
+            desc.referenceTypeId = m_nodeIdCache.nodeIdFromQString(m_crawl.request.referenceTypeId());
+            serviceRequest.crawlNodes.push_back(qMakePair(node.nodeIdString, node.depth));
+        }
+
+        ++m_crawl.requestsInFlight;
+        sendServiceRequest(serviceRequest);
+    }
+
+    if (m_crawl.active && m_crawl.frontier.isEmpty() && !m_crawl.requestsInFlight) {
+        m_crawl.active = false;
+        emit crawlFinished(m_crawl.status);
+    }
+}
+
+/*
+    Reports the references of a crawl response, adds the unknown target nodes to the frontier
+    and continues all nodes with a continuation point in a single BrowseNext request.
+    Nodes which can't be browsed are skipped. If a request fails as a whole, the crawl is aborted:
+    the frontier is dropped, no more nodes are added and the continuation points of the responses
+    still in flight are released. It finishes when all of these responses have arrived.
+*/
+void Open62541AsyncBackend::processCrawlResponse(const ServiceRequest &request, UA_BrowseResponse *res,
+                                                 QOpcUa::UaStatusCode serviceResult)
+{
+    // Responses of a replaced crawl are not continued, the server still holds their continuation points
+    if (!m_crawl.active || request.handle != m_crawl.id) {
+        releaseContinuationPoints(res);
+        return;
+    }
+
+    --m_crawl.requestsInFlight;
+
+    if (serviceResult != QOpcUa::UaStatusCode::Good) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Crawl request failed:" << serviceResult;
+        m_crawl.status = serviceResult;
+        m_crawl.aborted = true;
+        clearCrawlFrontier();
+        continueCrawl();
+        return;
+    }
+
+    QStringList sourceNodeIds;
+    QVector<QOpcUaReferenceDescription> references;
+    QVector<size_t> continued;
+
+    ServiceRequest next;
+    next.type = ServiceRequest::Type::Crawl;
+    next.handle = m_crawl.id;
+    next.requestType = &UA_TYPES[UA_TYPES_BROWSENEXTREQUEST];
+    next.responseType = &UA_TYPES[UA_TYPES_BROWSENEXTRESPONSE];
+
+    const size_t resultsSize = qMin(res->resultsSize, static_cast<size_t>(request.crawlNodes.size()));
+    if (resultsSize < static_cast<size_t>(request.crawlNodes.size())) {
+        m_crawl.status = QOpcUa::UaStatusCode::BadUnexpectedError;
+        m_crawl.aborted = true;
+    }
+
+    for (size_t i = 0; i < resultsSize; ++i) {
+        const UA_BrowseResult &result = res->results[i];
+        const auto &source = request.crawlNodes.at(static_cast<int>(i));
+
+        if (result.statusCode != UA_STATUSCODE_GOOD) {
+            m_crawl.status = static_cast<QOpcUa::UaStatusCode>(result.statusCode);
+            continue;
+        }
+
+        const bool followReferences = m_crawl.maxDepth < 0 || source.second + 1 < m_crawl.maxDepth;
+        const int offset = references.size();
+        convertBrowseResult(&res->results[i], result.referencesSize, references);
+
+        for (size_t j = 0; j < result.referencesSize; ++j) {
+            sourceNodeIds.push_back(source.first);
+
+            // Nodes on other servers can't be browsed with this connection
+            const UA_ExpandedNodeId &target = result.references[j].nodeId;
+            if (!followReferences || m_crawl.aborted || target.serverIndex || target.namespaceUri.length)
+                continue;
+
+            const QString targetId = references.at(offset + static_cast<int>(j)).targetNodeId().nodeId();
+            if (m_crawl.visited.contains(targetId))
+                continue;
+
+            m_crawl.visited.insert(targetId);
+            CrawlNode node;
+            UA_NodeId_copy(&target.nodeId, &node.nodeId);
+            node.nodeIdString = targetId;
+            node.depth = source.second + 1;
+            m_crawl.frontier.enqueue(node);
+        }
+
+        if (result.continuationPoint.length) {
+            continued.push_back(i);
+            next.crawlNodes.push_back(source);
+        }
+    }
+
+    if (!references.isEmpty())
+        emit crawlReferencesReceived(sourceNodeIds, references);
+
+    if (m_crawl.aborted) {
+        clearCrawlFrontier();
+        releaseContinuationPoints(res);
+    } else if (!continued.isEmpty()) {
+        UA_BrowseNextRequest *nextRequest = UA_BrowseNextRequest_new();
+        nextRequest->continuationPoints = static_cast<UA_ByteString *>(
+                    UA_Array_new(continued.size(), &UA_TYPES[UA_TYPES_BYTESTRING]));
+        nextRequest->continuationPointsSize = continued.size();
+        for (int i = 0; i < continued.size(); ++i)
+            UA_ByteString_copy(&res->results[continued.at(i)].continuationPoint, &nextRequest->continuationPoints[i]);
+
+        next.request = nextRequest;
+        ++m_crawl.requestsInFlight;
+        sendServiceRequest(next);
+    }
+
+    continueCrawl();
+}
+
+/*
+    Releases the continuation points of a browse response which is not continued.
+    The response of the release request is ignored.
+*/
+void Open62541AsyncBackend::releaseContinuationPoints(const UA_BrowseResponse *res)
+{
+    QVector<const UA_ByteString *> continuationPoints;
+    for (size_t i = 0; i < res->resultsSize; ++i) {
+        if (res->results[i].continuationPoint.length)
+            continuationPoints.push_back(&res->results[i].continuationPoint);
+    }
+
+    if (continuationPoints.isEmpty())
+        return;
+
+    UA_BrowseNextRequest *releaseRequest = UA_BrowseNextRequest_new();
+    releaseRequest->releaseContinuationPoints = true;
+    releaseRequest->continuationPoints = static_cast<UA_ByteString *>(
+                UA_Array_new(continuationPoints.size(), &UA_TYPES[UA_TYPES_BYTESTRING]));
+    releaseRequest->continuationPointsSize = continuationPoints.size();
+    for (int i = 0; i < continuationPoints.size(); ++i)
+        UA_ByteString_copy(continuationPoints.at(i), &releaseRequest->continuationPoints[i]);
+
+    ServiceRequest request;
+    request.type = ServiceRequest::Type::ReleaseContinuationPoints;
+    request.request = releaseRequest;
+    request.requestType = &UA_TYPES[UA_TYPES_BROWSENEXTREQUEST];
+    request.responseType = &UA_TYPES[UA_TYPES_BROWSENEXTRESPONSE];
+    sendServiceRequest(request);
+}
+
+void Open62541AsyncBackend::clearCrawlFrontier()
+{
+    for (auto &node : m_crawl.frontier)
+        UA_NodeId_deleteMembers(&node.nodeId);
+    m_crawl.frontier.clear();
+}
+
+static void asyncServiceCallback(UA_Client *client, void *userdata, UA_UInt32 requestId, void *response)
+{
+    Q_UNUSED(client);
+    static_cast<Open62541AsyncBackend *>(userdata)->handleServiceResponse(requestId, response);
+}
+
+void Open62541AsyncBackend::sendServiceRequest(const ServiceRequest &request)
+{
+    if (m_maxRequestsInFlight > 0 && m_pendingRequests.size() >= m_maxRequestsInFlight) {
+        m_queuedRequests.enqueue(request);
+        return;
+    }
+
+    dispatchServiceRequest(request);
+}
+
+void Open62541AsyncBackend::dispatchServiceRequest(ServiceRequest request)
+{
+    UA_UInt32 requestId = 0;
+    const UA_StatusCode result = m_uaclient ?
+                UA_Client_sendAsyncRequest(m_uaclient, request.request, request.requestType, &asyncServiceCallback,
+                                           request.responseType, this, &requestId) :
+                UA_STATUSCODE_BADSERVERNOTCONNECTED;
+
+    // The request has been encoded into the send buffer, the response is correlated by the request id
+    UA_delete(request.request, request.requestType);
+    request.request = nullptr;
+
+    if (result != UA_STATUSCODE_GOOD) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to send service request:" << static_cast<QOpcUa::UaStatusCode>(result);
+        finishServiceRequest(request, result);
+        return;
+    }
+
+    m_pendingRequests.insert(requestId, request);
+    enableResponseProcessing();
+}
+
+void Open62541AsyncBackend::dispatchQueuedRequests()
+{
+    while (!m_queuedRequests.isEmpty() &&
+           (m_maxRequestsInFlight <= 0 || m_pendingRequests.size() < m_maxRequestsInFlight))
+        dispatchServiceRequest(m_queuedRequests.dequeue());
+}
+
+void Open62541AsyncBackend::handleServiceResponse(UA_UInt32 requestId, void *response)
+{
+    const auto it = m_pendingRequests.find(requestId);
+    if (it == m_pendingRequests.end())
+        return; // The request has already been finished by abortServiceRequests()
+
+    const ServiceRequest request = it.value();
+    m_pendingRequests.erase(it);
+
+    processServiceResponse(request, response);
+    dispatchQueuedRequests();
+}
+
+void Open62541AsyncBackend::finishServiceRequest(const ServiceRequest &request, UA_StatusCode status)
+{
+    void *response = UA_new(request.responseType);
+    static_cast<UA_ResponseHeader *>(response)->serviceResult = status;
+    processServiceResponse(request, response);
+    UA_delete(response, request.responseType);
+}
+
+void Open62541AsyncBackend::abortServiceRequests(QOpcUa::UaStatusCode status)
+{
+    // Requests which are still known to open62541 are ignored when their callback is invoked later
+    const auto pendingRequests = m_pendingRequests;
+    m_pendingRequests.clear();
+    const auto queuedRequests = m_queuedRequests;
+    m_queuedRequests.clear();
+
+    for (const auto &request : pendingRequests)
+        finishServiceRequest(request, status);
+
+    for (const auto &request : queuedRequests) {
+        UA_delete(request.request, request.requestType);
+        finishServiceRequest(request, status);
+    }
+}
+
+void Open62541AsyncBackend::processServiceResponse(const ServiceRequest &request, void *response)
+{
+    // All service responses start with the response header
+    const auto serviceResult = static_cast<QOpcUa::UaStatusCode>(static_cast<UA_ResponseHeader *>(response)->serviceResult);
+
+    switch (request.type) {
+    case ServiceRequest::Type::ReadAttributes: {
+        const auto res = static_cast<UA_ReadResponse *>(response);
+        QVector<QOpcUaReadResult> vec = request.readResults;
+
+        for (int i = 0; i < vec.size(); ++i) {
+            // Use the service result as status code if there is no specific result for the current value.
+            // This ensures a result for each attribute if the request failed or the client is disconnected.
+            if (static_cast<size_t>(i) >= res->resultsSize) {
+                vec[i].setStatusCode(serviceResult);
+                continue;
+            }
+            if (res->results[i].hasStatus)
+                vec[i].setStatusCode(static_cast<QOpcUa::UaStatusCode>(res->results[i].status));
+            else
+                vec[i].setStatusCode(QOpcUa::UaStatusCode::Good);
+            if (res->results[i].hasValue && res->results[i].value.data)
+                vec[i].setValue(QOpen62541ValueConverter::takeQVariant(&res->results[i].value, m_conversionFlags));
+            if (res->results[i].hasServerTimestamp)
+                vec[i].setServerTimestampRaw(res->results[i].serverTimestamp);
+            if (res->results[i].hasSourceTimestamp)
+                vec[i].setSourceTimestampRaw(res->results[i].sourceTimestamp);
+        }
+
+        if (m_addressSpaceCache.isOpen()) {
+            // Values are never cached
+            for (const auto &result : qAsConst(vec)) {
+                if (result.statusCode() == QOpcUa::UaStatusCode::Good && !result.nodeId().isEmpty()
+                        && Open62541AddressSpaceCache::isCacheable(result.attribute())
+                        && isCacheInsertAllowed(result.nodeId(), request.readSequence))
+                    m_addressSpaceCache.insertAttribute(result.nodeId(), result.attribute(), result.value());
+            }
+        }
+
+        // Split the results of coalesced reads
+        int offset = 0;
+        for (const auto &range : request.handleRanges) {
+            emit attributesRead(range.first, vec.mid(offset, range.second), serviceResult);
+            offset += range.second;
+        }
+
+        const auto cacheHits = m_cacheHitsAfterRead.take(request.readSequence);
+        pruneCacheInvalidations();
+        for (const auto &hit : cacheHits)
+            emit attributesRead(hit.first, hit.second, QOpcUa::UaStatusCode::Good);
+        break;
+    }
+    case ServiceRequest::Type::WriteAttributes: {
+        const auto res = static_cast<UA_WriteResponse *>(response);
+
+        int index = 0;
+        for (const auto &range : request.handleRanges) {
+            for (int i = 0; i < range.second; ++i, ++index) {
+                QOpcUa::UaStatusCode status = static_cast<size_t>(index) < res->resultsSize ?
+                            static_cast<QOpcUa::UaStatusCode>(res->results[index]) : serviceResult;
+                emit attributeWritten(range.first, request.writtenAttributes.at(index).first,
+                                      request.writtenAttributes.at(index).second, status);
+            }
+        }
+        break;
+    }
+    case ServiceRequest::Type::ReadNodeAttributes: {
+        const auto res = static_cast<UA_ReadResponse *>(response);
+        QVector<QOpcUaReadResult> ret;
+
+        if (serviceResult != QOpcUa::UaStatusCode::Good) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch read failed:" << serviceResult;
+            finishReadNodeAttributes(request, ret, serviceResult);
+            break;
+        }
+
+        for (int i = 0; i < request.readItems.size(); ++i) {
+            QOpcUaReadResult item;
+            item.setAttribute(request.readItems.at(i).attribute());
+            item.setNodeId(request.readItems.at(i).nodeId());
+            item.setIndexRange(request.readItems.at(i).indexRange());
+            if (static_cast<size_t>(i) < res->resultsSize) {
+                if (res->results[i].hasServerTimestamp)
+                    item.setServerTimestampRaw(res->results[i].serverTimestamp);
+                if (res->results[i].hasSourceTimestamp)
+                    item.setSourceTimestampRaw(res->results[i].sourceTimestamp);
+                // Batch reads often only check the status codes, the values are converted on first use
+                if (res->results[i].hasValue)
+                    QOpen62541ValueConverter::setLazyValue(item, &res->results[i].value, m_conversionFlags);
+                if (res->results[i].hasStatus)
+                    item.setStatusCode(static_cast<QOpcUa::UaStatusCode>(res->results[i].status));
+                else
+                    item.setStatusCode(serviceResult);
+            } else {
+                item.setStatusCode(serviceResult);
+            }
+            ret.push_back(item);
+        }
+        finishReadNodeAttributes(request, ret, serviceResult);
+        break;
+    }
+    case ServiceRequest::Type::WriteNodeAttributes: {
+        const auto res = static_cast<UA_WriteResponse *>(response);
+        QVector<QOpcUaWriteResult> ret;
+
+        if (serviceResult != QOpcUa::UaStatusCode::Good) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Batch write failed:" << serviceResult;
+            finishWriteNodeAttributes(request, ret, serviceResult);
+            break;
+        }
+
+        for (int i = 0; i < request.writeItems.size(); ++i) {
+            QOpcUaWriteResult item;
+            item.setAttribute(request.writeItems.at(i).attribute());
+            item.setNodeId(request.writeItems.at(i).nodeId());
+            item.setIndexRange(request.writeItems.at(i).indexRange());
+            if (static_cast<size_t>(i) < res->resultsSize)
+                item.setStatusCode(QOpcUa::UaStatusCode(res->results[i]));
+            else
+                item.setStatusCode(serviceResult);
+            ret.push_back(item);
+        }
+        finishWriteNodeAttributes(request, ret, serviceResult);
+        break;
+    }
+    case ServiceRequest::Type::Browse: {
+        // UA_BrowseNextResponse has the same layout as UA_BrowseResponse
+        const auto res = static_cast<UA_BrowseResponse *>(response);
+        ServiceRequest next = request;
+        QOpcUa::UaStatusCode statusCode = serviceResult;
+
+        if (serviceResult == QOpcUa::UaStatusCode::Good && res->resultsSize) {
+            statusCode = static_cast<QOpcUa::UaStatusCode>(res->results->statusCode);
+
+            if (statusCode == QOpcUa::UaStatusCode::Good) {
+                convertBrowseResult(res->results, res->results->referencesSize, next.references);
+
+                if (res->results->continuationPoint.length) {
+                    UA_BrowseNextRequest *nextReq = UA_BrowseNextRequest_new();
+                    nextReq->continuationPoints = UA_ByteString_new();
+                    UA_ByteString_copy(&(res->results->continuationPoint), nextReq->continuationPoints);
+                    nextReq->continuationPointsSize = 1;
+
+                    // The follow-up request takes over the slot of the finished request
+                    next.request = nextReq;
+                    next.requestType = &UA_TYPES[UA_TYPES_BROWSENEXTREQUEST];
+                    next.responseType = &UA_TYPES[UA_TYPES_BROWSENEXTRESPONSE];
+                    dispatchServiceRequest(next);
+                    break;
+                }
+            }
+        }
+
+        if (statusCode == QOpcUa::UaStatusCode::Good && !request.cacheNodeId.isEmpty())
+            m_addressSpaceCache.insertReferences(request.cacheNodeId, request.cacheKey, next.references);
+
+        emit browseFinished(request.handle, next.references, statusCode);
+        break;
+    }
+    case ServiceRequest::Type::Crawl:
+        // UA_BrowseNextResponse has the same layout as UA_BrowseResponse
+        processCrawlResponse(request, static_cast<UA_BrowseResponse *>(response), serviceResult);
+        break;
+    case ServiceRequest::Type::ReleaseContinuationPoints:
+        break; // Nobody is waiting for the result
+    case ServiceRequest::Type::RegisterNodes:
+        processRegisterNodesResponse(request, static_cast<UA_RegisterNodesResponse *>(response), serviceResult);
+        break;
+    case ServiceRequest::Type::UnregisterNodes:
+        processUnregisterNodesResponse(request, serviceResult);
+        break;
+#ifdef UA_ENABLE_HISTORIZING
+    case ServiceRequest::Type::HistoryRead:
+        processHistoryReadResponse(request, static_cast<UA_HistoryReadResponse *>(response), serviceResult);
+        break;
+#endif
+    case ServiceRequest::Type::CallMethod: {
+        const auto res = static_cast<UA_CallResponse *>(response);
+
+        UA_StatusCode status = res->responseHeader.serviceResult;
+        if (status == UA_STATUSCODE_GOOD)
+            status = res->resultsSize == 1 ? res->results[0].statusCode : UA_STATUSCODE_BADUNEXPECTEDERROR;
 
-    UA_String serverUri;
-    UaDeleter<UA_String> serverUriDeleter(&serverUri, UA_String_deleteMembers);
-    QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(
-                referenceToAdd.targetServerUri(), &serverUri);
+        QVariant result;
 
-    UA_NodeClass nodeClass = static_cast<UA_NodeClass>(referenceToAdd.targetNodeClass());
+        if (status != UA_STATUSCODE_GOOD) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not call method:" << UA_StatusCode_name(status);
+        } else if (res->results[0].outputArgumentsSize > 1) {
+            QVariantList temp;
+            for (size_t i = 0; i < res->results[0].outputArgumentsSize; ++i)
+                temp.append(QOpen62541ValueConverter::takeQVariant(&res->results[0].outputArguments[i], m_conversionFlags));
 
-    UA_StatusCode res = UA_Client_addReference(m_uaclient,
-                                               Open62541Utils::nodeIdFromQString(referenceToAdd.sourceNodeId()),
-                                               Open62541Utils::nodeIdFromQString(referenceToAdd.referenceTypeId()),
-                                               referenceToAdd.isForwardReference(), serverUri, target, nodeClass);
+            result = temp;
+        } else if (res->results[0].outputArgumentsSize == 1) {
+            result = QOpen62541ValueConverter::takeQVariant(&res->results[0].outputArguments[0], m_conversionFlags);
+        }
 
-    QOpcUa::UaStatusCode statusCode = static_cast<QOpcUa::UaStatusCode>(res);
-    if (res != UA_STATUSCODE_GOOD)
-        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to add reference from" << referenceToAdd.sourceNodeId() << "to"
-                                            << referenceToAdd.targetNodeId().nodeId() << ":" << statusCode;
+        emit methodCallFinished(request.handle, request.methodNodeId, result, static_cast<QOpcUa::UaStatusCode>(status));
+        break;
+    }
+    case ServiceRequest::Type::ResolveBrowsePath: {
+        const auto res = static_cast<UA_TranslateBrowsePathsToNodeIdsResponse *>(response);
 
-    emit addReferenceFinished(referenceToAdd.sourceNodeId(), referenceToAdd.referenceTypeId(),
-                              referenceToAdd.targetNodeId(),
-                              referenceToAdd.isForwardReference(), statusCode);
+        if (serviceResult != QOpcUa::UaStatusCode::Good || res->resultsSize != 1) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Translate browse path failed:" << UA_StatusCode_name(res->responseHeader.serviceResult);
+            emit resolveBrowsePathFinished(request.handle, QVector<QOpcUaBrowsePathTarget>(), request.path, serviceResult);
+            break;
+        }
+
+        QVector<QOpcUaBrowsePathTarget> ret;
+        for (size_t i = 0; i < res->results[0].targetsSize ; ++i) {
+            QOpcUaBrowsePathTarget temp;
+            temp.setRemainingPathIndex(res->results[0].targets[i].remainingPathIndex);
+            temp.targetIdRef().setNamespaceUri(QString::fromUtf8(reinterpret_cast<char *>(res->results[0].targets[i].targetId.namespaceUri.data)));
+            temp.targetIdRef().setServerIndex(res->results[0].targets[i].targetId.serverIndex);
+            temp.targetIdRef().setNodeId(Open62541Utils::nodeIdToQString(res->results[0].targets[i].targetId.nodeId));
+            ret.append(temp);
+        }
+
+        emit resolveBrowsePathFinished(request.handle, ret, request.path, static_cast<QOpcUa::UaStatusCode>(res->results[0].statusCode));
+        break;
+    }
+    }
 }
 
-void Open62541AsyncBackend::deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete)
+/*
+    Requests exceeding the operation limits of the server are split into chunks which are sent in parallel.
+    The results of the chunks are merged in the original order, a failed chunk fails the whole request.
+*/
+int Open62541AsyncBackend::chunkSize(quint32 serverLimit, int itemCount) const
 {
-    UA_ExpandedNodeId target;
-    UA_ExpandedNodeId_init(&target);
-    UaDeleter<UA_ExpandedNodeId> targetDeleter(&target, UA_ExpandedNodeId_deleteMembers);
-    QOpen62541ValueConverter::scalarFromQt<UA_ExpandedNodeId, QOpcUaExpandedNodeId>(
-                referenceToDelete.targetNodeId(), &target);
-
-    UA_StatusCode res = UA_Client_deleteReference(m_uaclient,
-                                                  Open62541Utils::nodeIdFromQString(referenceToDelete.sourceNodeId()),
-                                                  Open62541Utils::nodeIdFromQString(referenceToDelete.referenceTypeId()),
-                                                  referenceToDelete.isForwardReference(),
-                                                  target, referenceToDelete.deleteBidirectional());
+    if (serverLimit == 0 || serverLimit >= static_cast<quint32>(itemCount))
+        return itemCount;
+    return static_cast<int>(serverLimit);
+}
 
-    QOpcUa::UaStatusCode statusCode = static_cast<QOpcUa::UaStatusCode>(res);
-    if (res != UA_STATUSCODE_GOOD)
-        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to delete reference from" << referenceToDelete.sourceNodeId() << "to"
-                                            << referenceToDelete.targetNodeId().nodeId() << ":" << statusCode;
+quint64 Open62541AsyncBackend::beginChunkedRequest(int itemCount, int chunkSize)
+{
+    if (itemCount <= chunkSize)
+        return 0;
 
-    emit deleteReferenceFinished(referenceToDelete.sourceNodeId(), referenceToDelete.referenceTypeId(),
-                                 referenceToDelete.targetNodeId(),
-                                 referenceToDelete.isForwardReference(), statusCode);
+    const quint64 id = m_nextChunkedRequestId++;
+    m_chunkedRequests[id].pendingChunks = (itemCount + chunkSize - 1) / chunkSize;
+    return id;
 }
 
-static void convertBrowseResult(UA_BrowseResult *src, quint32 referencesSize, QVector<QOpcUaReferenceDescription> &dst)
+void Open62541AsyncBackend::finishReadNodeAttributes(const ServiceRequest &request, const QVector<QOpcUaReadResult> &results,
+                                                     QOpcUa::UaStatusCode serviceResult)
 {
-    if (!src)
+    if (!request.chunkedRequestId) {
+        emit readNodeAttributesFinished(results, serviceResult);
         return;
+    }
 
-    for (size_t i = 0; i < referencesSize; ++i) {
-        QOpcUaReferenceDescription temp;
-        temp.setTargetNodeId(QOpen62541ValueConverter::scalarToQt<QOpcUaExpandedNodeId>(&src->references[i].nodeId));
-        temp.setTypeDefinition(QOpen62541ValueConverter::scalarToQt<QOpcUaExpandedNodeId>(&src->references[i].typeDefinition));
-        temp.setRefTypeId(Open62541Utils::nodeIdToQString(src->references[i].referenceTypeId));
-        temp.setNodeClass(static_cast<QOpcUa::NodeClass>(src->references[i].nodeClass));
-        temp.setBrowseName(QOpen62541ValueConverter::scalarToQt<QOpcUaQualifiedName, UA_QualifiedName>(&src->references[i].browseName));
-        temp.setDisplayName(QOpen62541ValueConverter::scalarToQt<QOpcUaLocalizedText, UA_LocalizedText>(&src->references[i].displayName));
-        temp.setIsForwardReference(src->references[i].isForward);
-        dst.push_back(temp);
+    const auto it = m_chunkedRequests.find(request.chunkedRequestId);
+    if (it == m_chunkedRequests.end())
+        return;
+
+    if (serviceResult != QOpcUa::UaStatusCode::Good) {
+        if (it->serviceResult == QOpcUa::UaStatusCode::Good)
+            it->serviceResult = serviceResult;
+    } else {
+        if (it->readResults.size() < request.chunkOffset + results.size())
+            it->readResults.resize(request.chunkOffset + results.size());
+        std::copy(results.constBegin(), results.constEnd(), it->readResults.begin() + request.chunkOffset);
     }
+
+    if (--it->pendingChunks > 0)
+        return;
+
+    const ChunkedRequest chunkedRequest = it.value();
+    m_chunkedRequests.erase(it);
+
+    if (chunkedRequest.serviceResult != QOpcUa::UaStatusCode::Good)
+        emit readNodeAttributesFinished(QVector<QOpcUaReadResult>(), chunkedRequest.serviceResult);
+    else
+        emit readNodeAttributesFinished(chunkedRequest.readResults, chunkedRequest.serviceResult);
 }
 
-void Open62541AsyncBackend::browse(quint64 handle, UA_NodeId id, const QOpcUaBrowseRequest &request)
+void Open62541AsyncBackend::finishWriteNodeAttributes(const ServiceRequest &request, const QVector<QOpcUaWriteResult> &results,
+                                                      QOpcUa::UaStatusCode serviceResult)
 {
-    UA_BrowseRequest uaRequest;
-    UA_BrowseRequest_init(&uaRequest);
-    UaDeleter<UA_BrowseRequest> requestDeleter(&uaRequest, UA_BrowseRequest_deleteMembers);
+    if (!request.chunkedRequestId) {
+        emit writeNodeAttributesFinished(results, serviceResult);
+        return;
+    }
+
+    const auto it = m_chunkedRequests.find(request.chunkedRequestId);
+    if (it == m_chunkedRequests.end())
+        return;
 
-    uaRequest.nodesToBrowse = UA_BrowseDescription_new();
-    uaRequest.nodesToBrowseSize = 1;
-    uaRequest.nodesToBrowse->browseDirection = static_cast<UA_BrowseDirection>(request.browseDirection());
-    uaRequest.nodesToBrowse->includeSubtypes = request.includeSubtypes();
-    uaRequest.nodesToBrowse->nodeClassMask = static_cast<quint32>(request.nodeClassMask());
-    uaRequest.nodesToBrowse->nodeId = id;
-    uaRequest.nodesToBrowse->resultMask = UA_BROWSERESULTMASK_ALL;
-    uaRequest.nodesToBrowse->referenceTypeId = Open62541Utils::nodeIdFromQString(request.referenceTypeId());
-    uaRequest.requestedMaxReferencesPerNode = 0; // Let the server choose a maximum value
+    if (serviceResult != QOpcUa::UaStatusCode::Good) {
+        if (it->serviceResult == QOpcUa::UaStatusCode::Good)
+            it->serviceResult = serviceResult;
+    } else {
+        if (it->writeResults.size() < request.chunkOffset + results.size())
+            it->writeResults.resize(request.chunkOffset + results.size());
+        std::copy(results.constBegin(), results.constEnd(), it->writeResults.begin() + request.chunkOffset);
+    }
 
-    UA_BrowseResponse *response = UA_BrowseResponse_new();
-    UaDeleter<UA_BrowseResponse> responseDeleter(response, UA_BrowseResponse_delete);
-    *response = UA_Client_Service_browse(m_uaclient, uaRequest);
+    if (--it->pendingChunks > 0)
+        return;
 
-    QVector<QOpcUaReferenceDescription> ret;
+    const ChunkedRequest chunkedRequest = it.value();
+    m_chunkedRequests.erase(it);
 
-    QOpcUa::UaStatusCode statusCode = QOpcUa::UaStatusCode::Good;
+    if (chunkedRequest.serviceResult != QOpcUa::UaStatusCode::Good)
+        emit writeNodeAttributesFinished(QVector<QOpcUaWriteResult>(), chunkedRequest.serviceResult);
+    else
+        emit writeNodeAttributesFinished(chunkedRequest.writeResults, chunkedRequest.serviceResult);
+}
 
-    while (response->resultsSize && statusCode == QOpcUa::UaStatusCode::Good) {
-        UA_BrowseResponse *res = static_cast<UA_BrowseResponse *>(response);
+/*
+    Responses to service requests are processed by UA_Client_run_iterate() in sendPublishRequest().
+    The socket notifier delivers the responses, the timer makes sure that timeouts are detected.
+*/
+void Open62541AsyncBackend::enableResponseProcessing()
+{
+    if (m_socketNotifier)
+        m_socketNotifier->setEnabled(true);
 
-        if (res->responseHeader.serviceResult != UA_STATUSCODE_GOOD || res->results->statusCode != UA_STATUSCODE_GOOD) {
-            statusCode = static_cast<QOpcUa::UaStatusCode>(res->results->statusCode);
-            break;
-        }
+    if (!m_subscriptionTimer.isActive())
+        m_subscriptionTimer.start(publishTimerInterval());
+}
 
-        convertBrowseResult(res->results, res->results->referencesSize, ret);
+bool Open62541AsyncBackend::hasPendingServiceRequests() const
+{
+    return !m_pendingRequests.isEmpty() || !m_queuedRequests.isEmpty();
+}
 
-        if (res->results->continuationPoint.length) {
-            UA_BrowseNextRequest nextReq;
-            UA_BrowseNextRequest_init(&nextReq);
-            UaDeleter<UA_BrowseNextRequest> nextReqDeleter(&nextReq, UA_BrowseNextRequest_deleteMembers);
-            nextReq.continuationPoints = UA_ByteString_new();
-            UA_ByteString_copy(&(res->results->continuationPoint), nextReq.continuationPoints);
-            nextReq.continuationPointsSize = 1;
-            UA_BrowseResponse_deleteMembers(res); // Deallocate the pointer members before overwriting the response
-            *reinterpret_cast<UA_BrowseNextResponse *>(response) = UA_Client_Service_browseNext(m_uaclient, nextReq);
-        } else {
-            break;
-        }
-    }
+// The socket of the most recent connection opened by the backend on this thread.
+// open62541 copies the UA_Connection into the opaque client struct, this is the only place to get hold of the socket.
+static thread_local UA_SOCKET lastClientSocket = UA_INVALID_SOCKET;
 
-    emit browseFinished(handle, ret, statusCode);
+static UA_Connection clientConnectionTCP(UA_ConnectionConfig config, const UA_String endpointUrl,
+                                         UA_UInt32 timeout, UA_Logger *logger)
+{
+    UA_Connection connection = UA_ClientConnectionTCP(config, endpointUrl, timeout, logger);
+    lastClientSocket = connection.state == UA_CONNECTION_CLOSED ? UA_INVALID_SOCKET : connection.sockfd;
+    return connection;
 }
 
 static void clientStateCallback(UA_Client *client, UA_ClientState state)
@@ -759,17 +2403,32 @@ static void clientStateCallback(UA_Client *client, UA_ClientState state)
         return;
 
     if (state == UA_CLIENTSTATE_DISCONNECTED) {
-        emit backend->stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::ConnectionError);
+        // The socket has already been closed by open62541
+        backend->releaseSocketNotifier();
         backend->m_useStateCallback = false;
+        if (backend->m_reconnectInterval > 0) {
+            // Queued, the callback may have been triggered inside of a subscription method
+            QMetaObject::invokeMethod(backend, &Open62541AsyncBackend::beginReconnect, Qt::QueuedConnection);
+            return;
+        }
+        emit backend->stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::ConnectionError);
         // Use a queued connection to make sure the subscription is not deleted if the callback was triggered
         // inside of one of its methods.
         QMetaObject::invokeMethod(backend, "cleanupSubscriptions", Qt::QueuedConnection);
+        QMetaObject::invokeMethod(backend, "abortServiceRequests", Qt::QueuedConnection);
     }
 }
 
 void Open62541AsyncBackend::connectToEndpoint(const QOpcUaEndpointDescription &endpoint)
 {
+    m_reconnectTimer.stop();
+    releaseSocketNotifier();
     cleanupSubscriptions();
+    clearRegisteredNodes();
+
+    // The callbacks invoked by UA_Client_delete() must neither find requests to finish nor dispatch queued ones
+    abortCoalescedRequests(QOpcUa::UaStatusCode::BadDisconnect);
+    abortServiceRequests(QOpcUa::UaStatusCode::BadDisconnect);
 
     if (m_uaclient)
         UA_Client_delete(m_uaclient);
@@ -873,6 +2532,7 @@ void Open62541AsyncBackend::connectToEndpoint(const QOpcUaEndpointDescription &e
 
     conf->clientContext = this;
     conf->stateCallback = &clientStateCallback;
+    conf->connectionFunc = &clientConnectionTCP;
     conf->clientDescription.applicationName = UA_LOCALIZEDTEXT_ALLOC("", identity.applicationName().toUtf8().constData());
     conf->clientDescription.applicationUri  = UA_STRING_ALLOC(identity.applicationUri().toUtf8().constData());
     conf->clientDescription.productUri      = UA_STRING_ALLOC(identity.productUri().toUtf8().constData());
@@ -881,11 +2541,7 @@ void Open62541AsyncBackend::connectToEndpoint(const QOpcUaEndpointDescription &e
     conf->securityPolicyUri = UA_STRING_ALLOC(endpoint.securityPolicy().toUtf8().constData());
     conf->securityMode = static_cast<UA_MessageSecurityMode>(endpoint.securityMode());
 
-    UA_StatusCode ret;
-
-    if (authInfo.authenticationType() == QOpcUaUserTokenPolicy::TokenType::Anonymous) {
-        ret = UA_Client_connect(m_uaclient, endpoint.endpointUrl().toUtf8().constData());
-    } else if (authInfo.authenticationType() == QOpcUaUserTokenPolicy::TokenType::Username) {
+    if (authInfo.authenticationType() == QOpcUaUserTokenPolicy::TokenType::Username) {
 
         bool suitableTokenFound = false;
         for (const auto token : endpoint.userIdentityTokens()) {
@@ -901,17 +2557,15 @@ void Open62541AsyncBackend::connectToEndpoint(const QOpcUaEndpointDescription &e
             emit stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::ClientError::NoError);
             return;
         }
-
-        const auto credentials = authInfo.authenticationData().value<QPair<QString, QString>>();
-        ret = UA_Client_connect_username(m_uaclient, endpoint.endpointUrl().toUtf8().constData(),
-                                         credentials.first.toUtf8().constData(), credentials.second.toUtf8().constData());
-    } else {
+    } else if (authInfo.authenticationType() != QOpcUaUserTokenPolicy::TokenType::Anonymous) {
         emit stateAndOrErrorChanged(QOpcUaClient::Disconnected, QOpcUaClient::UnsupportedAuthenticationInformation);
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to connect: Selected authentication type"
                                           << authInfo.authenticationType() << "is not supported.";
         return;
     }
 
+    const UA_StatusCode ret = connectSession(endpoint);
+
     if (ret != UA_STATUSCODE_GOOD) {
         UA_Client_delete(m_uaclient);
         m_uaclient = nullptr;
@@ -932,14 +2586,231 @@ void Open62541AsyncBackend::connectToEndpoint(const QOpcUaEndpointDescription &e
         return;
     }
 
+    setupSocketNotifier();
+    readOperationLimits();
+
+    m_endpoint = endpoint;
+    openAddressSpaceCache();
     m_useStateCallback = true;
     emit stateAndOrErrorChanged(QOpcUaClient::Connected, QOpcUaClient::NoError);
 }
 
+UA_StatusCode Open62541AsyncBackend::connectSession(const QOpcUaEndpointDescription &endpoint)
+{
+    lastClientSocket = UA_INVALID_SOCKET;
+
+    const auto authInfo = m_clientImpl->m_client->authenticationInformation();
+    if (authInfo.authenticationType() == QOpcUaUserTokenPolicy::TokenType::Username) {
+        const auto credentials = authInfo.authenticationData().value<QPair<QString, QString>>();
+        return UA_Client_connect_username(m_uaclient, endpoint.endpointUrl().toUtf8().constData(),
+                                          credentials.first.toUtf8().constData(), credentials.second.toUtf8().constData());
+    }
+
+    return UA_Client_connect(m_uaclient, endpoint.endpointUrl().toUtf8().constData());
+}
+
+/*
+    Called after the connection to the server has been lost and automatic reconnects are enabled.
+    The subscriptions are kept so they can be created again once the connection has been reestablished.
+*/
+void Open62541AsyncBackend::beginReconnect()
+{
+    if (!m_uaclient || m_reconnectTimer.isActive())
+        return;
+
+    m_useStateCallback = false;
+    m_subscriptionTimer.stop();
+    m_sendPublishRequests = false;
+    releaseSocketNotifier();
+    flushDataChanges();
+    abortServiceRequests(QOpcUa::UaStatusCode::BadConnectionClosed);
+
+    qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Connection lost, reconnecting in" << m_reconnectInterval << "milliseconds";
+    emit stateAndOrErrorChanged(QOpcUaClient::Connecting, QOpcUaClient::ConnectionError);
+    m_reconnectTimer.start(m_reconnectInterval);
+}
+
+void Open62541AsyncBackend::reconnect()
+{
+    if (!m_uaclient)
+        return;
+
+    // Make sure no state from the lost session is left over
+    UA_Client_disconnect(m_uaclient);
+
+    const UA_StatusCode ret = connectSession(m_endpoint);
+    if (ret != UA_STATUSCODE_GOOD) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Reconnect failed:" << static_cast<QOpcUa::UaStatusCode>(ret);
+        m_reconnectTimer.start(m_reconnectInterval);
+        return;
+    }
+
+    setupSocketNotifier();
+    readOperationLimits();
+    m_useStateCallback = true;
+
+    // Aliases are only valid in the session which has assigned them
+    if (!m_registeredNodes.isEmpty()) {
+        const quint64 id = m_nextNodeRegistrationId++;
+        m_nodeRegistrations.insert(id, NodeRegistration());
+        for (auto &node : m_registeredNodes) {
+            UA_NodeId_deleteMembers(&node.alias);
+            node.registrationId = id;
+        }
+        sendRegisterNodesRequests(id, m_registeredNodes.keys());
+    }
+
+    recoverSubscriptions();
+    openAddressSpaceCache();
+
+    // The client returns to the Connected state without emitting connected() again
+    emit connectionRecovered();
+    modifyPublishRequests();
+}
+
+/*
+    The open62541 client can neither reactivate the lost session nor take over subscriptions
+    transferred with TransferSubscriptions, so each subscription is created again from the local state.
+    The initial values reported for the new monitored items close the gap of the outage.
+*/
+void Open62541AsyncBackend::recoverSubscriptions()
+{
+    const auto subscriptions = m_subscriptions.values();
+    m_subscriptions.clear();
+
+    QHash<UA_UInt32, UA_UInt32> revisedIds;
+    for (const auto sub : subscriptions) {
+        const UA_UInt32 oldId = sub->subscriptionId();
+        QVector<QPair<quint64, QOpcUa::NodeAttribute>> lostItems;
+        const UA_UInt32 newId = sub->recreateOnServer(&lostItems);
+
+        for (const auto &item : qAsConst(lostItems)) {
+            auto entry = m_attributeMapping.find(item.first);
+            if (entry != m_attributeMapping.end())
+                entry->remove(item.second);
+        }
+
+        if (!newId || !sub->monitoredItemsCount()) {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not recover subscription" << oldId;
+            delete sub;
+            continue;
+        }
+
+        m_subscriptions[newId] = sub;
+        revisedIds[oldId] = newId;
+    }
+
+    for (auto it = m_tagTableSubscriptions.begin(); it != m_tagTableSubscriptions.end();) {
+        const UA_UInt32 newId = revisedIds.value(it.value(), 0);
+        if (newId) {
+            it.value() = newId;
+            ++it;
+        } else {
+            it = m_tagTableSubscriptions.erase(it);
+        }
+    }
+}
+
+/*
+    The cache file is chosen by the application URI of the server, its entries are only used
+    if the namespace array hasn't changed. Model change events of the server object remove
+    the entries of the affected nodes while the client is connected.
+*/
+void Open62541AsyncBackend::openAddressSpaceCache()
+{
+    if (m_addressSpaceCache.directory().isEmpty())
+        return;
+
+    UA_Variant value;
+    UA_Variant_init(&value);
+    UaDeleter<UA_Variant> valueDeleter(&value, UA_Variant_deleteMembers);
+
+    const UA_StatusCode result = UA_Client_readValueAttribute(m_uaclient, UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER_NAMESPACEARRAY), &value);
+    if (result != UA_STATUSCODE_GOOD || !UA_Variant_hasArrayType(&value, &UA_TYPES[UA_TYPES_STRING])) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to read the namespace array, the address space cache is not used:"
+                                              << static_cast<QOpcUa::UaStatusCode>(result);
+        m_addressSpaceCache.close();
+        return;
+    }
+
+    QStringList namespaceArray;
+    const auto namespaces = static_cast<UA_String *>(value.data);
+    for (size_t i = 0; i < value.arrayLength; ++i)
+        namespaceArray.append(QOpen62541ValueConverter::scalarToQt<QString, UA_String>(&namespaces[i]));
+
+    QString applicationUri = m_endpoint.server().applicationUri();
+    if (applicationUri.isEmpty())
+        applicationUri = m_endpoint.endpointUrl();
+
+    m_addressSpaceCache.open(applicationUri, namespaceArray);
+
+    if (getSubscriptionForItem(ModelChangeEventHandle, QOpcUa::NodeAttribute::EventNotifier))
+        return; // The monitored item has been recovered after a reconnect
+
+    QOpcUaMonitoringParameters::EventFilter filter;
+    filter << QOpcUaSimpleAttributeOperand(QStringLiteral("EventType"))
+           << QOpcUaSimpleAttributeOperand(QStringLiteral("Changes"), 0,
+                                           QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::GeneralModelChangeEventType));
+
+    QOpcUaMonitoringParameters parameters(1000, QOpcUaMonitoringParameters::SubscriptionType::Exclusive);
+    parameters.setFilter(filter);
+    addMonitoredAttributes(ModelChangeEventHandle, UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER),
+                           QOpcUa::NodeAttribute::EventNotifier, parameters);
+}
+
+/*
+    A GeneralModelChangeEvent lists the affected nodes, all other model change events
+    and changes which can't be decoded clear the entire cache.
+*/
+void Open62541AsyncBackend::handleModelChangeEvent(const QVariantList &eventFields)
+{
+    if (eventFields.size() != 2)
+        return;
+
+    const QString eventType = eventFields.at(0).toString();
+    if (eventType == QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::BaseModelChangeEventType)) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "The address space has changed, clearing the address space cache";
+        clearAddressSpaceCache();
+        return;
+    }
+
+    if (eventType != QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::GeneralModelChangeEventType))
+        return;
+
+    QVariantList changes = eventFields.at(1).toList();
+    if (changes.isEmpty() && eventFields.at(1).isValid())
+        changes.append(eventFields.at(1));
+
+    QStringList affectedNodes;
+    for (const auto &change : qAsConst(changes)) {
+        auto object = change.value<QOpcUaExtensionObject>();
+        bool success = object.encodingTypeId()
+                == QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ModelChangeStructureDataType_Encoding_DefaultBinary);
+        if (success) {
+            QOpcUaBinaryDataEncoding decoder(object);
+            affectedNodes.append(decoder.decode<QString, QOpcUa::Types::NodeId>(success));
+        }
+        if (!success) {
+            qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Unable to decode a model change, clearing the address space cache";
+            clearAddressSpaceCache();
+            return;
+        }
+    }
+
+    for (const auto &nodeId : qAsConst(affectedNodes))
+        invalidateCachedNode(nodeId);
+}
+
 void Open62541AsyncBackend::disconnectFromEndpoint()
 {
+    m_reconnectTimer.stop();
     m_subscriptionTimer.stop();
+    flushCoalescedRequests();
+    releaseSocketNotifier();
     cleanupSubscriptions();
+    abortServiceRequests(QOpcUa::UaStatusCode::BadShutdown);
+    clearRegisteredNodes();
+    m_addressSpaceCache.close();
 
     m_useStateCallback = false;
 
@@ -1019,34 +2890,173 @@ void Open62541AsyncBackend::sendPublishRequest()
     if (!m_uaclient)
         return;
 
-    if (!m_sendPublishRequests) {
+    if (!m_sendPublishRequests && !hasPendingServiceRequests()) {
         return;
     }
 
     // If BADSERVERNOTCONNECTED is returned, the subscriptions are gone and local information can be deleted.
-    if (UA_Client_run_iterate(m_uaclient, 1) == UA_STATUSCODE_BADSERVERNOTCONNECTED) {
+    const auto result = UA_Client_run_iterate(m_uaclient, 1);
+    flushDataChanges();
+
+    if (result == UA_STATUSCODE_BADSERVERNOTCONNECTED) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Unable to send publish request";
+        if (m_reconnectInterval > 0) {
+            beginReconnect();
+            return;
+        }
         m_sendPublishRequests = false;
+        if (m_socketNotifier)
+            m_socketNotifier->setEnabled(false);
         cleanupSubscriptions();
+        abortServiceRequests(QOpcUa::UaStatusCode::BadServerNotConnected);
+        return;
+    }
+
+    if (!m_sendPublishRequests && !hasPendingServiceRequests()) {
+        if (m_socketNotifier)
+            m_socketNotifier->setEnabled(false);
         return;
     }
 
-    m_subscriptionTimer.start(0);
+    m_subscriptionTimer.start(publishTimerInterval());
 }
 
 void Open62541AsyncBackend::modifyPublishRequests()
 {
     if (m_subscriptions.count() == 0) {
-        m_subscriptionTimer.stop();
         m_sendPublishRequests = false;
+        if (hasPendingServiceRequests())
+            return; // Keep processing the responses to the outstanding service requests
+        m_subscriptionTimer.stop();
+        if (m_socketNotifier)
+            m_socketNotifier->setEnabled(false);
         return;
     }
 
     m_subscriptionTimer.stop();
     m_sendPublishRequests = true;
+    if (m_socketNotifier)
+        m_socketNotifier->setEnabled(true);
     sendPublishRequest();
 }
 
+/*
+    Publish responses are processed when the socket becomes readable.
+    The timer only has to make sure that publish requests are replenished and timeouts are checked
+    at least once per keep-alive period of the fastest subscription.
+    Outstanding service requests are checked for timeouts at least every 100 ms.
+    Without a socket notifier, the backend falls back to polling.
+*/
+int Open62541AsyncBackend::publishTimerInterval() const
+{
+    if (!m_socketNotifier)
+        return 0;
+
+    double interval = hasPendingServiceRequests() ? 100 : std::numeric_limits<double>::max();
+    for (const auto sub : m_subscriptions)
+        interval = qMin(interval, qMax(sub->interval(), sub->keepAliveInterval()));
+
+    if (interval == std::numeric_limits<double>::max())
+        return 0;
+
+    return qBound(1, static_cast<int>(interval), std::numeric_limits<int>::max());
+}
+
+void Open62541AsyncBackend::readOperationLimits()
+{
+    const QVector<QPair<UA_UInt32, quint32 *>> limits = {
+        {UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERREAD, &m_maxNodesPerRead},
+        {UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERWRITE, &m_maxNodesPerWrite},
+        {UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXMONITOREDITEMSPERCALL, &m_maxMonitoredItemsPerCall},
+        {UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERBROWSE, &m_maxNodesPerBrowse},
+        {UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERREGISTERNODES, &m_maxNodesPerRegisterNodes},
+        {UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERHISTORYREADDATA, &m_maxNodesPerHistoryReadData},
+        {UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERTRANSLATEBROWSEPATHSTONODEIDS, &m_maxNodesPerTranslateBrowsePaths}
+    };
+
+    UA_ReadRequest req;
+    UA_ReadRequest_init(&req);
+    UaDeleter<UA_ReadRequest> requestDeleter(&req, UA_ReadRequest_deleteMembers);
+
+    req.nodesToReadSize = limits.size();
+    req.nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(limits.size(), &UA_TYPES[UA_TYPES_READVALUEID]));
+
+    for (int i = 0; i < limits.size(); ++i) {
+        req.nodesToRead[i].nodeId = UA_NODEID_NUMERIC(0, limits.at(i).first);
+        req.nodesToRead[i].attributeId = UA_ATTRIBUTEID_VALUE;
+        *limits.at(i).second = 0;
+    }
+
+    UA_ReadResponse res = UA_Client_Service_read(m_uaclient, req);
+    UaDeleter<UA_ReadResponse> responseDeleter(&res, UA_ReadResponse_deleteMembers);
+
+    // Servers are not required to expose the operation limits, a missing value means there is no limit
+    for (size_t i = 0; i < res.resultsSize && i < static_cast<size_t>(limits.size()); ++i) {
+        if (res.results[i].hasValue && UA_Variant_hasScalarType(&res.results[i].value, &UA_TYPES[UA_TYPES_UINT32]))
+            *limits.at(i).second = *static_cast<UA_UInt32 *>(res.results[i].value.data);
+    }
+
+    // Some servers enforce limits they don't expose
+    if (m_configuredMaxNodesPerRead)
+        m_maxNodesPerRead = m_configuredMaxNodesPerRead;
+    if (m_configuredMaxNodesPerWrite)
+        m_maxNodesPerWrite = m_configuredMaxNodesPerWrite;
+
+    qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Server operation limits: MaxNodesPerRead" << m_maxNodesPerRead
+                                        << "MaxNodesPerWrite" << m_maxNodesPerWrite
+                                        << "MaxMonitoredItemsPerCall" << m_maxMonitoredItemsPerCall
+                                        << "MaxNodesPerBrowse" << m_maxNodesPerBrowse
+                                        << "MaxNodesPerRegisterNodes" << m_maxNodesPerRegisterNodes
+                                        << "MaxNodesPerHistoryReadData" << m_maxNodesPerHistoryReadData
+                                        << "MaxNodesPerTranslateBrowsePathsToNodeIds" << m_maxNodesPerTranslateBrowsePaths;
+}
+
+int Open62541AsyncBackend::maxMonitoredItemsPerCall() const
+{
+    // open62541 allocates the monitored item contexts on the stack, the local limit keeps the stack usage sane
+    constexpr quint32 localLimit = 10000;
+
+    if (m_maxMonitoredItemsPerCall == 0 || m_maxMonitoredItemsPerCall > localLimit)
+        return static_cast<int>(localLimit);
+
+    return static_cast<int>(m_maxMonitoredItemsPerCall);
+}
+
+// Chunk sizes for the synchronous service calls of the subscriptions
+int Open62541AsyncBackend::readChunkSize(int itemCount) const
+{
+    return chunkSize(m_maxNodesPerRead, itemCount);
+}
+
+int Open62541AsyncBackend::translateBrowsePathsChunkSize(int itemCount) const
+{
+    return chunkSize(m_maxNodesPerTranslateBrowsePaths, itemCount);
+}
+
+void Open62541AsyncBackend::setupSocketNotifier()
+{
+    releaseSocketNotifier();
+
+    if (lastClientSocket == UA_INVALID_SOCKET) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "No socket available, falling back to polling for publish responses";
+        return;
+    }
+
+    m_socketNotifier = new QSocketNotifier(static_cast<qintptr>(lastClientSocket), QSocketNotifier::Read, this);
+    m_socketNotifier->setEnabled(m_sendPublishRequests || hasPendingServiceRequests());
+    QObject::connect(m_socketNotifier, &QSocketNotifier::activated, this, &Open62541AsyncBackend::sendPublishRequest);
+}
+
+void Open62541AsyncBackend::releaseSocketNotifier()
+{
+    if (!m_socketNotifier)
+        return;
+
+    m_socketNotifier->setEnabled(false);
+    m_socketNotifier->deleteLater();
+    m_socketNotifier = nullptr;
+}
+
 void Open62541AsyncBackend::handleSubscriptionTimeout(QOpen62541Subscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items)
 {
     for (auto it : qAsConst(items)) {
@@ -1074,6 +3084,15 @@ QOpen62541Subscription *Open62541AsyncBackend::getSubscriptionForItem(quint64 ha
     return subscription.value();
 }
 
+QOpen62541Subscription *Open62541AsyncBackend::getClientSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr)
+{
+    // The internal monitored items of the backend can't be modified or removed by the client
+    if (handle == ModelChangeEventHandle)
+        return nullptr;
+
+    return getSubscriptionForItem(handle, attr);
+}
+
 QOpcUaApplicationDescription Open62541AsyncBackend::convertApplicationDescription(UA_ApplicationDescription &desc)
 {
     QOpcUaApplicationDescription temp;
@@ -1092,8 +3111,36 @@ QOpcUaApplicationDescription Open62541AsyncBackend::convertApplicationDescriptio
     return temp;
 }
 
+void Open62541AsyncBackend::queueDataChange(quint64 handle, const QOpcUaReadResult &result)
+{
+    if (updateTagTable(handle, result))
+        return;
+
+    if (!m_batchDataChanges) {
+        emit dataChangeOccurred(handle, result);
+        return;
+    }
+
+    // Publish responses can also be processed while waiting for the response of a synchronous service call.
+    // The queued flush makes sure these data changes are delivered once control returns to the event loop.
+    if (m_pendingDataChanges.isEmpty())
+        QMetaObject::invokeMethod(this, &Open62541AsyncBackend::flushDataChanges, Qt::QueuedConnection);
+
+    m_pendingDataChanges.append({handle, result});
+}
+
+void Open62541AsyncBackend::flushDataChanges()
+{
+    if (m_pendingDataChanges.isEmpty())
+        return;
+
+    emit dataChangesOccurred(m_pendingDataChanges);
+    m_pendingDataChanges.clear();
+}
+
 void Open62541AsyncBackend::cleanupSubscriptions()
 {
+    flushDataChanges();
     qDeleteAll(m_subscriptions);
     m_subscriptions.clear();
     m_attributeMapping.clear();
@@ -34,11 +34,17 @@
 **
 ****************************************************************************/
 
+#include "qopen62541addressspacecache.h"
 #include "qopen62541client.h"
+#include "qopen62541commandqueue.h"
 #include "qopen62541subscription.h"
+#include "qopen62541utils.h"
+#include "qopen62541valueconverter.h"
 #include <private/qopcuabackend_p.h>
 
+#include <QtCore/qqueue.h>
 #include <QtCore/qset.h>
+#include <QtCore/qsocketnotifier.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qtimer.h>
 
@@ -65,13 +71,26 @@ public Q_SLOTS:
     void enableMonitoring(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
     void disableMonitoring(quint64 handle, QOpcUa::NodeAttributes attr);
     void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
+    void createMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items);
+    void deleteMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items);
+    void modifyMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items);
+    void createTagMonitoredItems(quint32 tableId, const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings);
+    void deleteTagMonitoredItems(quint32 tableId);
     void callMethod(quint64 handle, UA_NodeId objectId, UA_NodeId methodId, QVector<QOpcUa::TypedVariant> args);
     void resolveBrowsePath(quint64 handle, UA_NodeId startNode, const QVector<QOpcUaRelativePathElement> &path);
     void findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris);
+    void crawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request, int maxDepth);
 
     void readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead);
     void writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite);
 
+    void registerNodes(quint64 handle, const QStringList &nodeIds);
+    void unregisterNodes(quint64 handle, const QStringList &nodeIds);
+
+#ifdef UA_ENABLE_HISTORIZING
+    void readHistoryData(const QOpcUaHistoryReadRequest &request);
+#endif
+
     // Node management
     void addNode(const QOpcUaAddNodeItem &nodeToAdd);
     void deleteNode(const QString &nodeId, bool deleteTargetReferences);
@@ -85,14 +104,200 @@ public Q_SLOTS:
     void modifyPublishRequests();
     void handleSubscriptionTimeout(QOpen62541Subscription *sub, QVector<QPair<quint64, QOpcUa::NodeAttribute>> items);
     void cleanupSubscriptions();
+    void flushDataChanges();
+    void abortServiceRequests(QOpcUa::UaStatusCode status = QOpcUa::UaStatusCode::BadConnectionClosed);
+    void flushCoalescedRequests();
+    void drainCommandQueue();
+    void beginReconnect();
+    void reconnect();
 
 public:
     UA_Client *m_uaclient;
     QOpen62541Client *m_clientImpl;
     bool m_useStateCallback;
+    bool m_batchDataChanges;
+    QOpen62541ValueConverter::ConversionFlags m_conversionFlags;
+    Open62541NodeIdCache m_nodeIdCache;
+    int m_maxRequestsInFlight;
+    int m_coalescingInterval; // Microseconds, coalescing is disabled for negative values
+    int m_coalescingMaxItems;
+    int m_reconnectInterval; // Milliseconds, automatic reconnects are disabled for 0
+    int m_crawlRequestsInFlight;
+    quint32 m_configuredMaxNodesPerRead; // Replaces the limit of the server if not 0
+    quint32 m_configuredMaxNodesPerWrite;
+    Open62541AddressSpaceCache m_addressSpaceCache;
+
+    // Monitored item for the model change events of the server object, requests of the client for it are rejected
+    static constexpr quint64 ModelChangeEventHandle = QOpcUaBackend::InternalHandle;
+    void handleModelChangeEvent(const QVariantList &eventFields);
+
+    void releaseSocketNotifier();
+    void queueDataChange(quint64 handle, const QOpcUaReadResult &result);
+    int maxMonitoredItemsPerCall() const;
+    int readChunkSize(int itemCount) const;
+    int translateBrowsePathsChunkSize(int itemCount) const;
+    void handleServiceResponse(UA_UInt32 requestId, void *response);
+
+    // Queues a call from the client thread, the backend executes it on its own thread
+    template <typename Function>
+    void post(Function &&function)
+    {
+        if (m_commandQueue.push(std::forward<Function>(function)))
+            QMetaObject::invokeMethod(this, &Open62541AsyncBackend::drainCommandQueue, Qt::QueuedConnection);
+    }
 
 private:
+    void setupSocketNotifier();
+    int publishTimerInterval() const;
+    void readOperationLimits();
+    UA_StatusCode connectSession(const QOpcUaEndpointDescription &endpoint);
+    void recoverSubscriptions();
+    void openAddressSpaceCache();
+    void addMonitoredAttributes(quint64 handle, UA_NodeId id, QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings);
+
+    // Context of a service call sent with the asynchronous client API
+    struct ServiceRequest {
+        enum class Type {
+            ReadAttributes,
+            WriteAttributes,
+            ReadNodeAttributes,
+            WriteNodeAttributes,
+            Browse,
+            CallMethod,
+            ResolveBrowsePath,
+            Crawl,
+            ReleaseContinuationPoints,
+            RegisterNodes,
+            UnregisterNodes,
+#ifdef UA_ENABLE_HISTORIZING
+            HistoryRead,
+#endif
+        };
+
+        Type type = Type::ReadAttributes;
+        quint64 handle = 0;
+        void *request = nullptr; // Owned by the backend until the request has been sent
+        const UA_DataType *requestType = nullptr;
+        const UA_DataType *responseType = nullptr;
+
+        quint64 chunkedRequestId = 0; // Set if the request is a chunk of a larger request
+        int chunkOffset = 0;
+        QVector<QPair<quint64, int>> handleRanges; // Node handle and number of consecutive attributes
+        QVector<QOpcUaReadResult> readResults;
+        QVector<QOpcUaReadItem> readItems;
+        QVector<QOpcUaWriteItem> writeItems;
+        QVector<QPair<QOpcUa::NodeAttribute, QVariant>> writtenAttributes;
+        QVector<QOpcUaReferenceDescription> references;
+        QVector<QOpcUaRelativePathElement> path;
+        QString methodNodeId;
+        QVector<QPair<QString, int>> crawlNodes; // Browsed node and its depth
+        QStringList historyNodeIds; // Nodes of a history read request in the order of the request
+        QStringList registeredNodeKeys; // Keys in m_registeredNodes in the order of a register nodes request
+        QString cacheNodeId; // Set if the result is stored in the address space cache
+        QString cacheKey;
+        quint64 readSequence = 0; // Read attribute requests are numbered to order the cache hits after them
+    };
+
+    void sendServiceRequest(const ServiceRequest &request);
+    void dispatchServiceRequest(ServiceRequest request);
+    void dispatchQueuedRequests();
+    void finishServiceRequest(const ServiceRequest &request, UA_StatusCode status);
+    void processServiceResponse(const ServiceRequest &request, void *response);
+    void enableResponseProcessing();
+    bool hasPendingServiceRequests() const;
+
+    // Merged results of requests split into chunks
+    struct ChunkedRequest {
+        int pendingChunks = 0;
+        QOpcUa::UaStatusCode serviceResult = QOpcUa::UaStatusCode::Good;
+        QVector<QOpcUaReadResult> readResults;
+        QVector<QOpcUaWriteResult> writeResults;
+    };
+
+    int chunkSize(quint32 serverLimit, int itemCount) const;
+    quint64 beginChunkedRequest(int itemCount, int chunkSize);
+    void finishReadNodeAttributes(const ServiceRequest &request, const QVector<QOpcUaReadResult> &results,
+                                  QOpcUa::UaStatusCode serviceResult);
+    void finishWriteNodeAttributes(const ServiceRequest &request, const QVector<QOpcUaWriteResult> &results,
+                                   QOpcUa::UaStatusCode serviceResult);
+
+    // Breadth-first traversal started by crawl(), there is at most one at a time
+    struct CrawlNode {
+        UA_NodeId nodeId; // Owned by the frontier until it is moved into a browse request
+        QString nodeIdString;
+        int depth;
+    };
+
+    struct Crawl {
+        quint64 id = 0; // Responses for an abandoned crawl only release their continuation points
+        bool active = false;
+        QOpcUaBrowseRequest request;
+        int maxDepth = -1;
+        QSet<QString> visited;
+        QQueue<CrawlNode> frontier;
+        int requestsInFlight = 0;
+        QOpcUa::UaStatusCode status = QOpcUa::UaStatusCode::Good;
+        bool aborted = false; // A request has failed as a whole, the frontier is no longer expanded
+    };
+
+    void continueCrawl();
+    void processCrawlResponse(const ServiceRequest &request, UA_BrowseResponse *res, QOpcUa::UaStatusCode serviceResult);
+    void releaseContinuationPoints(const UA_BrowseResponse *res);
+    void clearCrawlFrontier();
+
+    // Node ids registered with the RegisterNodes service and the aliases assigned by the server
+    struct RegisteredNode {
+        UA_NodeId alias = UA_NODEID_NULL; // Null if the server has not assigned an alias in the current session
+        Open62541NodeIdKey nodeIdKey; // Key in m_registeredNodeKeys
+        int useCount = 0;
+        quint64 registrationId = 0; // Registration which assigns the alias, responses of other registrations are stale
+    };
+
+    // Requests of registerNodes() and unregisterNodes(), they are finished when all of their chunks have been answered
+    struct NodeRegistration {
+        quint64 handle = 0;
+        QStringList nodeIds; // Empty if the aliases are renewed after a reconnect
+        int pendingChunks = 0;
+        UA_StatusCode status = UA_STATUSCODE_GOOD;
+        bool released = false; // The node has been destroyed before its registration has finished
+    };
+
+    void sendRegisterNodesRequests(quint64 registrationId, const QStringList &nodeIds);
+    void processRegisterNodesResponse(const ServiceRequest &request, UA_RegisterNodesResponse *res, QOpcUa::UaStatusCode serviceResult);
+    void finishNodeRegistration(quint64 registrationId);
+    QVector<UA_NodeId> releaseRegisteredNodes(const QStringList &nodeIds);
+    void sendUnregisterNodesRequests(quint64 unregistrationId, const QVector<UA_NodeId> &aliases);
+    void processUnregisterNodesResponse(const ServiceRequest &request, QOpcUa::UaStatusCode serviceResult);
+    void clearRegisteredNodes();
+    UA_NodeId requestNodeId(const QString &nodeId);
+    void substituteRegisteredNodeId(UA_NodeId *id) const;
+
+#ifdef UA_ENABLE_HISTORIZING
+    // History reads started by readHistoryData(), a read is finished when all of its requests have been answered
+    struct HistoryRead {
+        QOpcUaHistoryReadRequest request;
+        int pendingRequests = 0;
+        QOpcUa::UaStatusCode status = QOpcUa::UaStatusCode::Good;
+    };
+
+    UA_HistoryReadRequest *createHistoryReadRequest(const QOpcUaHistoryReadRequest &request, const QStringList &nodeIds);
+    void sendHistoryReadRequest(quint64 id, UA_HistoryReadRequest *request, const QStringList &nodeIds);
+    void processHistoryReadResponse(const ServiceRequest &request, UA_HistoryReadResponse *res, QOpcUa::UaStatusCode serviceResult);
+#endif
+
+    void flushCoalescedReads();
+    void flushCoalescedWrites();
+    void abortCoalescedRequests(QOpcUa::UaStatusCode status);
+    void emitCachedAttributes(quint64 handle, const QVector<QOpcUaReadResult> &results);
+    void invalidateCachedNode(const QString &nodeId);
+    void clearAddressSpaceCache();
+    bool isCacheInsertAllowed(const QString &nodeId, quint64 readSequence) const;
+    void pruneCacheInvalidations();
+    void scheduleCoalescedRequests(int itemCount, quint32 serverLimit);
+    int maxCoalescedItems(quint32 serverLimit) const;
+
     QOpen62541Subscription *getSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr);
+    QOpen62541Subscription *getClientSubscriptionForItem(quint64 handle, QOpcUa::NodeAttribute attr);
     QOpcUaApplicationDescription convertApplicationDescription(UA_ApplicationDescription &desc);
 
     UA_ExtensionObject assembleNodeAttributes(const QOpcUaNodeCreationAttributes &nodeAttributes, QOpcUa::NodeClass nodeClass);
@@ -102,7 +307,11 @@ private:
     bool loadFileToByteString(const QString &location, UA_ByteString *target) const;
     bool loadAllFilesInDirectory(const QString &location, UA_ByteString **target, int *size) const;
 
+    QOpen62541CommandQueue m_commandQueue;
+    bool m_draining;
+
     QTimer m_subscriptionTimer;
+    QSocketNotifier *m_socketNotifier;
 
     QHash<quint32, QOpen62541Subscription *> m_subscriptions;
 
@@ -111,6 +320,50 @@ private:
     bool m_sendPublishRequests;
 
     double m_minPublishingInterval;
+
+    quint32 m_maxNodesPerRead;
+    quint32 m_maxNodesPerWrite;
+    quint32 m_maxMonitoredItemsPerCall;
+    quint32 m_maxNodesPerBrowse;
+    quint32 m_maxNodesPerRegisterNodes;
+    quint32 m_maxNodesPerHistoryReadData;
+    quint32 m_maxNodesPerTranslateBrowsePaths;
+
+    QVector<QPair<quint64, QOpcUaReadResult>> m_pendingDataChanges;
+
+    QHash<quint32, UA_UInt32> m_tagTableSubscriptions; // Tag table id -> Subscription id
+
+    QHash<UA_UInt32, ServiceRequest> m_pendingRequests; // Request id -> Request
+    QQueue<ServiceRequest> m_queuedRequests; // Requests waiting for a free slot in the window
+
+    QHash<quint64, ChunkedRequest> m_chunkedRequests;
+    quint64 m_nextChunkedRequestId;
+
+    QOpcUaEndpointDescription m_endpoint; // Endpoint of the current connection, used for reconnects
+    QTimer m_reconnectTimer;
+
+    Crawl m_crawl;
+
+    QHash<QString, RegisteredNode> m_registeredNodes;
+    QHash<Open62541NodeIdKey, QString> m_registeredNodeKeys; // Parsed node id -> Key in m_registeredNodes
+    QHash<quint64, NodeRegistration> m_nodeRegistrations;
+    QHash<quint64, NodeRegistration> m_nodeUnregistrations;
+    quint64 m_nextNodeRegistrationId;
+
+#ifdef UA_ENABLE_HISTORIZING
+    QHash<quint64, HistoryRead> m_historyReads;
+    quint64 m_nextHistoryReadId = 1;
+#endif
+
+    QTimer m_coalescingTimer;
+    ServiceRequest m_coalescedRead;
+    QVector<UA_ReadValueId> m_coalescedReadIds;
+    quint64 m_readSequence;
+    QHash<quint64, QVector<QPair<quint64, QVector<QOpcUaReadResult>>>> m_cacheHitsAfterRead; // Read sequence -> Cache hits
+    QHash<QString, quint64> m_cacheInvalidations; // Node id -> Last read sequence sent before the node was invalidated
+    quint64 m_cacheClearedSequence; // Last read sequence sent before the address space cache was cleared
+    ServiceRequest m_coalescedWrite;
+    QVector<UA_WriteValue> m_coalescedWriteValues;
 };
 
 QT_END_NAMESPACE
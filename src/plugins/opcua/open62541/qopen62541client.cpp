@@ -51,10 +51,79 @@ QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
 
-QOpen62541Client::QOpen62541Client()
+QOpen62541Client::QOpen62541Client(const QVariantMap &backendProperties)
     : QOpcUaClientImpl()
     , m_backend(new Open62541AsyncBackend(this))
 {
+    if (backendProperties.value(QLatin1String("disableDataChangeBatching"), false).toBool()) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Disabling data change batching.";
+        m_backend->m_batchDataChanges = false;
+    }
+
+    if (backendProperties.value(QLatin1String("typedArrays"), false).toBool()) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Returning numeric arrays as typed vectors.";
+        m_backend->m_conversionFlags |= QOpen62541ValueConverter::TypedArrays;
+    }
+
+    if (backendProperties.value(QLatin1String("zeroCopyExtensionObjects"), false).toBool()) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Handing over extension object bodies without copying them.";
+        m_backend->m_conversionFlags |= QOpen62541ValueConverter::ZeroCopyExtensionObjects;
+    }
+
+    const int nodeIdCacheSize = backendProperties.value(QLatin1String("nodeIdCacheSize"), 0).toInt();
+    if (nodeIdCacheSize > 0) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Caching up to" << nodeIdCacheSize << "parsed node ids.";
+        m_backend->m_nodeIdCache.setMaxSize(nodeIdCacheSize);
+    }
+
+    if (backendProperties.contains(QLatin1String("maxRequestsInFlight"))) {
+        const int maxRequestsInFlight = qMax(0, backendProperties.value(QLatin1String("maxRequestsInFlight")).toInt());
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Maximum number of requests in flight:" << maxRequestsInFlight;
+        m_backend->m_maxRequestsInFlight = maxRequestsInFlight;
+    }
+
+    const QString cacheDirectory = backendProperties.value(QLatin1String("addressSpaceCacheDirectory")).toString();
+    if (!cacheDirectory.isEmpty()) {
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Caching static attributes and browse results in" << cacheDirectory;
+        m_backend->m_addressSpaceCache.setDirectory(cacheDirectory);
+    }
+
+    if (backendProperties.contains(QLatin1String("crawlRequestsInFlight"))) {
+        const int crawlRequestsInFlight = qMax(0, backendProperties.value(QLatin1String("crawlRequestsInFlight")).toInt());
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Maximum number of crawl requests in flight:" << crawlRequestsInFlight;
+        m_backend->m_crawlRequestsInFlight = crawlRequestsInFlight;
+    }
+
+    if (backendProperties.contains(QLatin1String("maxNodesPerRead"))) {
+        const quint32 maxNodes = qMax(0, backendProperties.value(QLatin1String("maxNodesPerRead")).toInt());
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Maximum number of nodes per Read request:" << maxNodes;
+        m_backend->m_configuredMaxNodesPerRead = maxNodes;
+    }
+
+    if (backendProperties.contains(QLatin1String("maxNodesPerWrite"))) {
+        const quint32 maxNodes = qMax(0, backendProperties.value(QLatin1String("maxNodesPerWrite")).toInt());
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Maximum number of nodes per Write request:" << maxNodes;
+        m_backend->m_configuredMaxNodesPerWrite = maxNodes;
+    }
+
+    if (backendProperties.contains(QLatin1String("reconnectInterval"))) {
+        const int interval = qMax(0, backendProperties.value(QLatin1String("reconnectInterval")).toInt());
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Reconnecting every" << interval << "milliseconds after the connection has been lost.";
+        m_backend->m_reconnectInterval = interval;
+    }
+
+    if (backendProperties.contains(QLatin1String("requestCoalescingInterval"))) {
+        const int interval = qMax(0, backendProperties.value(QLatin1String("requestCoalescingInterval")).toInt());
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Coalescing reads and writes for" << interval << "microseconds.";
+        m_backend->m_coalescingInterval = interval;
+    }
+
+    if (backendProperties.contains(QLatin1String("requestCoalescingMaxItems"))) {
+        const int maxItems = qMax(0, backendProperties.value(QLatin1String("requestCoalescingMaxItems")).toInt());
+        qCDebug(QT_OPCUA_PLUGINS_OPEN62541) << "Maximum number of coalesced items per request:" << maxItems;
+        m_backend->m_coalescingMaxItems = maxItems;
+    }
+
     m_thread = new QThread();
     connectBackendWithClient(m_backend);
     m_backend->moveToThread(m_thread);
@@ -71,18 +140,23 @@ QOpen62541Client::~QOpen62541Client()
 
 void QOpen62541Client::connectToEndpoint(const QOpcUaEndpointDescription &endpoint)
 {
-    QMetaObject::invokeMethod(m_backend, "connectToEndpoint", Qt::QueuedConnection,
-                                     Q_ARG(QOpcUaEndpointDescription, endpoint));
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, endpoint]() {
+        backend->connectToEndpoint(endpoint);
+    });
 }
 
 void QOpen62541Client::disconnectFromEndpoint()
 {
-    QMetaObject::invokeMethod(m_backend, "disconnectFromEndpoint", Qt::QueuedConnection);
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend]() {
+        backend->disconnectFromEndpoint();
+    });
 }
 
 QOpcUaNode *QOpen62541Client::node(const QString &nodeId)
 {
-    UA_NodeId uaNodeId = Open62541Utils::nodeIdFromQString(nodeId);
+    UA_NodeId uaNodeId = m_backend->m_nodeIdCache.nodeIdFromQString(nodeId);
     if (UA_NodeId_isNull(&uaNodeId))
         return nullptr;
 
@@ -102,52 +176,157 @@ QString QOpen62541Client::backend() const
 
 bool QOpen62541Client::requestEndpoints(const QUrl &url)
 {
-    return QMetaObject::invokeMethod(m_backend, "requestEndpoints", Qt::QueuedConnection, Q_ARG(QUrl, url));
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, url]() {
+        backend->requestEndpoints(url);
+    });
+    return true;
 }
 
 bool QOpen62541Client::findServers(const QUrl &url, const QStringList &localeIds, const QStringList &serverUris)
 {
-   return QMetaObject::invokeMethod(m_backend, "findServers", Qt::QueuedConnection,
-                                    Q_ARG(QUrl, url),
-                                    Q_ARG(QStringList, localeIds),
-                                    Q_ARG(QStringList, serverUris));
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, url, localeIds, serverUris]() {
+        backend->findServers(url, localeIds, serverUris);
+    });
+    return true;
 }
 
 bool QOpen62541Client::readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead)
 {
-    return QMetaObject::invokeMethod(m_backend, "readNodeAttributes", Qt::QueuedConnection,
-                                     Q_ARG(QVector<QOpcUaReadItem>, nodesToRead));
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, nodesToRead]() {
+        backend->readNodeAttributes(nodesToRead);
+    });
+    return true;
 }
 
 bool QOpen62541Client::writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite)
 {
-    return QMetaObject::invokeMethod(m_backend, "writeNodeAttributes", Qt::QueuedConnection,
-                                     Q_ARG(QVector<QOpcUaWriteItem>, nodesToWrite));
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, nodesToWrite]() {
+        backend->writeNodeAttributes(nodesToWrite);
+    });
+    return true;
+}
+
+bool QOpen62541Client::createMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items)
+{
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, handles, items]() {
+        backend->createMonitoredItems(handles, items);
+    });
+    return true;
+}
+
+bool QOpen62541Client::deleteMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items)
+{
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, handles, items]() {
+        backend->deleteMonitoredItems(handles, items);
+    });
+    return true;
+}
+
+bool QOpen62541Client::modifyMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items)
+{
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, handles, items]() {
+        backend->modifyMonitoredItems(handles, items);
+    });
+    return true;
+}
+
+bool QOpen62541Client::createTagMonitoredItems(quint32 tableId, const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings)
+{
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, tableId, table, settings]() {
+        backend->createTagMonitoredItems(tableId, table, settings);
+    });
+    return true;
+}
+
+bool QOpen62541Client::deleteTagMonitoredItems(quint32 tableId)
+{
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, tableId]() {
+        backend->deleteTagMonitoredItems(tableId);
+    });
+    return true;
 }
 
+bool QOpen62541Client::startCrawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request, int maxDepth)
+{
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, startNodeIds, request, maxDepth]() {
+        backend->crawl(startNodeIds, request, maxDepth);
+    });
+    return true;
+}
+
+bool QOpen62541Client::registerNodes(quint64 handle, const QStringList &nodeIds)
+{
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, handle, nodeIds]() {
+        backend->registerNodes(handle, nodeIds);
+    });
+    return true;
+}
+
+bool QOpen62541Client::unregisterNodes(quint64 handle, const QStringList &nodeIds)
+{
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, handle, nodeIds]() {
+        backend->unregisterNodes(handle, nodeIds);
+    });
+    return true;
+}
+
+#ifdef UA_ENABLE_HISTORIZING
+bool QOpen62541Client::readHistoryData(const QOpcUaHistoryReadRequest &request)
+{
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, request]() {
+        backend->readHistoryData(request);
+    });
+    return true;
+}
+#endif
+
 bool QOpen62541Client::addNode(const QOpcUaAddNodeItem &nodeToAdd)
 {
-    return QMetaObject::invokeMethod(m_backend, "addNode", Qt::QueuedConnection,
-                                     Q_ARG(QOpcUaAddNodeItem, nodeToAdd));
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, nodeToAdd]() {
+        backend->addNode(nodeToAdd);
+    });
+    return true;
 }
 
 bool QOpen62541Client::deleteNode(const QString &nodeId, bool deleteTargetReferences)
 {
-    return QMetaObject::invokeMethod(m_backend, "deleteNode", Qt::QueuedConnection,
-                                     Q_ARG(QString, nodeId),
-                                     Q_ARG(bool, deleteTargetReferences));
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, nodeId, deleteTargetReferences]() {
+        backend->deleteNode(nodeId, deleteTargetReferences);
+    });
+    return true;
 }
 
 bool QOpen62541Client::addReference(const QOpcUaAddReferenceItem &referenceToAdd)
 {
-    return QMetaObject::invokeMethod(m_backend, "addReference", Qt::QueuedConnection,
-                                     Q_ARG(QOpcUaAddReferenceItem, referenceToAdd));
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, referenceToAdd]() {
+        backend->addReference(referenceToAdd);
+    });
+    return true;
 }
 
 bool QOpen62541Client::deleteReference(const QOpcUaDeleteReferenceItem &referenceToDelete)
 {
-    return QMetaObject::invokeMethod(m_backend, "deleteReference", Qt::QueuedConnection,
-                                     Q_ARG(QOpcUaDeleteReferenceItem, referenceToDelete));
+    Open62541AsyncBackend *backend = m_backend;
+    backend->post([backend, referenceToDelete]() {
+        backend->deleteReference(referenceToDelete);
+    });
+    return true;
 }
 
 QStringList QOpen62541Client::supportedSecurityPolicies() const
@@ -51,7 +51,7 @@ class QOpen62541Client : public QOpcUaClientImpl
     Q_OBJECT
 
 public:
-    explicit QOpen62541Client();
+    explicit QOpen62541Client(const QVariantMap &backendProperties);
     ~QOpen62541Client();
 
     void connectToEndpoint(const QOpcUaEndpointDescription &endpoint) override;
@@ -68,6 +68,19 @@ public:
     bool readNodeAttributes(const QVector<QOpcUaReadItem> &nodesToRead) override;
     bool writeNodeAttributes(const QVector<QOpcUaWriteItem> &nodesToWrite) override;
 
+    bool createMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items) override;
+    bool deleteMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items) override;
+    bool createTagMonitoredItems(quint32 tableId, const QOpcUaTagTable &table, const QOpcUaMonitoringParameters &settings) override;
+    bool deleteTagMonitoredItems(quint32 tableId) override;
+    bool startCrawl(const QStringList &startNodeIds, const QOpcUaBrowseRequest &request, int maxDepth) override;
+    bool modifyMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &items) override;
+    bool registerNodes(quint64 handle, const QStringList &nodeIds) override;
+    bool unregisterNodes(quint64 handle, const QStringList &nodeIds) override;
+#ifdef UA_ENABLE_HISTORIZING
+    // The HistoryRead service types are only generated if open62541 has been built with historizing support
+    bool readHistoryData(const QOpcUaHistoryReadRequest &request) override;
+#endif
+
     bool addNode(const QOpcUaAddNodeItem &nodeToAdd) override;
     bool deleteNode(const QString &nodeId, bool deleteTargetReferences) override;
 
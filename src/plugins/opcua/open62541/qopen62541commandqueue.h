@@ -0,0 +1,152 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef QOPEN62541COMMANDQUEUE_H
+#define QOPEN62541COMMANDQUEUE_H
+
+#include <QtCore/qglobal.h>
+
+#include <atomic>
+#include <utility>
+
+QT_BEGIN_NAMESPACE
+
+// Intrusive multi producer, single consumer queue (D. Vyukov) which carries commands
+// from the client thread to the backend thread.
+// push() may be called from any thread, drain() only from the thread owning the queue.
+class QOpen62541CommandQueue
+{
+public:
+    QOpen62541CommandQueue()
+        : m_head(&m_stub)
+        , m_tail(&m_stub)
+        , m_drainPending(false)
+    {}
+
+    ~QOpen62541CommandQueue()
+    {
+        while (Command *command = pop())
+            delete command;
+    }
+
+    // Returns true if the consumer must be woken up to drain the queue
+    template <typename Function>
+    bool push(Function &&function)
+    {
+        enqueue(new FunctionCommand<typename std::decay<Function>::type>(std::forward<Function>(function)));
+        return !m_drainPending.exchange(true);
+    }
+
+    // Executes all commands pushed so far and returns their number
+    int drain()
+    {
+        // Reset before popping so a producer racing with the drain schedules another one
+        m_drainPending.store(false);
+
+        int count = 0;
+        while (Command *command = pop()) {
+            command->execute();
+            delete command;
+            ++count;
+        }
+        return count;
+    }
+
+private:
+    Q_DISABLE_COPY(QOpen62541CommandQueue)
+
+    struct Command {
+        virtual ~Command() = default;
+        virtual void execute() {}
+        std::atomic<Command *> next {nullptr};
+    };
+
+    template <typename Function>
+    struct FunctionCommand : Command {
+        template <typename F>
+        explicit FunctionCommand(F &&f) : function(std::forward<F>(f)) {}
+        void execute() override { function(); }
+        Function function;
+    };
+
+    void enqueue(Command *command)
+    {
+        command->next.store(nullptr, std::memory_order_relaxed);
+        Command *previous = m_head.exchange(command);
+        previous->next.store(command);
+    }
+
+    // Returns nullptr if the queue is empty or a producer has not finished linking its command yet.
+    // In the latter case, the producer has already requested another drain.
+    Command *pop()
+    {
+        Command *tail = m_tail;
+        Command *next = tail->next.load();
+
+        if (tail == &m_stub) {
+            if (!next)
+                return nullptr;
+            m_tail = next;
+            tail = next;
+            next = next->next.load();
+        }
+
+        if (next) {
+            m_tail = next;
+            return tail;
+        }
+
+        if (tail != m_head.load())
+            return nullptr;
+
+        enqueue(&m_stub);
+        next = tail->next.load();
+        if (next) {
+            m_tail = next;
+            return tail;
+        }
+        return nullptr;
+    }
+
+    std::atomic<Command *> m_head;
+    Command *m_tail;
+    Command m_stub;
+    std::atomic<bool> m_drainPending;
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPEN62541COMMANDQUEUE_H
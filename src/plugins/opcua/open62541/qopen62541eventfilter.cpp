@@ -0,0 +1,301 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include "qopen62541eventfilter.h"
+#include "qopen62541valueconverter.h"
+
+#include <QtCore/qhash.h>
+
+QT_BEGIN_NAMESPACE
+
+class QOpen62541EventColumn
+{
+public:
+    virtual ~QOpen62541EventColumn() = default;
+    // Returns false if the field doesn't have the type of the column
+    virtual bool append(const UA_Variant &field) = 0;
+    virtual QVariant take() = 0;
+    virtual QVariantList takeList() = 0;
+};
+
+namespace {
+
+template <typename QTTYPE, typename UATYPE>
+QTTYPE convertField(const UATYPE *data)
+{
+    return static_cast<QTTYPE>(*data);
+}
+
+template <>
+QString convertField<QString, UA_String>(const UA_String *data)
+{
+    return QOpen62541ValueConverter::scalarToQt<QString, UA_String>(data);
+}
+
+template <>
+QString convertField<QString, UA_NodeId>(const UA_NodeId *data)
+{
+    return QOpen62541ValueConverter::scalarToQt<QString, UA_NodeId>(data);
+}
+
+template <>
+QByteArray convertField<QByteArray, UA_ByteString>(const UA_ByteString *data)
+{
+    return QOpen62541ValueConverter::scalarToQt<QByteArray, UA_ByteString>(data);
+}
+
+template <>
+QDateTime convertField<QDateTime, UA_DateTime>(const UA_DateTime *data)
+{
+    return QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(data);
+}
+
+template <>
+QOpcUaLocalizedText convertField<QOpcUaLocalizedText, UA_LocalizedText>(const UA_LocalizedText *data)
+{
+    return QOpen62541ValueConverter::scalarToQt<QOpcUaLocalizedText, UA_LocalizedText>(data);
+}
+
+template <typename QTTYPE, typename UATYPE, int TYPEINDEX>
+class TypedEventColumn : public QOpen62541EventColumn
+{
+public:
+    bool append(const UA_Variant &field) override
+    {
+        if (field.type != &UA_TYPES[TYPEINDEX] || !UA_Variant_isScalar(&field))
+            return false;
+        m_values.append(convertField<QTTYPE, UATYPE>(static_cast<const UATYPE *>(field.data)));
+        return true;
+    }
+
+    QVariant take() override
+    {
+        const QVariant result = QVariant::fromValue(m_values);
+        m_values.clear();
+        return result;
+    }
+
+    QVariantList takeList() override
+    {
+        QVariantList result;
+        result.reserve(m_values.size());
+        for (const auto &value : qAsConst(m_values))
+            result.append(QVariant::fromValue(value));
+        m_values.clear();
+        return result;
+    }
+
+private:
+    QVector<QTTYPE> m_values;
+};
+
+class GenericEventColumn : public QOpen62541EventColumn
+{
+public:
+    explicit GenericEventColumn(QVariantList values = QVariantList())
+        : m_values(std::move(values))
+    {}
+
+    bool append(const UA_Variant &field) override
+    {
+        m_values.append(QOpen62541ValueConverter::toQVariant(field));
+        return true;
+    }
+
+    QVariant take() override
+    {
+        const QVariant result = m_values;
+        m_values.clear();
+        return result;
+    }
+
+    QVariantList takeList() override
+    {
+        QVariantList result;
+        result.swap(m_values);
+        return result;
+    }
+
+private:
+    QVariantList m_values;
+};
+
+std::unique_ptr<QOpen62541EventColumn> createColumn(int typeIndex)
+{
+    switch (typeIndex) {
+    case UA_TYPES_BOOLEAN:
+        return std::make_unique<TypedEventColumn<bool, UA_Boolean, UA_TYPES_BOOLEAN>>();
+    case UA_TYPES_SBYTE:
+        return std::make_unique<TypedEventColumn<qint8, UA_SByte, UA_TYPES_SBYTE>>();
+    case UA_TYPES_BYTE:
+        return std::make_unique<TypedEventColumn<quint8, UA_Byte, UA_TYPES_BYTE>>();
+    case UA_TYPES_INT16:
+        return std::make_unique<TypedEventColumn<qint16, UA_Int16, UA_TYPES_INT16>>();
+    case UA_TYPES_UINT16:
+        return std::make_unique<TypedEventColumn<quint16, UA_UInt16, UA_TYPES_UINT16>>();
+    case UA_TYPES_INT32:
+        return std::make_unique<TypedEventColumn<qint32, UA_Int32, UA_TYPES_INT32>>();
+    case UA_TYPES_UINT32:
+        return std::make_unique<TypedEventColumn<quint32, UA_UInt32, UA_TYPES_UINT32>>();
+    case UA_TYPES_INT64:
+        return std::make_unique<TypedEventColumn<qint64, UA_Int64, UA_TYPES_INT64>>();
+    case UA_TYPES_UINT64:
+        return std::make_unique<TypedEventColumn<quint64, UA_UInt64, UA_TYPES_UINT64>>();
+    case UA_TYPES_FLOAT:
+        return std::make_unique<TypedEventColumn<float, UA_Float, UA_TYPES_FLOAT>>();
+    case UA_TYPES_DOUBLE:
+        return std::make_unique<TypedEventColumn<double, UA_Double, UA_TYPES_DOUBLE>>();
+    case UA_TYPES_STRING:
+        return std::make_unique<TypedEventColumn<QString, UA_String, UA_TYPES_STRING>>();
+    case UA_TYPES_NODEID:
+        return std::make_unique<TypedEventColumn<QString, UA_NodeId, UA_TYPES_NODEID>>();
+    case UA_TYPES_BYTESTRING:
+        return std::make_unique<TypedEventColumn<QByteArray, UA_ByteString, UA_TYPES_BYTESTRING>>();
+    case UA_TYPES_DATETIME:
+        return std::make_unique<TypedEventColumn<QDateTime, UA_DateTime, UA_TYPES_DATETIME>>();
+    case UA_TYPES_LOCALIZEDTEXT:
+        return std::make_unique<TypedEventColumn<QOpcUaLocalizedText, UA_LocalizedText, UA_TYPES_LOCALIZEDTEXT>>();
+    default:
+        return std::make_unique<GenericEventColumn>();
+    }
+}
+
+// Data types of the fields of BaseEventType, OPC-UA part 5, 6.4.2
+int baseEventFieldType(const QOpcUaSimpleAttributeOperand &operand)
+{
+    if (operand.attributeId() != QOpcUa::NodeAttribute::Value || !operand.indexRange().isEmpty()
+            || operand.browsePath().size() != 1 || operand.browsePath().constFirst().namespaceIndex() != 0)
+        return -1;
+
+    static const QHash<QString, int> types = {
+        {QStringLiteral("EventId"), UA_TYPES_BYTESTRING},
+        {QStringLiteral("EventType"), UA_TYPES_NODEID},
+        {QStringLiteral("SourceNode"), UA_TYPES_NODEID},
+        {QStringLiteral("SourceName"), UA_TYPES_STRING},
+        {QStringLiteral("Time"), UA_TYPES_DATETIME},
+        {QStringLiteral("ReceiveTime"), UA_TYPES_DATETIME},
+        {QStringLiteral("Message"), UA_TYPES_LOCALIZEDTEXT},
+        {QStringLiteral("Severity"), UA_TYPES_UINT16}
+    };
+
+    return types.value(operand.browsePath().constFirst().name(), -1);
+}
+
+} // namespace
+
+QOpen62541CompiledEventFilter::QOpen62541CompiledEventFilter()
+{
+}
+
+QOpen62541CompiledEventFilter::QOpen62541CompiledEventFilter(const QOpcUaMonitoringParameters::EventFilter &filter)
+{
+    const auto selectClauses = filter.selectClauses();
+    m_fieldNames.reserve(selectClauses.size());
+    m_fieldTypes.reserve(selectClauses.size());
+
+    for (const auto &operand : selectClauses) {
+        QStringList path;
+        for (const auto &element : operand.browsePath())
+            path.append(element.name());
+        m_fieldNames.append(path.join(QLatin1Char('/')));
+        m_fieldTypes.append(baseEventFieldType(operand));
+    }
+}
+
+QOpen62541CompiledEventFilter::QOpen62541CompiledEventFilter(QOpen62541CompiledEventFilter &&other) = default;
+QOpen62541CompiledEventFilter &QOpen62541CompiledEventFilter::operator=(QOpen62541CompiledEventFilter &&other) = default;
+
+QOpen62541CompiledEventFilter::~QOpen62541CompiledEventFilter()
+{
+}
+
+void QOpen62541CompiledEventFilter::appendEvent(size_t numFields, const UA_Variant *fields)
+{
+    const int columnCount = m_fieldTypes.size();
+
+    if (m_columns.empty()) {
+        m_columns.reserve(columnCount);
+        for (int i = 0; i < columnCount; ++i) {
+            // The type of a field without a known type is taken from its first occurrence
+            if (m_fieldTypes.at(i) < 0 && static_cast<size_t>(i) < numFields) {
+                const UA_DataType *type = fields[i].type;
+                if (type && UA_Variant_isScalar(&fields[i]) && type->typeIndex < UA_TYPES_COUNT
+                        && type == &UA_TYPES[type->typeIndex])
+                    m_fieldTypes[i] = type->typeIndex;
+            }
+            m_columns.push_back(createColumn(m_fieldTypes.at(i)));
+        }
+    }
+
+    UA_Variant empty;
+    UA_Variant_init(&empty);
+
+    for (int i = 0; i < columnCount; ++i) {
+        const UA_Variant &field = static_cast<size_t>(i) < numFields ? fields[i] : empty;
+        auto &column = m_columns[i];
+        if (!column->append(field)) {
+            // Fields of a different type or missing fields turn the column into a generic column for this batch
+            column.reset(new GenericEventColumn(column->takeList()));
+            column->append(field);
+        }
+    }
+
+    ++m_eventCount;
+}
+
+bool QOpen62541CompiledEventFilter::hasEvents() const
+{
+    return m_eventCount > 0;
+}
+
+QOpcUaEventBatch QOpen62541CompiledEventFilter::takeEvents()
+{
+    QVariantList columns;
+    columns.reserve(static_cast<int>(m_columns.size()));
+    for (const auto &column : m_columns)
+        columns.append(column->take());
+
+    QOpcUaEventBatch batch;
+    batch.setCount(m_eventCount);
+    batch.setFieldNames(m_fieldNames);
+    batch.setFields(columns);
+
+    m_columns.clear();
+    m_eventCount = 0;
+
+    return batch;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,80 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef QOPEN62541EVENTFILTER_H
+#define QOPEN62541EVENTFILTER_H
+
+#include "qopen62541.h"
+#include <QtOpcUa/qopcuaeventbatch.h>
+#include <QtOpcUa/qopcuamonitoringparameters.h>
+
+#include <QtCore/qstringlist.h>
+#include <QtCore/qvector.h>
+
+#include <memory>
+#include <vector>
+
+QT_BEGIN_NAMESPACE
+
+class QOpen62541EventColumn;
+
+// Event filter of a monitored item, analyzed once when the item is created or its filter is modified.
+// The fields of received events are appended to one column per select clause, columns of fields with
+// a known or previously seen type are converted directly into a typed vector.
+class QOpen62541CompiledEventFilter
+{
+public:
+    QOpen62541CompiledEventFilter();
+    explicit QOpen62541CompiledEventFilter(const QOpcUaMonitoringParameters::EventFilter &filter);
+    QOpen62541CompiledEventFilter(QOpen62541CompiledEventFilter &&other);
+    QOpen62541CompiledEventFilter &operator=(QOpen62541CompiledEventFilter &&other);
+    ~QOpen62541CompiledEventFilter();
+
+    void appendEvent(size_t numFields, const UA_Variant *fields);
+    bool hasEvents() const;
+    QOpcUaEventBatch takeEvents();
+
+private:
+    QStringList m_fieldNames;
+    QVector<int> m_fieldTypes; // Index into UA_TYPES for each select clause, -1 if the type is not known yet
+    std::vector<std::unique_ptr<QOpen62541EventColumn>> m_columns;
+    int m_eventCount = 0;
+
+    Q_DISABLE_COPY(QOpen62541CompiledEventFilter)
+};
+
+QT_END_NAMESPACE
+
+#endif // QOPEN62541EVENTFILTER_H
@@ -50,15 +50,25 @@ QOpen62541Node::QOpen62541Node(const UA_NodeId nodeId, QOpen62541Client *client,
     : m_client(client)
     , m_nodeIdString(nodeIdString)
     , m_nodeId(nodeId)
+    , m_nodeIdRegistration(NodeIdRegistration::None)
 {
     bool success = m_client->registerNode(this);
     setRegistered(success);
+
+    QObject::connect(this, &QOpcUaNodeImpl::registerNodeIdFinished, this,
+                     [this](const QString &, QOpcUa::UaStatusCode statusCode) {
+        m_nodeIdRegistration = statusCode == QOpcUa::UaStatusCode::Good ? NodeIdRegistration::Registered : NodeIdRegistration::None;
+    });
 }
 
 QOpen62541Node::~QOpen62541Node()
 {
-    if (m_client)
+    if (m_client) {
+        // A pending registration is released by the backend when it has finished
+        if (m_nodeIdRegistration != NodeIdRegistration::None)
+            m_client->unregisterNodes(handle(), {m_nodeIdString});
         m_client->unregisterNode(this);
+    }
 
     UA_NodeId_deleteMembers(&m_nodeId);
 }
@@ -70,12 +80,12 @@ bool QOpen62541Node::readAttributes(QOpcUa::NodeAttributes attr, const QString &
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "readAttributes",
-                                     Qt::QueuedConnection,
-                                     Q_ARG(quint64, handle()),
-                                     Q_ARG(UA_NodeId, tempId),
-                                     Q_ARG(QOpcUa::NodeAttributes, attr),
-                                     Q_ARG(QString, indexRange));
+    const quint64 nodeHandle = handle();
+    Open62541AsyncBackend *backend = m_client->m_backend;
+    backend->post([backend, nodeHandle, tempId, attr, indexRange]() {
+        backend->readAttributes(nodeHandle, tempId, attr, indexRange);
+    });
+    return true;
 }
 
 bool QOpen62541Node::enableMonitoring(QOpcUa::NodeAttributes attr, const QOpcUaMonitoringParameters &settings)
@@ -85,12 +95,12 @@ bool QOpen62541Node::enableMonitoring(QOpcUa::NodeAttributes attr, const QOpcUaM
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "enableMonitoring",
-                                     Qt::QueuedConnection,
-                                     Q_ARG(quint64, handle()),
-                                     Q_ARG(UA_NodeId, tempId),
-                                     Q_ARG(QOpcUa::NodeAttributes, attr),
-                                     Q_ARG(QOpcUaMonitoringParameters, settings));
+    const quint64 nodeHandle = handle();
+    Open62541AsyncBackend *backend = m_client->m_backend;
+    backend->post([backend, nodeHandle, tempId, attr, settings]() {
+        backend->enableMonitoring(nodeHandle, tempId, attr, settings);
+    });
+    return true;
 }
 
 bool QOpen62541Node::disableMonitoring(QOpcUa::NodeAttributes attr)
@@ -98,10 +108,12 @@ bool QOpen62541Node::disableMonitoring(QOpcUa::NodeAttributes attr)
     if (!m_client)
         return false;
 
-    return QMetaObject::invokeMethod(m_client->m_backend, "disableMonitoring",
-                                     Qt::QueuedConnection,
-                                     Q_ARG(quint64, handle()),
-                                     Q_ARG(QOpcUa::NodeAttributes, attr));
+    const quint64 nodeHandle = handle();
+    Open62541AsyncBackend *backend = m_client->m_backend;
+    backend->post([backend, nodeHandle, attr]() {
+        backend->disableMonitoring(nodeHandle, attr);
+    });
+    return true;
 }
 
 bool QOpen62541Node::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, const QVariant &value)
@@ -109,12 +121,12 @@ bool QOpen62541Node::modifyMonitoring(QOpcUa::NodeAttribute attr, QOpcUaMonitori
     if (!m_client)
         return false;
 
-    return QMetaObject::invokeMethod(m_client->m_backend, "modifyMonitoring",
-                                     Qt::QueuedConnection,
-                                     Q_ARG(quint64, handle()),
-                                     Q_ARG(QOpcUa::NodeAttribute, attr),
-                                     Q_ARG(QOpcUaMonitoringParameters::Parameter, item),
-                                     Q_ARG(QVariant, value));
+    const quint64 nodeHandle = handle();
+    Open62541AsyncBackend *backend = m_client->m_backend;
+    backend->post([backend, nodeHandle, attr, item, value]() {
+        backend->modifyMonitoring(nodeHandle, attr, item, value);
+    });
+    return true;
 }
 
 QString QOpen62541Node::nodeId() const
@@ -129,11 +141,12 @@ bool QOpen62541Node::browse(const QOpcUaBrowseRequest &request)
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "browse",
-                                     Qt::QueuedConnection,
-                                     Q_ARG(quint64, handle()),
-                                     Q_ARG(UA_NodeId, tempId),
-                                     Q_ARG(QOpcUaBrowseRequest, request));
+    const quint64 nodeHandle = handle();
+    Open62541AsyncBackend *backend = m_client->m_backend;
+    backend->post([backend, nodeHandle, tempId, request]() {
+        backend->browse(nodeHandle, tempId, request);
+    });
+    return true;
 }
 
 bool QOpen62541Node::writeAttribute(QOpcUa::NodeAttribute attribute, const QVariant &value, QOpcUa::Types type, const QString &indexRange)
@@ -143,14 +156,12 @@ bool QOpen62541Node::writeAttribute(QOpcUa::NodeAttribute attribute, const QVari
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "writeAttribute",
-                                     Qt::QueuedConnection,
-                                     Q_ARG(quint64, handle()),
-                                     Q_ARG(UA_NodeId, tempId),
-                                     Q_ARG(QOpcUa::NodeAttribute, attribute),
-                                     Q_ARG(QVariant, value),
-                                     Q_ARG(QOpcUa::Types, type),
-                                     Q_ARG(QString, indexRange));
+    const quint64 nodeHandle = handle();
+    Open62541AsyncBackend *backend = m_client->m_backend;
+    backend->post([backend, nodeHandle, tempId, attribute, value, type, indexRange]() {
+        backend->writeAttribute(nodeHandle, tempId, attribute, value, type, indexRange);
+    });
+    return true;
 }
 
 bool QOpen62541Node::writeAttributes(const QOpcUaNode::AttributeMap &toWrite, QOpcUa::Types valueAttributeType)
@@ -160,12 +171,12 @@ bool QOpen62541Node::writeAttributes(const QOpcUaNode::AttributeMap &toWrite, QO
 
     UA_NodeId tempId;
     UA_NodeId_copy(&m_nodeId, &tempId);
-    return QMetaObject::invokeMethod(m_client->m_backend, "writeAttributes",
-                                     Qt::QueuedConnection,
-                                     Q_ARG(quint64, handle()),
-                                     Q_ARG(UA_NodeId, tempId),
-                                     Q_ARG(QOpcUaNode::AttributeMap, toWrite),
-                                     Q_ARG(QOpcUa::Types, valueAttributeType));
+    const quint64 nodeHandle = handle();
+    Open62541AsyncBackend *backend = m_client->m_backend;
+    backend->post([backend, nodeHandle, tempId, toWrite, valueAttributeType]() {
+        backend->writeAttributes(nodeHandle, tempId, toWrite, valueAttributeType);
+    });
+    return true;
 }
 
 bool QOpen62541Node::callMethod(const QString &methodNodeId, const QVector<QOpcUa::TypedVariant> &args)
@@ -175,12 +186,13 @@ bool QOpen62541Node::callMethod(const QString &methodNodeId, const QVector<QOpcU
 
     UA_NodeId obj;
     UA_NodeId_copy(&m_nodeId, &obj);
-    return QMetaObject::invokeMethod(m_client->m_backend, "callMethod",
-                                     Qt::QueuedConnection,
-                                     Q_ARG(quint64, handle()),
-                                     Q_ARG(UA_NodeId, obj),
-                                     Q_ARG(UA_NodeId, Open62541Utils::nodeIdFromQString(methodNodeId)),
-                                     Q_ARG(QVector<QOpcUa::TypedVariant>, args));
+    const UA_NodeId methodId = Open62541Utils::nodeIdFromQString(methodNodeId);
+    const quint64 nodeHandle = handle();
+    Open62541AsyncBackend *backend = m_client->m_backend;
+    backend->post([backend, nodeHandle, obj, methodId, args]() {
+        backend->callMethod(nodeHandle, obj, methodId, args);
+    });
+    return true;
 }
 
 bool QOpen62541Node::resolveBrowsePath(const QVector<QOpcUaRelativePathElement> &path)
@@ -191,10 +203,26 @@ bool QOpen62541Node::resolveBrowsePath(const QVector<QOpcUaRelativePathElement>
     UA_NodeId start;
     UA_NodeId_copy(&m_nodeId, &start);
 
-    return QMetaObject::invokeMethod(m_client->m_backend, "resolveBrowsePath", Qt::QueuedConnection,
-                                             Q_ARG(quint64, handle()),
-                                             Q_ARG(UA_NodeId, start),
-                                             Q_ARG(QVector<QOpcUaRelativePathElement>, path));
+    const quint64 nodeHandle = handle();
+    Open62541AsyncBackend *backend = m_client->m_backend;
+    backend->post([backend, nodeHandle, start, path]() {
+        backend->resolveBrowsePath(nodeHandle, start, path);
+    });
+    return true;
+}
+
+bool QOpen62541Node::registerNodeId()
+{
+    // The registration is released when the node is destroyed, a node holds at most one
+    if (!m_client || m_nodeIdRegistration != NodeIdRegistration::None)
+        return false;
+
+    if (!m_client->registerNodes(handle(), {m_nodeIdString}))
+        return false;
+
+    // The node id counts as registered when registerNodeIdFinished() reports success
+    m_nodeIdRegistration = NodeIdRegistration::Pending;
+    return true;
 }
 
 QT_END_NAMESPACE
@@ -63,10 +63,18 @@ public:
 
     bool resolveBrowsePath(const QVector<QOpcUaRelativePathElement> &path) override;
 
+    bool registerNodeId() override;
+
 private:
     QPointer<QOpen62541Client> m_client;
     QString m_nodeIdString;
     UA_NodeId m_nodeId;
+    enum class NodeIdRegistration {
+        None,
+        Pending,
+        Registered
+    };
+    NodeIdRegistration m_nodeIdRegistration;
 };
 
 QT_END_NAMESPACE
@@ -41,7 +41,9 @@
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
 #include "qopen62541utils.h"
+#include <private/qopcuamonitoringparameters_p.h>
 #include <private/qopcuanode_p.h>
+#include <private/qopcuatagtable_p.h>
 
 #include "qopcuaelementoperand.h"
 #include "qopcualiteraloperand.h"
@@ -49,11 +51,74 @@
 #include "qopcuacontentfilterelementresult.h"
 
 #include <QtCore/qloggingcategory.h>
+#include <QtCore/qmath.h>
+#include <QtCore/qnumeric.h>
+
+#include <vector>
 
 QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
 
+template <typename T>
+static void appendNumericValues(const UA_Variant &value, QVector<double> *out)
+{
+    const T *data = static_cast<const T *>(value.data);
+    const size_t size = UA_Variant_isScalar(&value) ? 1 : value.arrayLength;
+    for (size_t i = 0; i < size; ++i)
+        out->append(static_cast<double>(data[i]));
+}
+
+// A percent deadband refers to the EURange of the node (OPC-UA part 8, 6.2)
+static bool needsEURange(QOpcUa::NodeAttribute attr, const QOpcUaMonitoringParameters &settings)
+{
+    return attr == QOpcUa::NodeAttribute::Value &&
+            settings.clientSideFilter().deadbandType() == QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Percent;
+}
+
+// Returns false if the deadband can't be applied to the value
+static bool numericValues(const UA_Variant &value, QVector<double> *out)
+{
+    out->clear();
+    if (!value.type)
+        return false;
+
+    switch (value.type->typeIndex) {
+    case UA_TYPES_SBYTE:
+        appendNumericValues<UA_SByte>(value, out);
+        return true;
+    case UA_TYPES_BYTE:
+        appendNumericValues<UA_Byte>(value, out);
+        return true;
+    case UA_TYPES_INT16:
+        appendNumericValues<UA_Int16>(value, out);
+        return true;
+    case UA_TYPES_UINT16:
+        appendNumericValues<UA_UInt16>(value, out);
+        return true;
+    case UA_TYPES_INT32:
+        appendNumericValues<UA_Int32>(value, out);
+        return true;
+    case UA_TYPES_UINT32:
+        appendNumericValues<UA_UInt32>(value, out);
+        return true;
+    case UA_TYPES_INT64:
+        appendNumericValues<UA_Int64>(value, out);
+        return true;
+    case UA_TYPES_UINT64:
+        appendNumericValues<UA_UInt64>(value, out);
+        return true;
+    case UA_TYPES_FLOAT:
+        appendNumericValues<UA_Float>(value, out);
+        return true;
+    case UA_TYPES_DOUBLE:
+        appendNumericValues<UA_Double>(value, out);
+        return true;
+    default:
+        return false;
+    }
+}
+
 static void monitoredValueHandler(UA_Client *client, UA_UInt32 subId, void *subContext, UA_UInt32 monId, void *monContext, UA_DataValue *value)
 {
     Q_UNUSED(client)
@@ -83,11 +148,7 @@ static void eventHandler(UA_Client *client, UA_UInt32 subId, void *subContext, U
     Q_UNUSED(subContext);
 
     QOpen62541Subscription *subscription = static_cast<QOpen62541Subscription *>(monContext);
-
-    QVariantList list;
-    for (size_t i = 0; i < numFields; ++i)
-        list.append(QOpen62541ValueConverter::toQVariant(eventFields[i]));
-    subscription->eventReceived(monId, list);
+    subscription->eventReceived(monId, numFields, eventFields);
 }
 
 QOpen62541Subscription::QOpen62541Subscription(Open62541AsyncBackend *backend, const QOpcUaMonitoringParameters &settings)
@@ -102,6 +163,10 @@ QOpen62541Subscription::QOpen62541Subscription(Open62541AsyncBackend *backend, c
     , m_clientHandle(0)
     , m_timeout(false)
 {
+    m_clock.start();
+    m_heldValueTimer.setSingleShot(true);
+    m_heldValueTimer.setTimerType(Qt::PreciseTimer);
+    connect(&m_heldValueTimer, &QTimer::timeout, this, &QOpen62541Subscription::deliverHeldValues);
 }
 
 QOpen62541Subscription::~QOpen62541Subscription()
@@ -139,9 +204,16 @@ bool QOpen62541Subscription::removeOnServer()
         m_subscriptionId = 0;
     }
 
+    const QOpcUa::UaStatusCode status = m_timeout ? QOpcUa::UaStatusCode::BadTimeout : QOpcUa::UaStatusCode::BadDisconnect;
     for (auto it : qAsConst(m_itemIdToItemMapping)) {
+        flushEvents(it);
+        // Tags don't have a node object which has to be notified
+        if (QOpcUaTagTablePrivate::isTagHandle(it->handle)) {
+            m_backend->setTagStatusCode(it->handle, status);
+            continue;
+        }
         QOpcUaMonitoringParameters s;
-        s.setStatusCode(m_timeout ? QOpcUa::UaStatusCode::BadTimeout : QOpcUa::UaStatusCode::BadDisconnect);
+        s.setStatusCode(status);
         emit m_backend->monitoringEnableDisable(it->handle, it->attr, false, s);
     }
 
@@ -153,6 +225,78 @@ bool QOpen62541Subscription::removeOnServer()
     return (res == UA_STATUSCODE_GOOD) ? true : false;
 }
 
+/*
+    Creates the subscription and its monitored items again after the session has been lost.
+    The local state of the items is kept, only subscription and monitored item ids change.
+    Items which could not be created again are removed and returned in lostItems.
+*/
+UA_UInt32 QOpen62541Subscription::recreateOnServer(QVector<QPair<quint64, QOpcUa::NodeAttribute>> *lostItems)
+{
+    // Events received before the session was lost still belong to the old items
+    deliverEvents();
+
+    // The old subscription died with the session, there is nothing to delete on the server
+    m_subscriptionId = 0;
+    m_timeout = false;
+    m_heldValueTimer.stop();
+    m_itemsWithHeldValue.clear();
+
+    const auto oldItems = m_itemIdToItemMapping.values();
+    m_itemIdToItemMapping.clear();
+    m_nodeHandleToItemMapping.clear();
+
+    if (!createOnServer()) {
+        // Keep the items, removeOnServer() notifies their owners
+        for (const auto item : oldItems) {
+            lostItems->append(qMakePair(item->handle, item->attr));
+            m_itemIdToItemMapping.insert(item->monitoredItemId, item);
+        }
+        return 0;
+    }
+
+    QVector<MonitoredItemRequest> requests;
+    requests.reserve(oldItems.size());
+    for (const auto item : oldItems) {
+        MonitoredItemRequest request;
+        request.handle = item->handle;
+        request.attr = item->attr;
+        request.nodeId = item->nodeId;
+        request.parameters = item->parameters;
+        request.lazyValue = item->lazyValue;
+        requests.append(request);
+    }
+
+    QVector<MonitoredItemRequest *> dataChangeItems;
+    QVector<MonitoredItemRequest *> eventItems;
+    for (auto &request : requests) {
+        if (request.attr == QOpcUa::NodeAttribute::EventNotifier &&
+                request.parameters.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>())
+            eventItems.append(&request);
+        else
+            dataChangeItems.append(&request);
+    }
+
+    createMonitoredItems(dataChangeItems, false);
+    createMonitoredItems(eventItems, true);
+
+    for (const auto &request : qAsConst(requests)) {
+        if (request.parameters.statusCode() == QOpcUa::UaStatusCode::Good)
+            continue;
+
+        lostItems->append(qMakePair(request.handle, request.attr));
+        if (QOpcUaTagTablePrivate::isTagHandle(request.handle)) {
+            m_backend->setTagStatusCode(request.handle, request.parameters.statusCode());
+            continue;
+        }
+        emit m_backend->monitoringEnableDisable(request.handle, request.attr, false, request.parameters);
+    }
+
+    // The node ids are referenced by the requests until here
+    qDeleteAll(oldItems);
+
+    return m_subscriptionId;
+}
+
 void QOpen62541Subscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value)
 {
     QOpcUaMonitoringParameters p;
@@ -250,30 +394,26 @@ void QOpen62541Subscription::modifyMonitoring(quint64 handle, QOpcUa::NodeAttrib
 
 bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings)
 {
+    const double euRangeWidth = needsEURange(attr, settings) ? readEURangeWidths({&id}).at(0) : qQNaN();
+    ClientSideFilter clientSideFilter;
+    const QOpcUa::UaStatusCode filterStatus = createClientSideFilter(attr, id, settings, euRangeWidth, &clientSideFilter);
+    if (filterStatus != QOpcUa::UaStatusCode::Good) {
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(filterStatus);
+        emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+        return false;
+    }
+
     UA_MonitoredItemCreateRequest req;
     UA_MonitoredItemCreateRequest_init(&req);
     UaDeleter<UA_MonitoredItemCreateRequest> requestDeleter(&req, UA_MonitoredItemCreateRequest_deleteMembers);
-    req.itemToMonitor.attributeId = QOpen62541ValueConverter::toUaAttributeId(attr);
-    UA_NodeId_copy(&id, &(req.itemToMonitor.nodeId));
-    if (settings.indexRange().size())
-        QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(settings.indexRange(), &req.itemToMonitor.indexRange);
-    req.monitoringMode = static_cast<UA_MonitoringMode>(settings.monitoringMode());
-    req.requestedParameters.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
-    req.requestedParameters.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
-    req.requestedParameters.discardOldest = settings.discardOldest();
-    req.requestedParameters.clientHandle = ++m_clientHandle;
 
-    if (settings.filter().isValid()) {
-        UA_ExtensionObject filter = createFilter(settings.filter());
-        if (filter.content.decoded.data)
-            req.requestedParameters.filter = filter;
-        else {
-            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored item, filter creation failed";
-            QOpcUaMonitoringParameters s;
-            s.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
-            emit m_backend->monitoringEnableDisable(handle, attr, true, s);
-            return false;
-        }
+    if (!fillMonitoredItemCreateRequest(attr, id, settings, &req)) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored item, filter creation failed";
+        QOpcUaMonitoringParameters s;
+        s.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
+        emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+        return false;
     }
 
     UA_MonitoredItemCreateResult res;
@@ -293,7 +433,161 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::N
         return false;
     }
 
+    emit m_backend->monitoringEnableDisable(handle, attr, true, addMonitoredItem(handle, attr, id, req.requestedParameters.clientHandle, settings, res,
+                                                                                 clientSideFilter, false));
+
+    return true;
+}
+
+void QOpen62541Subscription::addAttributeMonitoredItems(QVector<MonitoredItemRequest> &requests)
+{
+    // Event monitored items require a different notification callback and are created with a separate request
+    QVector<MonitoredItemRequest *> dataChangeItems;
+    QVector<MonitoredItemRequest *> eventItems;
+
+    for (auto &request : requests) {
+        if (request.attr == QOpcUa::NodeAttribute::EventNotifier &&
+                request.parameters.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>())
+            eventItems.append(&request);
+        else
+            dataChangeItems.append(&request);
+    }
+
+    createMonitoredItems(dataChangeItems, false);
+    createMonitoredItems(eventItems, true);
+}
+
+void QOpen62541Subscription::createMonitoredItems(const QVector<MonitoredItemRequest *> &requests, bool events)
+{
+    const int chunkSize = m_backend->maxMonitoredItemsPerCall();
+
+    // The EURanges of all percent deadbands are resolved together before the items are created
+    QVector<const UA_NodeId *> euRangeNodes;
+    QVector<int> euRangeItems;
+    for (int i = 0; i < requests.size(); ++i) {
+        if (needsEURange(requests.at(i)->attr, requests.at(i)->parameters)) {
+            euRangeNodes.append(&requests.at(i)->nodeId);
+            euRangeItems.append(i);
+        }
+    }
+    const QVector<double> resolvedWidths = readEURangeWidths(euRangeNodes);
+    QVector<double> euRangeWidths(requests.size(), qQNaN());
+    for (int i = 0; i < euRangeItems.size(); ++i)
+        euRangeWidths[euRangeItems.at(i)] = resolvedWidths.at(i);
+
+    for (int offset = 0; offset < requests.size(); offset += chunkSize) {
+        const int count = qMin(chunkSize, requests.size() - offset);
+
+        UA_CreateMonitoredItemsRequest req;
+        UA_CreateMonitoredItemsRequest_init(&req);
+        UaDeleter<UA_CreateMonitoredItemsRequest> requestDeleter(&req, UA_CreateMonitoredItemsRequest_deleteMembers);
+        req.subscriptionId = m_subscriptionId;
+        req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+        req.itemsToCreate = static_cast<UA_MonitoredItemCreateRequest *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_MONITOREDITEMCREATEREQUEST]));
+
+        // Items with a filter which can't be converted are not sent to the server
+        QVector<MonitoredItemRequest *> sentItems;
+        sentItems.reserve(count);
+        QVector<ClientSideFilter> clientSideFilters;
+        clientSideFilters.reserve(count);
+        for (int i = offset; i < offset + count; ++i) {
+            MonitoredItemRequest *request = requests.at(i);
+            ClientSideFilter clientSideFilter;
+            const QOpcUa::UaStatusCode filterStatus = createClientSideFilter(request->attr, request->nodeId, request->parameters,
+                                                                             euRangeWidths.at(i), &clientSideFilter);
+            if (filterStatus != QOpcUa::UaStatusCode::Good) {
+                request->parameters = QOpcUaMonitoringParameters();
+                request->parameters.setStatusCode(filterStatus);
+                continue;
+            }
+            if (!fillMonitoredItemCreateRequest(request->attr, request->nodeId, request->parameters,
+                                                &req.itemsToCreate[req.itemsToCreateSize])) {
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create monitored item, filter creation failed";
+                UA_MonitoredItemCreateRequest_deleteMembers(&req.itemsToCreate[req.itemsToCreateSize]);
+                UA_MonitoredItemCreateRequest_init(&req.itemsToCreate[req.itemsToCreateSize]);
+                request->parameters = QOpcUaMonitoringParameters();
+                request->parameters.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
+                continue;
+            }
+            ++req.itemsToCreateSize;
+            sentItems.append(request);
+            clientSideFilters.append(clientSideFilter);
+        }
+
+        if (sentItems.isEmpty())
+            continue;
+
+        std::vector<void *> contexts(sentItems.size(), this);
+        std::vector<UA_Client_DeleteMonitoredItemCallback> deleteCallbacks(sentItems.size(), nullptr);
+
+        UA_CreateMonitoredItemsResponse res;
+        if (events) {
+            std::vector<UA_Client_EventNotificationCallback> callbacks(sentItems.size(), eventHandler);
+            res = UA_Client_MonitoredItems_createEvents(m_backend->m_uaclient, req, contexts.data(),
+                                                        callbacks.data(), deleteCallbacks.data());
+        } else {
+            std::vector<UA_Client_DataChangeNotificationCallback> callbacks(sentItems.size(), monitoredValueHandler);
+            res = UA_Client_MonitoredItems_createDataChanges(m_backend->m_uaclient, req, contexts.data(),
+                                                             callbacks.data(), deleteCallbacks.data());
+        }
+        UaDeleter<UA_CreateMonitoredItemsResponse> responseDeleter(&res, UA_CreateMonitoredItemsResponse_deleteMembers);
+
+        for (int i = 0; i < sentItems.size(); ++i) {
+            MonitoredItemRequest *request = sentItems.at(i);
+            UA_StatusCode status = res.responseHeader.serviceResult;
+            if (status == UA_STATUSCODE_GOOD)
+                status = static_cast<size_t>(i) < res.resultsSize ? res.results[i].statusCode : UA_STATUSCODE_BADINTERNALERROR;
+
+            if (status != UA_STATUSCODE_GOOD) {
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not add monitored item for" << request->attr << "of node"
+                                                      << Open62541Utils::nodeIdToQString(request->nodeId) << ":" << UA_StatusCode_name(status);
+                request->parameters = QOpcUaMonitoringParameters();
+                request->parameters.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+                continue;
+            }
+
+            request->parameters = addMonitoredItem(request->handle, request->attr, request->nodeId,
+                                                   req.itemsToCreate[i].requestedParameters.clientHandle,
+                                                   request->parameters, res.results[i], clientSideFilters.at(i),
+                                                   request->lazyValue);
+        }
+    }
+}
+
+bool QOpen62541Subscription::fillMonitoredItemCreateRequest(QOpcUa::NodeAttribute attr, const UA_NodeId &id,
+                                                            const QOpcUaMonitoringParameters &settings, UA_MonitoredItemCreateRequest *out)
+{
+    out->itemToMonitor.attributeId = QOpen62541ValueConverter::toUaAttributeId(attr);
+    UA_NodeId_copy(&id, &(out->itemToMonitor.nodeId));
+    if (settings.indexRange().size())
+        QOpen62541ValueConverter::scalarFromQt<UA_String, QString>(settings.indexRange(), &out->itemToMonitor.indexRange);
+    out->monitoringMode = static_cast<UA_MonitoringMode>(settings.monitoringMode());
+    out->requestedParameters.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
+    out->requestedParameters.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
+    out->requestedParameters.discardOldest = settings.discardOldest();
+    out->requestedParameters.clientHandle = ++m_clientHandle;
+
+    if (settings.filter().isValid()) {
+        UA_ExtensionObject filter = createFilter(settings.filter());
+        if (!filter.content.decoded.data)
+            return false;
+        out->requestedParameters.filter = filter;
+    }
+
+    return true;
+}
+
+QOpcUaMonitoringParameters QOpen62541Subscription::addMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id,
+                                                                    UA_UInt32 clientHandle,
+                                                                    const QOpcUaMonitoringParameters &settings, UA_MonitoredItemCreateResult &res,
+                                                                    const ClientSideFilter &clientSideFilter, bool lazyValue)
+{
     MonitoredItem *temp = new MonitoredItem(handle, attr, res.monitoredItemId);
+    UA_NodeId_copy(&id, &temp->nodeId);
+    temp->clientSideFilter = clientSideFilter;
+    temp->lazyValue = lazyValue;
+    if (attr == QOpcUa::NodeAttribute::EventNotifier && settings.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>())
+        temp->eventFilter = QOpen62541CompiledEventFilter(settings.filter().value<QOpcUaMonitoringParameters::EventFilter>());
     m_nodeHandleToItemMapping[handle][attr] = temp;
     m_itemIdToItemMapping[res.monitoredItemId] = temp;
 
@@ -306,8 +600,9 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::N
     s.setSamplingInterval(res.revisedSamplingInterval);
     s.setQueueSize(res.revisedQueueSize);
     s.setMonitoredItemId(res.monitoredItemId);
+    qt_resetSuppressedNotifications(s);
     temp->parameters = s;
-    temp->clientHandle = m_clientHandle;
+    temp->clientHandle = clientHandle;
 
     if (res.filterResult.encoding >= UA_EXTENSIONOBJECT_DECODED &&
             res.filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
@@ -315,9 +610,121 @@ bool QOpen62541Subscription::addAttributeMonitoredItem(quint64 handle, QOpcUa::N
     else
         s.clearFilterResult();
 
-    emit m_backend->monitoringEnableDisable(handle, attr, true, s);
+    return s;
+}
+
+/*
+    euRangeWidth is the width of the EURange of the node, or NaN if it is unknown.
+    It is only used by a percent deadband.
+*/
+QOpcUa::UaStatusCode QOpen62541Subscription::createClientSideFilter(QOpcUa::NodeAttribute attr, const UA_NodeId &id,
+                                                                    const QOpcUaMonitoringParameters &settings, double euRangeWidth,
+                                                                    ClientSideFilter *out)
+{
+    if (settings.minimumDeliveryInterval() > 0)
+        out->minimumDeliveryInterval = qCeil(settings.minimumDeliveryInterval());
+
+    const QOpcUaMonitoringParameters::DataChangeFilter filter = settings.clientSideFilter();
+    if (filter.deadbandType() == QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::None)
+        return QOpcUa::UaStatusCode::Good;
 
-    return true;
+    if (attr != QOpcUa::NodeAttribute::Value)
+        return QOpcUa::UaStatusCode::BadFilterNotAllowed;
+
+    if (filter.deadbandValue() < 0)
+        return QOpcUa::UaStatusCode::BadDeadbandFilterInvalid;
+
+    if (filter.deadbandType() == QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Absolute) {
+        out->deadband = filter.deadbandValue();
+        return QOpcUa::UaStatusCode::Good;
+    }
+
+    if (filter.deadbandValue() > 100 || qIsNaN(euRangeWidth)) {
+        qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not create percent deadband for node" << Open62541Utils::nodeIdToQString(id);
+        return QOpcUa::UaStatusCode::BadDeadbandFilterInvalid;
+    }
+    out->deadband = filter.deadbandValue() / 100.0 * euRangeWidth;
+    return QOpcUa::UaStatusCode::Good;
+}
+
+/*
+    Resolves the EURange properties of all nodes with one TranslateBrowsePathsToNodeIds request
+    and reads them with one Read request. The width is NaN for nodes without a valid EURange.
+*/
+QVector<double> QOpen62541Subscription::readEURangeWidths(const QVector<const UA_NodeId *> &ids)
+{
+    QVector<double> widths(ids.size(), qQNaN());
+
+    // Node ids of the EURange properties and the index of their variable, both requests are split at the operation limits
+    QVector<UA_NodeId> rangeNodes;
+    QVector<int> rangeIndices;
+
+    const int translateChunkSize = m_backend->translateBrowsePathsChunkSize(ids.size());
+    for (int offset = 0; offset < ids.size(); offset += translateChunkSize) {
+        const int count = qMin(translateChunkSize, ids.size() - offset);
+
+        UA_TranslateBrowsePathsToNodeIdsRequest req;
+        UA_TranslateBrowsePathsToNodeIdsRequest_init(&req);
+        UaDeleter<UA_TranslateBrowsePathsToNodeIdsRequest> requestDeleter(&req, UA_TranslateBrowsePathsToNodeIdsRequest_deleteMembers);
+        req.browsePaths = static_cast<UA_BrowsePath *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_BROWSEPATH]));
+        req.browsePathsSize = count;
+        for (int i = 0; i < count; ++i) {
+            UA_BrowsePath &path = req.browsePaths[i];
+            UA_NodeId_copy(ids.at(offset + i), &path.startingNode);
+            path.relativePath.elements = UA_RelativePathElement_new();
+            path.relativePath.elementsSize = 1;
+            path.relativePath.elements->referenceTypeId = UA_NODEID_NUMERIC(0, UA_NS0ID_HASPROPERTY);
+            path.relativePath.elements->targetName = UA_QUALIFIEDNAME_ALLOC(0, "EURange");
+        }
+
+        UA_TranslateBrowsePathsToNodeIdsResponse res = UA_Client_Service_translateBrowsePathsToNodeIds(m_backend->m_uaclient, req);
+        UaDeleter<UA_TranslateBrowsePathsToNodeIdsResponse> responseDeleter(&res, UA_TranslateBrowsePathsToNodeIdsResponse_deleteMembers);
+
+        if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD || res.resultsSize != static_cast<size_t>(count))
+            continue;
+
+        // Only the nodes which have an EURange property are read
+        for (int i = 0; i < count; ++i) {
+            if (res.results[i].statusCode != UA_STATUSCODE_GOOD || !res.results[i].targetsSize)
+                continue;
+            UA_NodeId rangeNode;
+            UA_NodeId_copy(&res.results[i].targets->targetId.nodeId, &rangeNode);
+            rangeNodes.append(rangeNode);
+            rangeIndices.append(offset + i);
+        }
+    }
+
+    const int readChunkSize = m_backend->readChunkSize(rangeNodes.size());
+    for (int offset = 0; offset < rangeNodes.size(); offset += readChunkSize) {
+        const int count = qMin(readChunkSize, rangeNodes.size() - offset);
+
+        // The node ids are moved into the request
+        UA_ReadRequest req;
+        UA_ReadRequest_init(&req);
+        UaDeleter<UA_ReadRequest> requestDeleter(&req, UA_ReadRequest_deleteMembers);
+        req.nodesToRead = static_cast<UA_ReadValueId *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_READVALUEID]));
+        req.nodesToReadSize = count;
+        for (int i = 0; i < count; ++i) {
+            req.nodesToRead[i].nodeId = rangeNodes.at(offset + i);
+            req.nodesToRead[i].attributeId = UA_ATTRIBUTEID_VALUE;
+        }
+
+        UA_ReadResponse res = UA_Client_Service_read(m_backend->m_uaclient, req);
+        UaDeleter<UA_ReadResponse> responseDeleter(&res, UA_ReadResponse_deleteMembers);
+
+        if (res.responseHeader.serviceResult != UA_STATUSCODE_GOOD || res.resultsSize != static_cast<size_t>(count))
+            continue;
+
+        for (int i = 0; i < count; ++i) {
+            const UA_DataValue &value = res.results[i];
+            if (!value.hasValue || !UA_Variant_hasScalarType(&value.value, &UA_TYPES[UA_TYPES_RANGE]))
+                continue;
+            const UA_Range *range = static_cast<const UA_Range *>(value.value.data);
+            widths[rangeIndices.at(offset + i)] = range->high - range->low;
+        }
+    }
+
+    return widths;
 }
 
 bool QOpen62541Subscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr)
@@ -335,6 +742,9 @@ bool QOpen62541Subscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa
     if (res != UA_STATUSCODE_GOOD)
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not remove monitored item" << item->monitoredItemId << "from subscription" << m_subscriptionId << ":" << UA_StatusCode_name(res);
 
+    // Events received before the item was removed are delivered before monitoring is reported as disabled
+    flushEvents(item);
+
     m_itemIdToItemMapping.remove(item->monitoredItemId);
     auto it = m_nodeHandleToItemMapping.find(handle);
     it->remove(attr);
@@ -350,6 +760,164 @@ bool QOpen62541Subscription::removeAttributeMonitoredItem(quint64 handle, QOpcUa
     return true;
 }
 
+void QOpen62541Subscription::removeAttributeMonitoredItems(QVector<MonitoredItemRequest> &requests)
+{
+    QVector<MonitoredItemRequest *> knownItems;
+    for (auto &request : requests) {
+        if (getItemForAttribute(request.handle, request.attr)) {
+            knownItems.append(&request);
+        } else {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no monitored item for this attribute";
+            request.parameters = QOpcUaMonitoringParameters();
+            request.parameters.setStatusCode(QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+        }
+    }
+
+    const int chunkSize = m_backend->maxMonitoredItemsPerCall();
+
+    for (int offset = 0; offset < knownItems.size(); offset += chunkSize) {
+        const int count = qMin(chunkSize, knownItems.size() - offset);
+
+        UA_DeleteMonitoredItemsRequest req;
+        UA_DeleteMonitoredItemsRequest_init(&req);
+        UaDeleter<UA_DeleteMonitoredItemsRequest> requestDeleter(&req, UA_DeleteMonitoredItemsRequest_deleteMembers);
+        req.subscriptionId = m_subscriptionId;
+        req.monitoredItemIds = static_cast<UA_UInt32 *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_UINT32]));
+        req.monitoredItemIdsSize = count;
+
+        for (int i = 0; i < count; ++i)
+            req.monitoredItemIds[i] = getItemForAttribute(knownItems.at(offset + i)->handle, knownItems.at(offset + i)->attr)->monitoredItemId;
+
+        UA_DeleteMonitoredItemsResponse res = UA_Client_MonitoredItems_delete(m_backend->m_uaclient, req);
+        UaDeleter<UA_DeleteMonitoredItemsResponse> responseDeleter(&res, UA_DeleteMonitoredItemsResponse_deleteMembers);
+
+        for (int i = 0; i < count; ++i) {
+            MonitoredItemRequest *request = knownItems.at(offset + i);
+            UA_StatusCode status = res.responseHeader.serviceResult;
+            if (status == UA_STATUSCODE_GOOD)
+                status = static_cast<size_t>(i) < res.resultsSize ? res.results[i] : UA_STATUSCODE_BADINTERNALERROR;
+
+            if (status != UA_STATUSCODE_GOOD)
+                qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not remove monitored item" << req.monitoredItemIds[i] << "from subscription"
+                                                      << m_subscriptionId << ":" << UA_StatusCode_name(status);
+
+            // The local representation is removed regardless of the result, just like for a single monitored item
+            MonitoredItem *item = getItemForAttribute(request->handle, request->attr);
+            flushEvents(item);
+            m_itemIdToItemMapping.remove(item->monitoredItemId);
+            auto it = m_nodeHandleToItemMapping.find(request->handle);
+            it->remove(request->attr);
+            if (it->empty())
+                m_nodeHandleToItemMapping.erase(it);
+            delete item;
+
+            request->parameters = QOpcUaMonitoringParameters();
+            request->parameters.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+        }
+    }
+}
+
+void QOpen62541Subscription::modifyAttributeMonitoredItems(QVector<MonitoredItemRequest> &requests)
+{
+    QVector<MonitoredItemRequest *> knownItems;
+    for (auto &request : requests) {
+        if (getItemForAttribute(request.handle, request.attr)) {
+            knownItems.append(&request);
+        } else {
+            qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "There is no monitored item for this attribute";
+            request.parameters = QOpcUaMonitoringParameters();
+            request.parameters.setStatusCode(QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+        }
+    }
+
+    const int chunkSize = m_backend->maxMonitoredItemsPerCall();
+
+    for (int offset = 0; offset < knownItems.size(); offset += chunkSize) {
+        const int count = qMin(chunkSize, knownItems.size() - offset);
+
+        UA_ModifyMonitoredItemsRequest req;
+        UA_ModifyMonitoredItemsRequest_init(&req);
+        UaDeleter<UA_ModifyMonitoredItemsRequest> requestDeleter(&req, UA_ModifyMonitoredItemsRequest_deleteMembers);
+        req.subscriptionId = m_subscriptionId;
+        req.timestampsToReturn = UA_TIMESTAMPSTORETURN_BOTH;
+        req.itemsToModify = static_cast<UA_MonitoredItemModifyRequest *>(UA_Array_new(count, &UA_TYPES[UA_TYPES_MONITOREDITEMMODIFYREQUEST]));
+
+        QVector<MonitoredItemRequest *> sentItems;
+        sentItems.reserve(count);
+        for (int i = offset; i < offset + count; ++i) {
+            MonitoredItemRequest *request = knownItems.at(i);
+            MonitoredItem *item = getItemForAttribute(request->handle, request->attr);
+            const QOpcUaMonitoringParameters &settings = request->parameters;
+
+            UA_MonitoredItemModifyRequest &modifyRequest = req.itemsToModify[req.itemsToModifySize];
+            modifyRequest.monitoredItemId = item->monitoredItemId;
+            modifyRequest.requestedParameters.clientHandle = item->clientHandle;
+            modifyRequest.requestedParameters.samplingInterval = qFuzzyCompare(settings.samplingInterval(), 0.0) ? m_interval : settings.samplingInterval();
+            modifyRequest.requestedParameters.queueSize = settings.queueSize() == 0 ? 1 : settings.queueSize();
+            modifyRequest.requestedParameters.discardOldest = settings.discardOldest();
+
+            if (settings.filter().isValid()) {
+                UA_ExtensionObject filter = createFilter(settings.filter());
+                if (!filter.content.decoded.data) {
+                    qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Could not modify monitored item, filter creation failed";
+                    QOpcUaMonitoringParameters p = item->parameters;
+                    p.setStatusCode(QOpcUa::UaStatusCode::BadInternalError);
+                    request->parameters = p;
+                    continue;
+                }
+                modifyRequest.requestedParameters.filter = filter;
+            }
+
+            ++req.itemsToModifySize;
+            sentItems.append(request);
+        }
+
+        if (sentItems.isEmpty())
+            continue;
+
+        UA_ModifyMonitoredItemsResponse res = UA_Client_MonitoredItems_modify(m_backend->m_uaclient, req);
+        UaDeleter<UA_ModifyMonitoredItemsResponse> responseDeleter(&res, UA_ModifyMonitoredItemsResponse_deleteMembers);
+
+        for (int i = 0; i < sentItems.size(); ++i) {
+            MonitoredItemRequest *request = sentItems.at(i);
+            MonitoredItem *item = getItemForAttribute(request->handle, request->attr);
+            QOpcUaMonitoringParameters p = item->parameters;
+
+            UA_StatusCode status = res.responseHeader.serviceResult;
+            if (status == UA_STATUSCODE_GOOD)
+                status = static_cast<size_t>(i) < res.resultsSize ? res.results[i].statusCode : UA_STATUSCODE_BADINTERNALERROR;
+
+            if (status != UA_STATUSCODE_GOOD) {
+                p.setStatusCode(static_cast<QOpcUa::UaStatusCode>(status));
+                request->parameters = p;
+                continue;
+            }
+
+            p.setStatusCode(QOpcUa::UaStatusCode::Good);
+            p.setSamplingInterval(res.results[i].revisedSamplingInterval);
+            p.setQueueSize(res.results[i].revisedQueueSize);
+            p.setDiscardOldest(request->parameters.discardOldest());
+
+            if (request->parameters.filter().canConvert<QOpcUaMonitoringParameters::DataChangeFilter>())
+                p.setFilter(request->parameters.filter().value<QOpcUaMonitoringParameters::DataChangeFilter>());
+            else if (request->parameters.filter().canConvert<QOpcUaMonitoringParameters::EventFilter>()) {
+                p.setFilter(request->parameters.filter().value<QOpcUaMonitoringParameters::EventFilter>());
+                updateEventFilter(item, request->parameters.filter().value<QOpcUaMonitoringParameters::EventFilter>());
+            } else {
+                p.clearFilter();
+            }
+
+            if (res.results[i].filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
+                p.setFilterResult(convertEventFilterResult(&res.results[i].filterResult));
+            else
+                p.clearFilterResult();
+
+            item->parameters = p;
+            request->parameters = p;
+        }
+    }
+}
+
 void QOpen62541Subscription::monitoredValueUpdated(UA_UInt32 monId, UA_DataValue *value)
 {
     auto item = m_itemIdToItemMapping.constFind(monId);
@@ -359,18 +927,115 @@ void QOpen62541Subscription::monitoredValueUpdated(UA_UInt32 monId, UA_DataValue
 
     if (!value || value == UA_EMPTY_ARRAY_SENTINEL) {
         res.setStatusCode(QOpcUa::UaStatusCode::Good);
-        emit m_backend->dataChangeOccurred(item.value()->handle, res);
+        res.setAttribute(item.value()->attr);
+        m_backend->queueDataChange(item.value()->handle, res);
         return;
     }
 
-    res.setValue(QOpen62541ValueConverter::toQVariant(value->value));
+    // Values inside the deadband are dropped before they are converted
+    if (item.value()->clientSideFilter.deadband >= 0 && !passesDeadband(item.value(), value))
+        return;
+
+    // The notification is freed after this callback, the value is moved out of it. Values of nodes are
+    // converted on the backend thread, the signals of QOpcUaNode need them right away.
+    if (item.value()->lazyValue)
+        QOpen62541ValueConverter::setLazyValue(res, &value->value, m_backend->m_conversionFlags);
+    else
+        res.setValue(QOpen62541ValueConverter::takeQVariant(&value->value, m_backend->m_conversionFlags));
     res.setAttribute(item.value()->attr);
     if (value->hasServerTimestamp)
-        res.setServerTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&value->serverTimestamp));
+        res.setServerTimestampRaw(value->serverTimestamp);
     if (value->hasSourceTimestamp)
-        res.setSourceTimestamp(QOpen62541ValueConverter::scalarToQt<QDateTime, UA_DateTime>(&value->sourceTimestamp));
+        res.setSourceTimestampRaw(value->sourceTimestamp);
     res.setStatusCode(QOpcUa::UaStatusCode::Good);
-    emit m_backend->dataChangeOccurred(item.value()->handle, res);
+
+    if (item.value()->clientSideFilter.minimumDeliveryInterval > 0 && holdForDeliveryInterval(item.value(), res))
+        return;
+
+    m_backend->queueDataChange(item.value()->handle, res);
+}
+
+bool QOpen62541Subscription::passesDeadband(MonitoredItem *item, const UA_DataValue *value)
+{
+    const UA_StatusCode status = value->hasStatus ? value->status : UA_STATUSCODE_GOOD;
+
+    // Non-numeric values and status changes are always delivered
+    if (!numericValues(value->value, &m_deadbandBuffer) || !item->hasAcceptedValue || status != item->acceptedStatus ||
+            m_deadbandBuffer.size() != item->acceptedValue.size()) {
+        item->hasAcceptedValue = true;
+        item->acceptedStatus = status;
+        item->acceptedValue.swap(m_deadbandBuffer);
+        return true;
+    }
+
+    for (int i = 0; i < m_deadbandBuffer.size(); ++i) {
+        if (qAbs(m_deadbandBuffer.at(i) - item->acceptedValue.at(i)) > item->clientSideFilter.deadband) {
+            item->acceptedValue.swap(m_deadbandBuffer);
+            return true;
+        }
+    }
+
+    qt_addSuppressedNotifications(item->parameters, 1);
+    return false;
+}
+
+/*
+    Returns true if the result has been held back because the previous data change of the item
+    has been delivered less than the minimum delivery interval ago.
+    Only the most recent held value is delivered once the interval has elapsed.
+*/
+bool QOpen62541Subscription::holdForDeliveryInterval(MonitoredItem *item, const QOpcUaReadResult &result)
+{
+    const qint64 now = m_clock.elapsed();
+    const qint64 remaining = item->lastDeliveryTime + item->clientSideFilter.minimumDeliveryInterval - now;
+
+    if (item->hasHeldValue)
+        qt_addSuppressedNotifications(item->parameters, 1);
+
+    if (item->lastDeliveryTime && remaining > 0) {
+        item->hasHeldValue = true;
+        item->heldValue = result;
+        m_itemsWithHeldValue.insert(item->monitoredItemId);
+        if (!m_heldValueTimer.isActive() || remaining < m_heldValueTimer.remainingTime())
+            m_heldValueTimer.start(remaining);
+        return true;
+    }
+
+    // The new value replaces a held value whose interval has already elapsed
+    item->hasHeldValue = false;
+    item->heldValue = QOpcUaReadResult();
+    item->lastDeliveryTime = qMax<qint64>(now, 1);
+    return false;
+}
+
+void QOpen62541Subscription::deliverHeldValues()
+{
+    const qint64 now = m_clock.elapsed();
+    qint64 nextDelivery = -1;
+
+    for (auto it = m_itemsWithHeldValue.begin(); it != m_itemsWithHeldValue.end();) {
+        MonitoredItem *item = m_itemIdToItemMapping.value(*it, nullptr);
+        if (!item || !item->hasHeldValue) {
+            it = m_itemsWithHeldValue.erase(it);
+            continue;
+        }
+
+        const qint64 remaining = item->lastDeliveryTime + item->clientSideFilter.minimumDeliveryInterval - now;
+        if (remaining > 0) {
+            nextDelivery = nextDelivery < 0 ? remaining : qMin(nextDelivery, remaining);
+            ++it;
+            continue;
+        }
+
+        item->lastDeliveryTime = qMax<qint64>(now, 1);
+        item->hasHeldValue = false;
+        m_backend->queueDataChange(item->handle, item->heldValue);
+        item->heldValue = QOpcUaReadResult();
+        it = m_itemsWithHeldValue.erase(it);
+    }
+
+    if (nextDelivery >= 0)
+        m_heldValueTimer.start(nextDelivery);
 }
 
 void QOpen62541Subscription::sendTimeoutNotification()
@@ -385,12 +1050,54 @@ void QOpen62541Subscription::sendTimeoutNotification()
     m_timeout = true;
 }
 
-void QOpen62541Subscription::eventReceived(UA_UInt32 monId, QVariantList list)
+void QOpen62541Subscription::eventReceived(UA_UInt32 monId, size_t numFields, const UA_Variant *fields)
 {
     auto item = m_itemIdToItemMapping.constFind(monId);
     if (item == m_itemIdToItemMapping.constEnd())
         return;
-    emit m_backend->eventOccurred(item.value()->handle, list);
+
+    if (item.value()->handle == Open62541AsyncBackend::ModelChangeEventHandle) {
+        QVariantList list;
+        for (size_t i = 0; i < numFields; ++i)
+            list.append(QOpen62541ValueConverter::toQVariant(fields[i]));
+        m_backend->handleModelChangeEvent(list);
+        return;
+    }
+
+    // All events of a publish response are delivered together after the response has been processed
+    if (m_itemsWithEvents.isEmpty())
+        QMetaObject::invokeMethod(this, &QOpen62541Subscription::deliverEvents, Qt::QueuedConnection);
+
+    // The items are delivered in the order of their first event
+    if (!item.value()->eventFilter.hasEvents())
+        m_itemsWithEvents.append(monId);
+    item.value()->eventFilter.appendEvent(numFields, fields);
+}
+
+void QOpen62541Subscription::deliverEvents()
+{
+    const auto itemIds = m_itemsWithEvents;
+    m_itemsWithEvents.clear();
+
+    for (const auto monId : itemIds) {
+        MonitoredItem *item = m_itemIdToItemMapping.value(monId, nullptr);
+        if (item)
+            flushEvents(item);
+    }
+}
+
+void QOpen62541Subscription::flushEvents(MonitoredItem *item)
+{
+    if (item->eventFilter.hasEvents())
+        emit m_backend->eventsOccurred(item->handle, item->eventFilter.takeEvents());
+}
+
+void QOpen62541Subscription::updateEventFilter(MonitoredItem *item, const QOpcUaMonitoringParameters::EventFilter &filter)
+{
+    // Events for the old select clauses are delivered before the new filter is used
+    flushEvents(item);
+
+    item->eventFilter = QOpen62541CompiledEventFilter(filter);
 }
 
 double QOpen62541Subscription::interval() const
@@ -398,6 +1105,11 @@ double QOpen62541Subscription::interval() const
     return m_interval;
 }
 
+double QOpen62541Subscription::keepAliveInterval() const
+{
+    return m_interval * m_maxKeepaliveCount;
+}
+
 UA_UInt32 QOpen62541Subscription::subscriptionId() const
 {
     return m_subscriptionId;
@@ -840,8 +1552,10 @@ bool QOpen62541Subscription::modifyMonitoredItemParameters(quint64 nodeHandle, Q
                 changed |= QOpcUaMonitoringParameters::Parameter::Filter;
                 if (value.canConvert<QOpcUaMonitoringParameters::DataChangeFilter>())
                     p.setFilter(value.value<QOpcUaMonitoringParameters::DataChangeFilter>());
-                else if (value.canConvert<QOpcUaMonitoringParameters::EventFilter>())
+                else if (value.canConvert<QOpcUaMonitoringParameters::EventFilter>()) {
                     p.setFilter(value.value<QOpcUaMonitoringParameters::EventFilter>());
+                    updateEventFilter(monItem, value.value<QOpcUaMonitoringParameters::EventFilter>());
+                }
                 if (res.results[0].filterResult.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTFILTERRESULT])
                     p.setFilterResult(convertEventFilterResult(&res.results[0].filterResult));
             }
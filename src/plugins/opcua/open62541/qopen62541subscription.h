@@ -38,7 +38,13 @@
 #define QOPEN62541SUBSCRIPTION_H
 
 #include "qopen62541.h"
+#include "qopen62541eventfilter.h"
 #include <QtOpcUa/qopcuanode.h>
+#include <QtOpcUa/qopcuareadresult.h>
+
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qset.h>
+#include <QtCore/qtimer.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -54,23 +60,53 @@ public:
 
     UA_UInt32 createOnServer();
     bool removeOnServer();
+    UA_UInt32 recreateOnServer(QVector<QPair<quint64, QOpcUa::NodeAttribute>> *lostItems);
 
     void modifyMonitoring(quint64 handle, QOpcUa::NodeAttribute attr, QOpcUaMonitoringParameters::Parameter item, QVariant value);
 
     bool addAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, QOpcUaMonitoringParameters settings);
     bool removeAttributeMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr);
 
+    struct MonitoredItemRequest {
+        quint64 handle;
+        QOpcUa::NodeAttribute attr;
+        UA_NodeId nodeId;
+        QOpcUaMonitoringParameters parameters; // Contains the result after the operation has finished
+        bool lazyValue = false; // The data changes are delivered in batches and only converted on first use
+    };
+
+    void addAttributeMonitoredItems(QVector<MonitoredItemRequest> &requests);
+    void removeAttributeMonitoredItems(QVector<MonitoredItemRequest> &requests);
+    void modifyAttributeMonitoredItems(QVector<MonitoredItemRequest> &requests);
+
     void monitoredValueUpdated(UA_UInt32 monId, UA_DataValue *value);
-    void eventReceived(UA_UInt32 monId, QVariantList list);
+    void eventReceived(UA_UInt32 monId, size_t numFields, const UA_Variant *fields);
 
     void sendTimeoutNotification();
 
+    // Deadband and rate limit applied to the data changes of a monitored item before they are delivered
+    struct ClientSideFilter {
+        double deadband = -1; // Absolute deadband, negative if disabled
+        qint64 minimumDeliveryInterval = 0; // Milliseconds
+        bool isActive() const { return deadband >= 0 || minimumDeliveryInterval > 0; }
+    };
+
     struct MonitoredItem {
         quint64 handle;
         QOpcUa::NodeAttribute attr;
         UA_UInt32 monitoredItemId;
         UA_UInt32 clientHandle;
+        UA_NodeId nodeId = UA_NODEID_NULL; // Required to recreate the item for a new session
         QOpcUaMonitoringParameters parameters;
+        ClientSideFilter clientSideFilter;
+        bool hasAcceptedValue = false;
+        UA_StatusCode acceptedStatus = UA_STATUSCODE_GOOD;
+        QVector<double> acceptedValue; // Last value which passed the deadband
+        qint64 lastDeliveryTime = 0;
+        bool hasHeldValue = false;
+        QOpcUaReadResult heldValue; // Most recent value waiting for the minimum delivery interval
+        QOpen62541CompiledEventFilter eventFilter; // Collects the events of the current publish response
+        bool lazyValue = false;
         MonitoredItem(quint64 h, QOpcUa::NodeAttribute a, UA_UInt32 id)
             : handle(h)
             , attr(a)
@@ -80,9 +116,16 @@ public:
             : handle(0)
             , monitoredItemId(0)
         {}
+        ~MonitoredItem()
+        {
+            UA_NodeId_deleteMembers(&nodeId);
+        }
+    private:
+        Q_DISABLE_COPY(MonitoredItem)
     };
 
     double interval() const;
+    double keepAliveInterval() const;
     UA_UInt32 subscriptionId() const;
     int monitoredItemsCount() const;
 
@@ -93,6 +136,22 @@ signals:
 
 private:
     MonitoredItem *getItemForAttribute(quint64 nodeHandle, QOpcUa::NodeAttribute attr);
+    bool fillMonitoredItemCreateRequest(QOpcUa::NodeAttribute attr, const UA_NodeId &id,
+                                        const QOpcUaMonitoringParameters &settings, UA_MonitoredItemCreateRequest *out);
+    QOpcUaMonitoringParameters addMonitoredItem(quint64 handle, QOpcUa::NodeAttribute attr, const UA_NodeId &id, UA_UInt32 clientHandle,
+                                                const QOpcUaMonitoringParameters &settings, UA_MonitoredItemCreateResult &res,
+                                                const ClientSideFilter &clientSideFilter, bool lazyValue);
+    QOpcUa::UaStatusCode createClientSideFilter(QOpcUa::NodeAttribute attr, const UA_NodeId &id,
+                                                const QOpcUaMonitoringParameters &settings, double euRangeWidth,
+                                                ClientSideFilter *out);
+    QVector<double> readEURangeWidths(const QVector<const UA_NodeId *> &ids);
+    bool passesDeadband(MonitoredItem *item, const UA_DataValue *value);
+    bool holdForDeliveryInterval(MonitoredItem *item, const QOpcUaReadResult &result);
+    void deliverHeldValues();
+    void deliverEvents();
+    void flushEvents(MonitoredItem *item);
+    void updateEventFilter(MonitoredItem *item, const QOpcUaMonitoringParameters::EventFilter &filter);
+    void createMonitoredItems(const QVector<MonitoredItemRequest *> &requests, bool events);
     UA_ExtensionObject createFilter(const QVariant &filterData);
     void createDataChangeFilter(const QOpcUaMonitoringParameters::DataChangeFilter &filter, UA_ExtensionObject *out);
     void createEventFilter(const QOpcUaMonitoringParameters::EventFilter &filter, UA_ExtensionObject *out);
@@ -118,6 +177,12 @@ private:
 
     quint32 m_clientHandle;
     bool m_timeout;
+
+    QElapsedTimer m_clock;
+    QTimer m_heldValueTimer;
+    QSet<UA_UInt32> m_itemsWithHeldValue;
+    QVector<double> m_deadbandBuffer;
+    QVector<UA_UInt32> m_itemsWithEvents; // In the order of their first event
 };
 
 QT_END_NAMESPACE
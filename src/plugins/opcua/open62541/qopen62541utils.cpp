@@ -36,6 +36,7 @@
 
 #include "qopen62541utils.h"
 #include <qopcuatype.h>
+#include <private/qopcuatype_p.h>
 
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/qstringlist.h>
@@ -47,12 +48,56 @@ QT_BEGIN_NAMESPACE
 
 Q_DECLARE_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541)
 
+namespace {
+
+// Encodes text as UTF-8 directly into a newly allocated UA_String, unpaired surrogates become U+FFFD
+bool encodeUtf8(QStringView text, UA_String *target)
+{
+    // At most three bytes for each UTF-16 code unit, a surrogate pair takes four bytes for two units
+    if (UA_ByteString_allocBuffer(target, static_cast<size_t>(text.size()) * 3) != UA_STATUSCODE_GOOD)
+        return false;
+
+    UA_Byte *out = target->data;
+    for (qsizetype i = 0; i < text.size(); ++i) {
+        uint codePoint = text.at(i).unicode();
+
+        if (QChar::isSurrogate(codePoint)) {
+            if (QChar::isHighSurrogate(codePoint) && i + 1 < text.size() && text.at(i + 1).isLowSurrogate())
+                codePoint = QChar::surrogateToUcs4(text.at(i).unicode(), text.at(++i).unicode());
+            else
+                codePoint = QChar::ReplacementCharacter;
+        }
+
+        if (codePoint < 0x80) {
+            *out++ = static_cast<UA_Byte>(codePoint);
+        } else if (codePoint < 0x800) {
+            *out++ = static_cast<UA_Byte>(0xc0 | (codePoint >> 6));
+            *out++ = static_cast<UA_Byte>(0x80 | (codePoint & 0x3f));
+        } else if (codePoint < 0x10000) {
+            *out++ = static_cast<UA_Byte>(0xe0 | (codePoint >> 12));
+            *out++ = static_cast<UA_Byte>(0x80 | ((codePoint >> 6) & 0x3f));
+            *out++ = static_cast<UA_Byte>(0x80 | (codePoint & 0x3f));
+        } else {
+            *out++ = static_cast<UA_Byte>(0xf0 | (codePoint >> 18));
+            *out++ = static_cast<UA_Byte>(0x80 | ((codePoint >> 12) & 0x3f));
+            *out++ = static_cast<UA_Byte>(0x80 | ((codePoint >> 6) & 0x3f));
+            *out++ = static_cast<UA_Byte>(0x80 | (codePoint & 0x3f));
+        }
+    }
+
+    // The buffer may be larger than the string, it is released with UA_free() like any other string
+    target->length = static_cast<size_t>(out - target->data);
+    return true;
+}
+
+} // namespace
+
 UA_NodeId Open62541Utils::nodeIdFromQString(const QString &name)
 {
     quint16 namespaceIndex;
-    QString identifierString;
+    QStringView identifierString;
     char identifierType;
-    bool success = QOpcUa::nodeIdStringSplit(name, &namespaceIndex, &identifierString, &identifierType);
+    bool success = qt_splitNodeIdString(name, &namespaceIndex, &identifierString, &identifierType);
 
     if (!success) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Failed to split node id string:" << name;
@@ -70,14 +115,20 @@ UA_NodeId Open62541Utils::nodeIdFromQString(const QString &name)
         break;
     }
     case 's': {
-        if (identifierString.length() > 0)
-            return UA_NODEID_STRING_ALLOC(namespaceIndex, identifierString.toUtf8().constData());
-        else
+        if (identifierString.length() > 0) {
+            // The identifier is encoded straight into the node id without an intermediate QByteArray
+            UA_NodeId result = UA_NODEID_NULL;
+            result.namespaceIndex = namespaceIndex;
+            result.identifierType = UA_NODEIDTYPE_STRING;
+            if (encodeUtf8(identifierString, &result.identifier.string))
+                return result;
+        } else {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << name << "does not contain a valid string identifier";
+        }
         break;
     }
     case 'g': {
-        QUuid uuid(identifierString);
+        const QUuid uuid = QUuid::fromString(identifierString);
 
         if (uuid.isNull()) {
             qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << name << "does not contain a valid guid identifier";
@@ -138,4 +189,58 @@ QString Open62541Utils::nodeIdToQString(UA_NodeId id)
     return result;
 }
 
+Open62541NodeIdCache::Open62541NodeIdCache(int maxSize)
+    : m_cache(maxSize)
+{
+}
+
+int Open62541NodeIdCache::maxSize() const
+{
+    QMutexLocker locker(&m_mutex);
+    return m_cache.maxCost();
+}
+
+void Open62541NodeIdCache::setMaxSize(int maxSize)
+{
+    QMutexLocker locker(&m_mutex);
+    m_cache.setMaxCost(maxSize);
+}
+
+void Open62541NodeIdCache::clear()
+{
+    QMutexLocker locker(&m_mutex);
+    m_cache.clear();
+}
+
+UA_NodeId Open62541NodeIdCache::nodeIdFromQString(const QString &name)
+{
+    QMutexLocker locker(&m_mutex);
+
+    if (m_cache.maxCost() <= 0)
+        return Open62541Utils::nodeIdFromQString(name);
+
+    UA_NodeId result;
+    const CachedNodeId *cached = m_cache.object(name);
+    if (cached) {
+        UA_NodeId_copy(&cached->nodeId, &result);
+        return result;
+    }
+
+    // Invalid node ids are not cached, the warning is printed for each failed attempt
+    result = Open62541Utils::nodeIdFromQString(name);
+    if (UA_NodeId_isNull(&result))
+        return result;
+
+    CachedNodeId *entry = new CachedNodeId;
+    UA_NodeId_copy(&result, &entry->nodeId);
+    m_cache.insert(name, entry);
+
+    return result;
+}
+
+Open62541NodeIdCache::CachedNodeId::~CachedNodeId()
+{
+    UA_NodeId_deleteMembers(&nodeId);
+}
+
 QT_END_NAMESPACE
@@ -39,6 +39,8 @@
 
 #include "qopen62541.h"
 
+#include <QtCore/qcache.h>
+#include <QtCore/qmutex.h>
 #include <QString>
 
 #include <functional>
@@ -98,6 +100,77 @@ namespace Open62541Utils {
     QString nodeIdToQString(UA_NodeId id);
 }
 
+// Owns a copy of a node id, hashed and compared in its binary form without formatting it as string
+class Open62541NodeIdKey
+{
+public:
+    Open62541NodeIdKey()
+    {
+        UA_NodeId_init(&m_nodeId);
+    }
+    explicit Open62541NodeIdKey(const UA_NodeId &nodeId)
+    {
+        UA_NodeId_copy(&nodeId, &m_nodeId);
+    }
+    Open62541NodeIdKey(const Open62541NodeIdKey &other)
+    {
+        UA_NodeId_copy(&other.m_nodeId, &m_nodeId);
+    }
+    Open62541NodeIdKey &operator=(const Open62541NodeIdKey &other)
+    {
+        if (this != &other) {
+            UA_NodeId_deleteMembers(&m_nodeId);
+            UA_NodeId_copy(&other.m_nodeId, &m_nodeId);
+        }
+        return *this;
+    }
+    ~Open62541NodeIdKey()
+    {
+        UA_NodeId_deleteMembers(&m_nodeId);
+    }
+
+    const UA_NodeId &nodeId() const { return m_nodeId; }
+    bool operator==(const Open62541NodeIdKey &other) const { return UA_NodeId_equal(&m_nodeId, &other.m_nodeId); }
+
+private:
+    UA_NodeId m_nodeId;
+};
+
+#if QT_VERSION >= 0x060000
+inline size_t qHash(const Open62541NodeIdKey &key, size_t seed = 0)
+#else
+inline uint qHash(const Open62541NodeIdKey &key, uint seed = 0)
+#endif
+{
+    return UA_NodeId_hash(&key.nodeId()) ^ seed;
+}
+
+// Maps node id strings to parsed node ids, the least recently used entries are evicted first.
+// The cache is used from the client and the backend thread and is protected by a mutex.
+class Open62541NodeIdCache
+{
+public:
+    explicit Open62541NodeIdCache(int maxSize = 0);
+
+    int maxSize() const;
+    void setMaxSize(int maxSize); // 0 disables the cache
+    void clear();
+
+    // The returned node id must be freed by the caller
+    UA_NodeId nodeIdFromQString(const QString &name);
+
+private:
+    Q_DISABLE_COPY(Open62541NodeIdCache)
+
+    struct CachedNodeId {
+        ~CachedNodeId();
+        UA_NodeId nodeId;
+    };
+
+    mutable QMutex m_mutex;
+    QCache<QString, CachedNodeId> m_cache;
+};
+
 QT_END_NAMESPACE
 
 #endif // QOPEN62541UTILS_H
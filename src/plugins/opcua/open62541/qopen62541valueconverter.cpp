@@ -39,12 +39,19 @@
 #include "qopen62541valueconverter.h"
 
 #include "qopcuamultidimensionalarray.h"
+#include <private/qopcuaextensionobject_p.h>
+#include <private/qopcuareadresult_p.h>
 
 #include <QtCore/qdatetime.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qloggingcategory.h>
 #include <QtCore/quuid.h>
 
+#include <array>
 #include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
 
 QT_BEGIN_NAMESPACE
 
@@ -54,6 +61,98 @@ using namespace QOpcUa::NodeIds;
 
 namespace QOpen62541ValueConverter {
 
+template<typename UATYPE, typename CONVERTER>
+static QVariant arrayToQVariantImpl(const UA_Variant &var, CONVERTER convert);
+static QVariant extensionObjectToQVariant(UA_ExtensionObject *data, bool adoptBody);
+template<typename TARGETTYPE, typename UATYPE, int METATYPE>
+static QVariant variantToQVariant(const UA_Variant &var);
+
+/*
+    Extension objects of the same type are usually received many times.
+    Each thread keeps the string representations of the encoding ids it has seen
+    so repeated values share the same QString.
+*/
+namespace {
+struct InternedNodeId
+{
+    UA_NodeId id;
+    bool operator==(const InternedNodeId &other) const { return UA_NodeId_equal(&id, &other.id); }
+};
+
+#if QT_VERSION >= 0x060000
+inline size_t qHash(const InternedNodeId &key, size_t seed = 0)
+#else
+inline uint qHash(const InternedNodeId &key, uint seed = 0)
+#endif
+{
+    return UA_NodeId_hash(&key.id) ^ seed;
+}
+
+class InternedNodeIdStrings
+{
+public:
+    ~InternedNodeIdStrings()
+    {
+        for (auto it = m_strings.keyBegin(); it != m_strings.keyEnd(); ++it)
+            UA_NodeId_deleteMembers(const_cast<UA_NodeId *>(&it->id));
+    }
+
+    QString get(const UA_NodeId &id)
+    {
+        const auto it = m_strings.constFind(InternedNodeId{id});
+        if (it != m_strings.constEnd())
+            return it.value();
+
+        const QString result = Open62541Utils::nodeIdToQString(id);
+        // Don't let servers with an unbounded number of types grow the table forever
+        if (m_strings.size() < maxSize) {
+            InternedNodeId key;
+            UA_NodeId_copy(&id, &key.id);
+            m_strings.insert(key, result);
+        }
+        return result;
+    }
+
+private:
+    static constexpr int maxSize = 1024;
+    QHash<InternedNodeId, QString> m_strings;
+};
+}
+
+static QString internedNodeIdString(const UA_NodeId &id)
+{
+    static thread_local InternedNodeIdStrings strings;
+    return strings.get(id);
+}
+
+static QOpcUa::Types typedArrayValueType(const QVariant &value)
+{
+    const int type = value.userType();
+
+    if (type == qMetaTypeId<QVector<qint8>>())
+        return QOpcUa::SByte;
+    if (type == qMetaTypeId<QVector<quint8>>())
+        return QOpcUa::Byte;
+    if (type == qMetaTypeId<QVector<qint16>>())
+        return QOpcUa::Int16;
+    if (type == qMetaTypeId<QVector<quint16>>())
+        return QOpcUa::UInt16;
+    if (type == qMetaTypeId<QVector<qint32>>())
+        return QOpcUa::Int32;
+    if (type == qMetaTypeId<QVector<quint32>>())
+        return QOpcUa::UInt32;
+    if (type == qMetaTypeId<QVector<qint64>>())
+        return QOpcUa::Int64;
+    if (type == qMetaTypeId<QVector<quint64>>())
+        return QOpcUa::UInt64;
+    if (type == qMetaTypeId<QVector<float>>())
+        return QOpcUa::Float;
+    if (type == qMetaTypeId<QVector<double>>())
+        return QOpcUa::Double;
+
+    return QOpcUa::Undefined;
+}
+
 UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
 {
     UA_Variant open62541value;
@@ -61,7 +160,9 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
 
     if (value.canConvert<QOpcUaMultiDimensionalArray>()) {
         QOpcUaMultiDimensionalArray data = value.value<QOpcUaMultiDimensionalArray>();
-        UA_Variant result = toOpen62541Variant(data.valueArray(), type);
+        UA_Variant result = typedMultiDimensionalArrayFromQt(data, type);
+        if (!result.data)
+            result = toOpen62541Variant(data.valueArray(), type);
 
         if (!data.arrayDimensions().isEmpty()) {
             // Ensure that the array dimensions size is < UINT32_MAX
@@ -74,6 +175,37 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
         return result;
     }
 
+    // Typed numeric arrays are copied without converting each element
+    if (type == QOpcUa::Undefined || type == typedArrayValueType(value)) {
+        switch (typedArrayValueType(value)) {
+        case QOpcUa::SByte:
+            return typedArrayFromQVariant<UA_SByte, qint8>(value, &UA_TYPES[UA_TYPES_SBYTE]);
+        case QOpcUa::Byte:
+            return typedArrayFromQVariant<UA_Byte, quint8>(value, &UA_TYPES[UA_TYPES_BYTE]);
+        case QOpcUa::Int16:
+            return typedArrayFromQVariant<UA_Int16, qint16>(value, &UA_TYPES[UA_TYPES_INT16]);
+        case QOpcUa::UInt16:
+            return typedArrayFromQVariant<UA_UInt16, quint16>(value, &UA_TYPES[UA_TYPES_UINT16]);
+        case QOpcUa::Int32:
+            return typedArrayFromQVariant<UA_Int32, qint32>(value, &UA_TYPES[UA_TYPES_INT32]);
+        case QOpcUa::UInt32:
+            return typedArrayFromQVariant<UA_UInt32, quint32>(value, &UA_TYPES[UA_TYPES_UINT32]);
+        case QOpcUa::Int64:
+            return typedArrayFromQVariant<UA_Int64, qint64>(value, &UA_TYPES[UA_TYPES_INT64]);
+        case QOpcUa::UInt64:
+            return typedArrayFromQVariant<UA_UInt64, quint64>(value, &UA_TYPES[UA_TYPES_UINT64]);
+        case QOpcUa::Float:
+            return typedArrayFromQVariant<UA_Float, float>(value, &UA_TYPES[UA_TYPES_FLOAT]);
+        case QOpcUa::Double:
+            return typedArrayFromQVariant<UA_Double, double>(value, &UA_TYPES[UA_TYPES_DOUBLE]);
+        default:
+            break;
+        }
+    } else if (typedArrayValueType(value) != QOpcUa::Undefined) {
+        // The requested type differs from the element type, convert each element
+        return toOpen62541Variant(value.value<QVariantList>(), type);
+    }
+
     if (value.type() == QVariant::List && value.toList().size() == 0)
         return open62541value;
 
@@ -149,65 +281,138 @@ UA_Variant toOpen62541Variant(const QVariant &value, QOpcUa::Types type)
     return open62541value;
 }
 
-QVariant toQVariant(const UA_Variant &value)
+namespace {
+using VariantConverter = QVariant (*)(const UA_Variant &);
+
+struct VariantConverters {
+    VariantConverter convert; // Scalars and one-dimensional arrays as QVariantList
+    VariantConverter typedArray; // One-dimensional numeric arrays as QVector<T>
+    VariantConverter multiDimensionalArray; // Numeric arrays with array dimensions
+};
+
+template<typename QTTYPE, typename UATYPE, int METATYPE>
+constexpr VariantConverters numericConverters()
 {
-    if (value.type == nullptr) {
-        return QVariant();
-    }
+    return {&variantToQVariant<QTTYPE, UATYPE, METATYPE>, &typedArrayToQVariant<QTTYPE, UATYPE>,
+            &typedMultiDimensionalArrayToQVariant<QTTYPE, UATYPE>};
+}
 
-    switch (value.type->typeIndex) {
+template<typename TARGETTYPE, typename UATYPE, int METATYPE = QMetaType::UnknownType>
+constexpr VariantConverters converters()
+{
+    return {&variantToQVariant<TARGETTYPE, UATYPE, METATYPE>, nullptr, nullptr};
+}
+
+constexpr VariantConverters variantConvertersForType(size_t typeIndex)
+{
+    switch (typeIndex) {
     case UA_TYPES_BOOLEAN:
-        return arrayToQVariant<bool, UA_Boolean>(value, QMetaType::Bool);
+        return converters<bool, UA_Boolean, QMetaType::Bool>();
     case UA_TYPES_SBYTE:
-        return arrayToQVariant<signed char, UA_SByte>(value, QMetaType::SChar);
+        return numericConverters<qint8, UA_SByte, QMetaType::SChar>();
     case UA_TYPES_BYTE:
-        return arrayToQVariant<uchar, UA_Byte>(value, QMetaType::UChar);
+        return numericConverters<quint8, UA_Byte, QMetaType::UChar>();
     case UA_TYPES_INT16:
-        return arrayToQVariant<qint16, UA_Int16>(value, QMetaType::Short);
+        return numericConverters<qint16, UA_Int16, QMetaType::Short>();
     case UA_TYPES_UINT16:
-        return arrayToQVariant<quint16, UA_UInt16>(value, QMetaType::UShort);
+        return numericConverters<quint16, UA_UInt16, QMetaType::UShort>();
     case UA_TYPES_INT32:
-        return arrayToQVariant<qint32, UA_Int32>(value, QMetaType::Int);
+        return numericConverters<qint32, UA_Int32, QMetaType::Int>();
     case UA_TYPES_UINT32:
-        return arrayToQVariant<quint32, UA_UInt32>(value, QMetaType::UInt);
+        return numericConverters<quint32, UA_UInt32, QMetaType::UInt>();
     case UA_TYPES_INT64:
-        return arrayToQVariant<int64_t, UA_Int64>(value, QMetaType::LongLong);
+        return numericConverters<qint64, UA_Int64, QMetaType::LongLong>();
     case UA_TYPES_UINT64:
-        return arrayToQVariant<uint64_t, UA_UInt64>(value, QMetaType::ULongLong);
+        return numericConverters<quint64, UA_UInt64, QMetaType::ULongLong>();
     case UA_TYPES_FLOAT:
-        return arrayToQVariant<float, UA_Float>(value, QMetaType::Float);
+        return numericConverters<float, UA_Float, QMetaType::Float>();
     case UA_TYPES_DOUBLE:
-        return arrayToQVariant<double, UA_Double>(value, QMetaType::Double);
+        return numericConverters<double, UA_Double, QMetaType::Double>();
     case UA_TYPES_STRING:
-        return arrayToQVariant<QString, UA_String>(value, QMetaType::QString);
+        return converters<QString, UA_String, QMetaType::QString>();
     case UA_TYPES_BYTESTRING:
-        return arrayToQVariant<QByteArray, UA_ByteString>(value, QMetaType::QByteArray);
+        return converters<QByteArray, UA_ByteString, QMetaType::QByteArray>();
     case UA_TYPES_LOCALIZEDTEXT:
-        return arrayToQVariant<QOpcUaLocalizedText, UA_LocalizedText>(value);
+        return converters<QOpcUaLocalizedText, UA_LocalizedText>();
     case UA_TYPES_NODEID:
-        return arrayToQVariant<QString, UA_NodeId>(value, QMetaType::QString);
+        return converters<QString, UA_NodeId, QMetaType::QString>();
     case UA_TYPES_DATETIME:
-        return arrayToQVariant<QDateTime, UA_DateTime>(value, QMetaType::QDateTime);
+        return converters<QDateTime, UA_DateTime, QMetaType::QDateTime>();
     case UA_TYPES_GUID:
-        return arrayToQVariant<QUuid, UA_Guid>(value, QMetaType::QUuid);
+        return converters<QUuid, UA_Guid, QMetaType::QUuid>();
     case UA_TYPES_XMLELEMENT:
-        return arrayToQVariant<QString, UA_XmlElement>(value, QMetaType::QString);
+        return converters<QString, UA_XmlElement, QMetaType::QString>();
     case UA_TYPES_QUALIFIEDNAME:
-        return arrayToQVariant<QOpcUaQualifiedName, UA_QualifiedName>(value);
+        return converters<QOpcUaQualifiedName, UA_QualifiedName>();
     case UA_TYPES_STATUSCODE:
-        return arrayToQVariant<QOpcUa::UaStatusCode, UA_StatusCode>(value, QMetaType::UInt);
+        return converters<quint32, UA_StatusCode, QMetaType::UInt>();
     case UA_TYPES_EXTENSIONOBJECT:
-        return arrayToQVariant<QVariant, UA_ExtensionObject>(value);
+        return converters<QVariant, UA_ExtensionObject>();
     case UA_TYPES_EXPANDEDNODEID:
-        return arrayToQVariant<QOpcUaExpandedNodeId, UA_ExpandedNodeId>(value);
+        return converters<QOpcUaExpandedNodeId, UA_ExpandedNodeId>();
     case UA_TYPES_ARGUMENT:
-        return arrayToQVariant<QOpcUaArgument, UA_Argument>(value);
+        return converters<QOpcUaArgument, UA_Argument>();
     case UA_TYPES_RANGE:
-        return arrayToQVariant<QOpcUaRange, UA_Range>(value);
+        return converters<QOpcUaRange, UA_Range>();
     default:
+        return {nullptr, nullptr, nullptr};
+    }
+}
+
+template<size_t... TYPEINDEX>
+constexpr std::array<VariantConverters, sizeof...(TYPEINDEX)> makeVariantConverters(std::index_sequence<TYPEINDEX...>)
+{
+    return {{variantConvertersForType(TYPEINDEX)...}};
+}
+
+// Generated at compile time, one entry for each index in UA_TYPES
+constexpr std::array<VariantConverters, UA_TYPES_COUNT> variantConverters =
+        makeVariantConverters(std::make_index_sequence<UA_TYPES_COUNT>());
+}
+
+namespace {
+QVariant convertVariant(const UA_Variant &value, ConversionFlags flags, bool adoptBodies)
+{
+    if (value.type == nullptr) {
+        return QVariant();
+    }
+
+    // The type index of custom data types refers to their own type array, not to UA_TYPES
+    const size_t typeIndex = value.type->typeIndex;
+    if (typeIndex >= variantConverters.size() || value.type != &UA_TYPES[typeIndex] || !variantConverters[typeIndex].convert) {
         qCWarning(QT_OPCUA_PLUGINS_OPEN62541) << "Variant conversion from Open62541 for typeIndex" << value.type->typeIndex << " not implemented";
         return QVariant();
     }
+
+    const VariantConverters &converter = variantConverters[typeIndex];
+
+    // Numeric multi-dimensional arrays are copied into the typed storage of QOpcUaMultiDimensionalArray
+    if (value.arrayLength > 0 && value.arrayDimensionsSize > 0 && converter.multiDimensionalArray)
+        return converter.multiDimensionalArray(value);
+
+    // Multi-dimensional arrays keep using QOpcUaMultiDimensionalArray
+    if (flags.testFlag(TypedArrays) && value.arrayLength > 0 && value.arrayDimensionsSize == 0 && converter.typedArray)
+        return converter.typedArray(value);
+
+    if (adoptBodies && typeIndex == UA_TYPES_EXTENSIONOBJECT) {
+        // The bodies are moved out of the variant, which is owned by the caller of takeQVariant()
+        return arrayToQVariantImpl<UA_ExtensionObject>(value, [](UA_ExtensionObject *obj) {
+            return extensionObjectToQVariant(obj, true);
+        });
+    }
+
+    return converter.convert(value);
+}
+}
+
+QVariant toQVariant(const UA_Variant &value, ConversionFlags flags)
+{
+    return convertVariant(value, flags, false);
+}
+
+QVariant takeQVariant(UA_Variant *value, ConversionFlags flags)
+{
+    return convertVariant(*value, flags, flags.testFlag(ZeroCopyExtensionObjects));
 }
 
 const UA_DataType *toDataType(QOpcUa::Types valueType)
@@ -350,6 +555,12 @@ QOpcUaRange scalarToQt<QOpcUaRange, UA_Range>(const UA_Range *data)
 
 template <>
 QVariant scalarToQt<QVariant, UA_ExtensionObject>(const UA_ExtensionObject *data)
+{
+    // The extension object is only modified if the body is adopted
+    return extensionObjectToQVariant(const_cast<UA_ExtensionObject *>(data), false);
+}
+
+static QVariant extensionObjectToQVariant(UA_ExtensionObject *data, bool adoptBody)
 {
     // OPC-UA part 6, Table 13 states that an extension object can have no body, a ByteString encoded body
     // or an XML encoded body.
@@ -415,8 +626,18 @@ QVariant scalarToQt<QVariant, UA_ExtensionObject>(const UA_ExtensionObject *data
     // Return extension objects with binary or XML body as QOpcUaExtensionObject
     QOpcUaExtensionObject obj;
     obj.setEncoding(static_cast<QOpcUaExtensionObject::Encoding>(data->encoding));
-    obj.setEncodingTypeId(Open62541Utils::nodeIdToQString(data->content.encoded.typeId));
-    obj.setEncodedBody(QByteArray(buffer.constData(), buffer.size()));
+    obj.setEncodingTypeId(internedNodeIdString(data->content.encoded.typeId));
+
+    UA_ByteString &body = data->content.encoded.body;
+    if (adoptBody && body.length > 0 && body.length <= static_cast<size_t>(std::numeric_limits<int>::max())) {
+        qt_adoptEncodedBody(obj, reinterpret_cast<char *>(body.data), static_cast<int>(body.length),
+                            [](void *ptr) { UA_free(ptr); });
+        body.data = nullptr;
+        body.length = 0;
+    } else {
+        obj.setEncodedBody(QByteArray(buffer.constData(), buffer.size()));
+    }
+
     return obj;
 }
 
@@ -430,19 +651,16 @@ QOpcUaExpandedNodeId scalarToQt<QOpcUaExpandedNodeId, UA_ExpandedNodeId>(const U
     return temp;
 }
 
-template<typename TARGETTYPE, typename UATYPE>
-QVariant arrayToQVariant(const UA_Variant &var, QMetaType::Type type)
+template<typename UATYPE, typename CONVERTER>
+static QVariant arrayToQVariantImpl(const UA_Variant &var, CONVERTER convert)
 {
     UATYPE *temp = static_cast<UATYPE *>(var.data);
 
     if (var.arrayLength > 0) {
         QVariantList list;
-        for (size_t i = 0; i < var.arrayLength; ++i) {
-            QVariant tempVar = QVariant::fromValue(scalarToQt<TARGETTYPE, UATYPE>(&temp[i]));
-            if (type != QMetaType::UnknownType && type != static_cast<QMetaType::Type>(tempVar.type()))
-                tempVar.convert(type);
-            list.append(tempVar);
-        }
+        list.reserve(static_cast<int>(qMin(var.arrayLength, static_cast<size_t>((std::numeric_limits<int>::max)()))));
+        for (size_t i = 0; i < var.arrayLength; ++i)
+            list.append(convert(&temp[i]));
 
         if (var.arrayDimensionsSize > 0) {
             // Ensure that the array dimensions fit in a QVector
@@ -458,10 +676,7 @@ QVariant arrayToQVariant(const UA_Variant &var, QMetaType::Type type)
         else
             return list;
     } else if (UA_Variant_isScalar(&var)) {
-        QVariant tempVar = QVariant::fromValue(scalarToQt<TARGETTYPE, UATYPE>(temp));
-        if (type != QMetaType::UnknownType && type != static_cast<QMetaType::Type>(tempVar.type()))
-            tempVar.convert(type);
-        return tempVar;
+        return convert(temp);
     } else if (var.arrayLength == 0 && var.data == UA_EMPTY_ARRAY_SENTINEL) {
         return QVariantList(); // Return empty QVariantList for empty array
     }
@@ -469,6 +684,46 @@ QVariant arrayToQVariant(const UA_Variant &var, QMetaType::Type type)
     return QVariant(); // Return empty QVariant for empty scalar variant
 }
 
+template<typename TARGETTYPE, typename UATYPE>
+QVariant arrayToQVariant(const UA_Variant &var, QMetaType::Type type)
+{
+    return arrayToQVariantImpl<UATYPE>(var, [type](const UATYPE *data) {
+        QVariant result = QVariant::fromValue(scalarToQt<TARGETTYPE, UATYPE>(data));
+        if (type != QMetaType::UnknownType && type != static_cast<QMetaType::Type>(result.type()))
+            result.convert(type);
+        return result;
+    });
+}
+
+template<typename T, bool = QMetaTypeId2<T>::IsBuiltIn>
+struct BuiltInMetaType
+{
+    static constexpr int value = QMetaType::UnknownType;
+};
+
+template<typename T>
+struct BuiltInMetaType<T, true>
+{
+    static constexpr int value = QMetaTypeId2<T>::MetaType;
+};
+
+/*
+    Used by the dispatch table of toQVariant(). Whether the QVariant created from TARGETTYPE
+    must be converted to METATYPE is decided at compile time instead of for each element.
+*/
+template<typename TARGETTYPE, typename UATYPE, int METATYPE>
+static QVariant variantToQVariant(const UA_Variant &var)
+{
+    constexpr bool convertElements = METATYPE != QMetaType::UnknownType && BuiltInMetaType<TARGETTYPE>::value != METATYPE;
+
+    return arrayToQVariantImpl<UATYPE>(var, [](const UATYPE *data) {
+        QVariant result = QVariant::fromValue(scalarToQt<TARGETTYPE, UATYPE>(data));
+        if (convertElements)
+            result.convert(METATYPE);
+        return result;
+    });
+}
+
 template<typename TARGETTYPE, typename QTTYPE>
 void scalarFromQt(const QTTYPE &value, TARGETTYPE *ptr)
 {
@@ -664,6 +919,193 @@ UA_Variant arrayFromQVariant(const QVariant &var, const UA_DataType *type)
     return open62541value;
 }
 
+template<typename QTTYPE, typename UATYPE>
+QVariant typedArrayToQVariant(const UA_Variant &var)
+{
+    static_assert(std::is_arithmetic<QTTYPE>::value && sizeof(QTTYPE) == sizeof(UATYPE),
+                  "Typed arrays require a numeric type with the same memory layout");
+
+    // Ensure that the array fits in a QVector
+    if (var.arrayLength > static_cast<size_t>((std::numeric_limits<int>::max)()))
+        return QVariant();
+
+    QVector<QTTYPE> result(static_cast<int>(var.arrayLength));
+    std::memcpy(result.data(), var.data, var.arrayLength * sizeof(UATYPE));
+    return QVariant::fromValue(result);
+}
+
+template<typename UATYPE, typename QTTYPE>
+UA_Variant typedArrayFromQVariant(const QVariant &var, const UA_DataType *type)
+{
+    static_assert(std::is_arithmetic<QTTYPE>::value && sizeof(QTTYPE) == sizeof(UATYPE),
+                  "Typed arrays require a numeric type with the same memory layout");
+
+    UA_Variant open62541value;
+    UA_Variant_init(&open62541value);
+
+    const QVector<QTTYPE> data = var.value<QVector<QTTYPE>>();
+    UATYPE *arr = static_cast<UATYPE *>(UA_Array_new(data.size(), type));
+    if (!arr)
+        return open62541value;
+
+    if (!data.isEmpty())
+        std::memcpy(arr, data.constData(), data.size() * sizeof(QTTYPE));
+
+    UA_Variant_setArray(&open62541value, arr, data.size(), type);
+    return open62541value;
+}
+
+template<typename QTTYPE, typename UATYPE>
+QVariant typedMultiDimensionalArrayToQVariant(const UA_Variant &var)
+{
+    static_assert(std::is_arithmetic<QTTYPE>::value && sizeof(QTTYPE) == sizeof(UATYPE),
+                  "Typed arrays require a numeric type with the same memory layout");
+
+    // Ensure that the array and the array dimensions fit in a QVector
+    if (var.arrayLength > static_cast<size_t>((std::numeric_limits<int>::max)()) ||
+            var.arrayDimensionsSize > static_cast<size_t>((std::numeric_limits<int>::max)()))
+        return QOpcUaMultiDimensionalArray();
+
+    QVector<quint32> arrayDimensions(static_cast<int>(var.arrayDimensionsSize));
+    std::copy(var.arrayDimensions, var.arrayDimensions + var.arrayDimensionsSize, arrayDimensions.begin());
+
+    QOpcUaMultiDimensionalArray result;
+    result.setArrayDimensions(arrayDimensions);
+    result.setTypedValueArray(static_cast<const QTTYPE *>(var.data), static_cast<int>(var.arrayLength));
+    return result;
+}
+
+template<typename QTTYPE>
+static UA_Variant typedMultiDimensionalArrayCopy(const QOpcUaMultiDimensionalArray &array, QOpcUa::Types elementType,
+                                                 QOpcUa::Types requestedType)
+{
+    UA_Variant open62541value;
+    UA_Variant_init(&open62541value);
+
+    if (requestedType != QOpcUa::Undefined && requestedType != elementType)
+        return open62541value;
+
+    const QTTYPE *source = array.constTypedData<QTTYPE>();
+    if (!source || !array.isValid())
+        return open62541value;
+
+    size_t count = 1;
+    for (const quint32 dimension : array.arrayDimensions())
+        count *= dimension;
+
+    const UA_DataType *dt = toDataType(elementType);
+    void *arr = UA_Array_new(count, dt);
+    if (!arr)
+        return open62541value;
+
+    // The typed storage has the same memory layout as the open62541 array
+    std::memcpy(arr, source, count * sizeof(QTTYPE));
+    UA_Variant_setArray(&open62541value, arr, count, dt);
+    return open62541value;
+}
+
+/*
+    Copies the typed storage of a multi-dimensional array if the requested type matches the element type.
+    The returned variant is empty otherwise and the caller falls back to converting each element.
+*/
+UA_Variant typedMultiDimensionalArrayFromQt(const QOpcUaMultiDimensionalArray &array, QOpcUa::Types type)
+{
+    switch (array.valueType()) {
+    case QMetaType::SChar:
+        return typedMultiDimensionalArrayCopy<qint8>(array, QOpcUa::SByte, type);
+    case QMetaType::UChar:
+        return typedMultiDimensionalArrayCopy<quint8>(array, QOpcUa::Byte, type);
+    case QMetaType::Short:
+        return typedMultiDimensionalArrayCopy<qint16>(array, QOpcUa::Int16, type);
+    case QMetaType::UShort:
+        return typedMultiDimensionalArrayCopy<quint16>(array, QOpcUa::UInt16, type);
+    case QMetaType::Int:
+        return typedMultiDimensionalArrayCopy<qint32>(array, QOpcUa::Int32, type);
+    case QMetaType::UInt:
+        return typedMultiDimensionalArrayCopy<quint32>(array, QOpcUa::UInt32, type);
+    case QMetaType::LongLong:
+        return typedMultiDimensionalArrayCopy<qint64>(array, QOpcUa::Int64, type);
+    case QMetaType::ULongLong:
+        return typedMultiDimensionalArrayCopy<quint64>(array, QOpcUa::UInt64, type);
+    case QMetaType::Float:
+        return typedMultiDimensionalArrayCopy<float>(array, QOpcUa::Float, type);
+    case QMetaType::Double:
+        return typedMultiDimensionalArrayCopy<double>(array, QOpcUa::Double, type);
+    default:
+        break;
+    }
+
+    UA_Variant open62541value;
+    UA_Variant_init(&open62541value);
+    return open62541value;
+}
+
+template<typename QTTYPE, typename UATYPE>
+QVariant typedSeriesToQVariant(const UA_DataValue *values, size_t count)
+{
+    static_assert(std::is_arithmetic<QTTYPE>::value && sizeof(QTTYPE) == sizeof(UATYPE),
+                  "Typed series require a numeric type with the same memory layout");
+
+    // Samples without a value keep the zero from the initialization
+    QVector<QTTYPE> result(static_cast<int>(count));
+    QTTYPE *out = result.data();
+    for (size_t i = 0; i < count; ++i) {
+        if (values[i].hasValue && values[i].value.data)
+            out[i] = *static_cast<const UATYPE *>(values[i].value.data);
+    }
+    return QVariant::fromValue(result);
+}
+
+QVariant seriesToQVariant(const UA_DataValue *values, size_t count, ConversionFlags flags)
+{
+    if (count > static_cast<size_t>((std::numeric_limits<int>::max)()))
+        return QVariant();
+
+    // The series can be stored as typed vector if all values are scalars of the same type
+    const UA_DataType *type = nullptr;
+    bool uniform = true;
+    for (size_t i = 0; i < count && uniform; ++i) {
+        if (!values[i].hasValue || !values[i].value.type)
+            continue;
+        if (!UA_Variant_isScalar(&values[i].value) || (type && type != values[i].value.type))
+            uniform = false;
+        type = values[i].value.type;
+    }
+
+    if (uniform && type) {
+        switch (type->typeIndex) {
+        case UA_TYPES_SBYTE:
+            return typedSeriesToQVariant<qint8, UA_SByte>(values, count);
+        case UA_TYPES_BYTE:
+            return typedSeriesToQVariant<quint8, UA_Byte>(values, count);
+        case UA_TYPES_INT16:
+            return typedSeriesToQVariant<qint16, UA_Int16>(values, count);
+        case UA_TYPES_UINT16:
+            return typedSeriesToQVariant<quint16, UA_UInt16>(values, count);
+        case UA_TYPES_INT32:
+            return typedSeriesToQVariant<qint32, UA_Int32>(values, count);
+        case UA_TYPES_UINT32:
+            return typedSeriesToQVariant<quint32, UA_UInt32>(values, count);
+        case UA_TYPES_INT64:
+            return typedSeriesToQVariant<qint64, UA_Int64>(values, count);
+        case UA_TYPES_UINT64:
+            return typedSeriesToQVariant<quint64, UA_UInt64>(values, count);
+        case UA_TYPES_FLOAT:
+            return typedSeriesToQVariant<float, UA_Float>(values, count);
+        case UA_TYPES_DOUBLE:
+            return typedSeriesToQVariant<double, UA_Double>(values, count);
+        default:
+            break;
+        }
+    }
+
+    QVariantList result;
+    result.reserve(static_cast<int>(count));
+    for (size_t i = 0; i < count; ++i)
+        result.append(values[i].hasValue ? toQVariant(values[i].value, flags) : QVariant());
+    return result;
+}
+
 void createExtensionObject(QByteArray &data, const UA_NodeId &typeEncodingId, UA_ExtensionObject *ptr, QOpcUaExtensionObject::Encoding encoding)
 {
     UA_ExtensionObject obj;
@@ -681,6 +1123,43 @@ void createExtensionObject(QByteArray &data, const UA_NodeId &typeEncodingId, UA
     UA_ExtensionObject_copy(&obj, ptr);
 }
 
+namespace {
+// Owns a decoded UA_Variant until the value of the read result is requested
+class Open62541LazyValue : public QOpcUaLazyValue
+{
+public:
+    Open62541LazyValue(UA_Variant *value, ConversionFlags flags)
+        : m_value(*value)
+        , m_flags(flags)
+    {
+        UA_Variant_init(value);
+    }
+
+    ~Open62541LazyValue() override
+    {
+        UA_Variant_deleteMembers(&m_value);
+    }
+
+protected:
+    QVariant decode() override
+    {
+        const QVariant result = takeQVariant(&m_value, m_flags);
+        UA_Variant_deleteMembers(&m_value);
+        UA_Variant_init(&m_value);
+        return result;
+    }
+
+private:
+    UA_Variant m_value;
+    ConversionFlags m_flags;
+};
+}
+
+void setLazyValue(QOpcUaReadResult &result, UA_Variant *value, ConversionFlags flags)
+{
+    qt_setLazyValue(result, new Open62541LazyValue(value, flags));
+}
+
 }
 
 QT_END_NAMESPACE
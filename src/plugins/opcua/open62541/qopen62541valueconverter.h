@@ -41,12 +41,23 @@
 #include <QtOpcUa/qopcuanode.h>
 #include <QtOpcUa/qopcuatype.h>
 #include <QtOpcUa/qopcuabinarydataencoding.h>
+#include <QtOpcUa/qopcuamultidimensionalarray.h>
+#include <QtOpcUa/qopcuareadresult.h>
 
 #include <QtCore/qvariant.h>
 
 QT_BEGIN_NAMESPACE
 
 namespace QOpen62541ValueConverter {
+    enum ConversionFlag {
+        NoConversionFlags = 0x0,
+        // One-dimensional arrays of numeric types are returned as QVector<T> instead of QVariantList
+        TypedArrays = 0x1,
+        // takeQVariant() moves the bodies of extension objects out of the UA_Variant instead of copying them
+        ZeroCopyExtensionObjects = 0x2
+    };
+    Q_DECLARE_FLAGS(ConversionFlags, ConversionFlag)
+
     QOpcUa::Types qvariantTypeToQOpcUaType(QVariant::Type type);
 
     inline UA_AttributeId toUaAttributeId(QOpcUa::NodeAttribute attr)
@@ -60,7 +71,13 @@ namespace QOpen62541ValueConverter {
     }
 
     UA_Variant toOpen62541Variant(const QVariant&, QOpcUa::Types);
-    QVariant toQVariant(const UA_Variant&);
+    QVariant toQVariant(const UA_Variant&, ConversionFlags flags = NoConversionFlags);
+    // Like toQVariant(), but may move data out of value, which must be owned by the caller and only be deleted afterwards
+    QVariant takeQVariant(UA_Variant *value, ConversionFlags flags = NoConversionFlags);
+    // Converts the values of a series of samples, uniform numeric scalars are returned as QVector<T>
+    QVariant seriesToQVariant(const UA_DataValue *values, size_t count, ConversionFlags flags = NoConversionFlags);
+    // Moves the content of value into result, it is converted when the value of result is accessed
+    void setLazyValue(QOpcUaReadResult &result, UA_Variant *value, ConversionFlags flags = NoConversionFlags);
     const UA_DataType *toDataType(QOpcUa::Types valueType);
     QOpcUa::Types qvariantTypeToQOpcUaType(QMetaType::Type type);
 
@@ -76,10 +93,26 @@ namespace QOpen62541ValueConverter {
     template<typename TARGETTYPE, typename QTTYPE>
     UA_Variant arrayFromQVariant(const QVariant &var, const UA_DataType *type);
 
+    template<typename QTTYPE, typename UATYPE>
+    QVariant typedArrayToQVariant(const UA_Variant &var);
+
+    template<typename QTTYPE, typename UATYPE>
+    QVariant typedSeriesToQVariant(const UA_DataValue *values, size_t count);
+
+    template<typename QTTYPE, typename UATYPE>
+    QVariant typedMultiDimensionalArrayToQVariant(const UA_Variant &var);
+
+    UA_Variant typedMultiDimensionalArrayFromQt(const QOpcUaMultiDimensionalArray &array, QOpcUa::Types type);
+
+    template<typename UATYPE, typename QTTYPE>
+    UA_Variant typedArrayFromQVariant(const QVariant &var, const UA_DataType *type);
+
     void createExtensionObject(QByteArray &data, const UA_NodeId &typeEncodingId, UA_ExtensionObject *ptr,
                                QOpcUaExtensionObject::Encoding encoding = QOpcUaExtensionObject::Encoding::ByteString);
 }
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(QOpen62541ValueConverter::ConversionFlags)
+
 QT_END_NAMESPACE
 
 #endif // QOPEN62541VALUECONVERTER_H
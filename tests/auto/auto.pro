@@ -8,6 +8,12 @@ qtHaveModule(qmltest):qtConfig(open62541)|qtConfig(uacpp) {
     SUBDIRS += declarative clientSetupInCpp
 }
 
+qtConfig(open62541) {
+    SUBDIRS += open62541helpers open62541valueconverter
+    open62541helpers.subdir = ../common/open62541helpers
+    open62541valueconverter.depends = open62541helpers
+}
+
 qtConfig(gds) {
     qtConfig(ssl):!darwin:!winrt: SUBDIRS += x509
 }
@@ -0,0 +1,10 @@
+TARGET = tst_open62541valueconverter
+
+QT += testlib opcua-private
+QT -= gui
+CONFIG += testcase
+
+include($$PWD/../../common/open62541helpers/open62541helpers.pri)
+
+SOURCES += \
+    tst_open62541valueconverter.cpp
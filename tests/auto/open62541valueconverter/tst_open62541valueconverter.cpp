@@ -0,0 +1,407 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopen62541.h"
+#include "qopen62541valueconverter.h"
+
+#include <QtOpcUa/qopcuaargument.h>
+#include <QtOpcUa/qopcuaexpandednodeid.h>
+#include <QtOpcUa/qopcuaextensionobject.h>
+#include <QtOpcUa/qopcuahistorydata.h>
+#include <QtOpcUa/qopcuahistoryreadrequest.h>
+#include <QtOpcUa/qopcualocalizedtext.h>
+#include <QtOpcUa/qopcuamultidimensionalarray.h>
+#include <QtOpcUa/qopcuaqualifiedname.h>
+#include <QtOpcUa/qopcuarange.h>
+
+#include <QtTest/QtTest>
+
+class tst_Open62541ValueConverter : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void toQVariant_data() { builtinTypes(); }
+    void toQVariant();
+    void toQVariantTypedArrays_data() { builtinTypes(); }
+    void toQVariantTypedArrays();
+    void multiDimensionalArray();
+    void extensionObjectBodies();
+    void seriesToQVariant();
+    void historyData();
+    void historyReadRequest();
+
+private:
+    void builtinTypes();
+    static UA_Variant createVariant(int typeIndex, size_t arrayLength);
+    static bool equalValues(const QVariant &lhs, const QVariant &rhs);
+    template <typename T>
+    static UA_DataValue createDataValue(T value, int typeIndex);
+};
+
+// Builtin types supported by the converter, the values are initialized to zero by open62541
+void tst_Open62541ValueConverter::builtinTypes()
+{
+    QTest::addColumn<int>("typeIndex");
+    QTest::addColumn<int>("arrayLength");
+    QTest::addColumn<QVariant>("expected");
+    QTest::addColumn<QVariant>("expectedTypedArray"); // Invalid for types without typed arrays
+
+    const int arrayLength = 1000;
+    const auto addType = [arrayLength](const char *name, int typeIndex, const QVariant &scalar,
+                                       const QVariant &typedArray = QVariant()) {
+        QTest::addRow("%s scalar", name) << typeIndex << 0 << scalar << scalar;
+        const QVariantList array = QVector<QVariant>(arrayLength, scalar).toList();
+        QTest::addRow("%s array", name) << typeIndex << arrayLength << QVariant(array)
+                                        << (typedArray.isValid() ? typedArray : QVariant(array));
+    };
+
+    const QString nullNodeId = QStringLiteral("ns=0;i=0");
+    QOpcUaExpandedNodeId expandedNodeId;
+    expandedNodeId.setNodeId(nullNodeId);
+    QOpcUaArgument argument;
+    argument.setValueRank(0);
+    argument.setDataTypeId(nullNodeId);
+
+    addType("Boolean", UA_TYPES_BOOLEAN, QVariant(false));
+    addType("SByte", UA_TYPES_SBYTE, QVariant::fromValue(qint8(0)), QVariant::fromValue(QVector<qint8>(arrayLength)));
+    addType("Byte", UA_TYPES_BYTE, QVariant::fromValue(quint8(0)), QVariant::fromValue(QVector<quint8>(arrayLength)));
+    addType("Int16", UA_TYPES_INT16, QVariant::fromValue(qint16(0)), QVariant::fromValue(QVector<qint16>(arrayLength)));
+    addType("UInt16", UA_TYPES_UINT16, QVariant::fromValue(quint16(0)), QVariant::fromValue(QVector<quint16>(arrayLength)));
+    addType("Int32", UA_TYPES_INT32, QVariant::fromValue(qint32(0)), QVariant::fromValue(QVector<qint32>(arrayLength)));
+    addType("UInt32", UA_TYPES_UINT32, QVariant::fromValue(quint32(0)), QVariant::fromValue(QVector<quint32>(arrayLength)));
+    addType("Int64", UA_TYPES_INT64, QVariant::fromValue(qint64(0)), QVariant::fromValue(QVector<qint64>(arrayLength)));
+    addType("UInt64", UA_TYPES_UINT64, QVariant::fromValue(quint64(0)), QVariant::fromValue(QVector<quint64>(arrayLength)));
+    addType("Float", UA_TYPES_FLOAT, QVariant::fromValue(0.0f), QVariant::fromValue(QVector<float>(arrayLength)));
+    addType("Double", UA_TYPES_DOUBLE, QVariant::fromValue(0.0), QVariant::fromValue(QVector<double>(arrayLength)));
+    addType("String", UA_TYPES_STRING, QVariant(QString()));
+    addType("DateTime", UA_TYPES_DATETIME, QVariant(QDateTime(QDate(1601, 1, 1), QTime(0, 0), Qt::UTC)));
+    addType("Guid", UA_TYPES_GUID, QVariant(QUuid()));
+    addType("ByteString", UA_TYPES_BYTESTRING, QVariant(QByteArray()));
+    addType("XmlElement", UA_TYPES_XMLELEMENT, QVariant(QString()));
+    addType("NodeId", UA_TYPES_NODEID, QVariant(nullNodeId));
+    addType("ExpandedNodeId", UA_TYPES_EXPANDEDNODEID, QVariant::fromValue(expandedNodeId));
+    addType("StatusCode", UA_TYPES_STATUSCODE, QVariant::fromValue(quint32(0)));
+    addType("QualifiedName", UA_TYPES_QUALIFIEDNAME, QVariant::fromValue(QOpcUaQualifiedName(0, QString())));
+    addType("LocalizedText", UA_TYPES_LOCALIZEDTEXT, QVariant::fromValue(QOpcUaLocalizedText()));
+    addType("ExtensionObject", UA_TYPES_EXTENSIONOBJECT, QVariant::fromValue(QOpcUaExtensionObject()));
+    addType("Argument", UA_TYPES_ARGUMENT, QVariant::fromValue(argument));
+    addType("Range", UA_TYPES_RANGE, QVariant::fromValue(QOpcUaRange(0, 0)));
+}
+
+template <typename T>
+static bool equalAs(const QVariant &lhs, const QVariant &rhs)
+{
+    return lhs.value<T>() == rhs.value<T>();
+}
+
+// QVariant only compares builtin types by value, the types of the converter are compared here
+bool tst_Open62541ValueConverter::equalValues(const QVariant &lhs, const QVariant &rhs)
+{
+    if (lhs.userType() != rhs.userType())
+        return false;
+
+    const int type = lhs.userType();
+    if (type == QMetaType::QVariantList) {
+        const QVariantList lhsList = lhs.toList();
+        const QVariantList rhsList = rhs.toList();
+        if (lhsList.size() != rhsList.size())
+            return false;
+        for (int i = 0; i < lhsList.size(); ++i) {
+            if (!equalValues(lhsList.at(i), rhsList.at(i)))
+                return false;
+        }
+        return true;
+    }
+
+    if (type == qMetaTypeId<QOpcUaExpandedNodeId>())
+        return equalAs<QOpcUaExpandedNodeId>(lhs, rhs);
+    if (type == qMetaTypeId<QOpcUaQualifiedName>())
+        return equalAs<QOpcUaQualifiedName>(lhs, rhs);
+    if (type == qMetaTypeId<QOpcUaLocalizedText>())
+        return equalAs<QOpcUaLocalizedText>(lhs, rhs);
+    if (type == qMetaTypeId<QOpcUaExtensionObject>())
+        return equalAs<QOpcUaExtensionObject>(lhs, rhs);
+    if (type == qMetaTypeId<QOpcUaArgument>())
+        return equalAs<QOpcUaArgument>(lhs, rhs);
+    if (type == qMetaTypeId<QOpcUaRange>())
+        return equalAs<QOpcUaRange>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<qint8>>())
+        return equalAs<QVector<qint8>>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<quint8>>())
+        return equalAs<QVector<quint8>>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<qint16>>())
+        return equalAs<QVector<qint16>>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<quint16>>())
+        return equalAs<QVector<quint16>>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<qint32>>())
+        return equalAs<QVector<qint32>>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<quint32>>())
+        return equalAs<QVector<quint32>>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<qint64>>())
+        return equalAs<QVector<qint64>>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<quint64>>())
+        return equalAs<QVector<quint64>>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<float>>())
+        return equalAs<QVector<float>>(lhs, rhs);
+    if (type == qMetaTypeId<QVector<double>>())
+        return equalAs<QVector<double>>(lhs, rhs);
+
+    return lhs == rhs;
+}
+
+UA_Variant tst_Open62541ValueConverter::createVariant(int typeIndex, size_t arrayLength)
+{
+    const UA_DataType *type = &UA_TYPES[typeIndex];
+
+    UA_Variant variant;
+    UA_Variant_init(&variant);
+    if (arrayLength)
+        UA_Variant_setArray(&variant, UA_Array_new(arrayLength, type), arrayLength, type);
+    else
+        UA_Variant_setScalar(&variant, UA_new(type), type);
+    return variant;
+}
+
+template <typename T>
+UA_DataValue tst_Open62541ValueConverter::createDataValue(T value, int typeIndex)
+{
+    UA_DataValue dataValue;
+    UA_DataValue_init(&dataValue);
+    UA_Variant_setScalarCopy(&dataValue.value, &value, &UA_TYPES[typeIndex]);
+    dataValue.hasValue = true;
+    return dataValue;
+}
+
+void tst_Open62541ValueConverter::toQVariant()
+{
+    QFETCH(int, typeIndex);
+    QFETCH(int, arrayLength);
+    QFETCH(QVariant, expected);
+
+    UA_Variant variant = createVariant(typeIndex, arrayLength);
+    QVariant result;
+
+    QBENCHMARK {
+        result = QOpen62541ValueConverter::toQVariant(variant);
+    }
+
+    UA_Variant_deleteMembers(&variant);
+    QCOMPARE(result.userType(), expected.userType());
+    QVERIFY(equalValues(result, expected));
+}
+
+void tst_Open62541ValueConverter::toQVariantTypedArrays()
+{
+    QFETCH(int, typeIndex);
+    QFETCH(int, arrayLength);
+    QFETCH(QVariant, expectedTypedArray);
+
+    UA_Variant variant = createVariant(typeIndex, arrayLength);
+    QVariant result;
+
+    QBENCHMARK {
+        result = QOpen62541ValueConverter::toQVariant(variant, QOpen62541ValueConverter::TypedArrays);
+    }
+
+    UA_Variant_deleteMembers(&variant);
+    QCOMPARE(result.userType(), expectedTypedArray.userType());
+    QVERIFY(equalValues(result, expectedTypedArray));
+}
+
+void tst_Open62541ValueConverter::multiDimensionalArray()
+{
+    // A 640x480 image
+    UA_Variant variant = createVariant(UA_TYPES_UINT16, 640 * 480);
+    variant.arrayDimensions = static_cast<UA_UInt32 *>(UA_Array_new(2, &UA_TYPES[UA_TYPES_UINT32]));
+    variant.arrayDimensions[0] = 480;
+    variant.arrayDimensions[1] = 640;
+    variant.arrayDimensionsSize = 2;
+
+    QVariant result;
+
+    QBENCHMARK {
+        result = QOpen62541ValueConverter::toQVariant(variant);
+    }
+
+    UA_Variant_deleteMembers(&variant);
+    QVERIFY(result.value<QOpcUaMultiDimensionalArray>().isValid());
+}
+
+void tst_Open62541ValueConverter::extensionObjectBodies()
+{
+    const QByteArray body("encoded body");
+
+    UA_Variant variant = createVariant(UA_TYPES_EXTENSIONOBJECT, 0);
+    auto obj = static_cast<UA_ExtensionObject *>(variant.data);
+    obj->encoding = UA_EXTENSIONOBJECT_ENCODED_BYTESTRING;
+    obj->content.encoded.typeId = UA_NODEID_NUMERIC(1, 4711);
+    QCOMPARE(UA_ByteString_allocBuffer(&obj->content.encoded.body, body.size()), UA_STATUSCODE_GOOD);
+    memcpy(obj->content.encoded.body.data, body.constData(), body.size());
+
+    // The const overload must leave the variant untouched, even if zero copy is requested
+    QVariant result = QOpen62541ValueConverter::toQVariant(variant, QOpen62541ValueConverter::ZeroCopyExtensionObjects);
+    QCOMPARE(result.value<QOpcUaExtensionObject>().encodedBody(), body);
+    QCOMPARE(obj->content.encoded.body.length, static_cast<size_t>(body.size()));
+
+    // Without the flag, takeQVariant() copies as well
+    result = QOpen62541ValueConverter::takeQVariant(&variant);
+    QCOMPARE(result.value<QOpcUaExtensionObject>().encodedBody(), body);
+    QCOMPARE(obj->content.encoded.body.length, static_cast<size_t>(body.size()));
+
+    result = QOpen62541ValueConverter::takeQVariant(&variant, QOpen62541ValueConverter::ZeroCopyExtensionObjects);
+    QCOMPARE(result.value<QOpcUaExtensionObject>().encodedBody(), body);
+    QCOMPARE(obj->content.encoded.body.length, static_cast<size_t>(0));
+    QVERIFY(obj->content.encoded.body.data == nullptr);
+
+    UA_Variant_deleteMembers(&variant);
+
+    // The adopted body stays valid after the variant has been deleted
+    QCOMPARE(result.value<QOpcUaExtensionObject>().encodedBody(), body);
+}
+
+void tst_Open62541ValueConverter::seriesToQVariant()
+{
+    // Scalars of the same numeric type are stored in a typed vector, a sample without value is 0
+    UA_DataValue uniform[3];
+    uniform[0] = createDataValue<UA_Double>(1.5, UA_TYPES_DOUBLE);
+    UA_DataValue_init(&uniform[1]);
+    uniform[2] = createDataValue<UA_Double>(3.5, UA_TYPES_DOUBLE);
+
+    QVariant result = QOpen62541ValueConverter::seriesToQVariant(uniform, 3);
+    QCOMPARE(result.userType(), qMetaTypeId<QVector<double>>());
+    QCOMPARE(result.value<QVector<double>>(), QVector<double>({1.5, 0, 3.5}));
+
+    // Mixed types and arrays are stored in a QVariantList, a sample without value is an invalid QVariant
+    UA_DataValue mixed[3];
+    mixed[0] = createDataValue<UA_Int32>(42, UA_TYPES_INT32);
+    mixed[1] = createDataValue<UA_Double>(2.5, UA_TYPES_DOUBLE);
+    UA_DataValue_init(&mixed[2]);
+
+    result = QOpen62541ValueConverter::seriesToQVariant(mixed, 3);
+    QCOMPARE(result.userType(), int(QMetaType::QVariantList));
+    QVariantList list = result.toList();
+    QCOMPARE(list.size(), 3);
+    QCOMPARE(list.at(0), QVariant(qint32(42)));
+    QCOMPARE(list.at(1), QVariant(2.5));
+    QVERIFY(!list.at(2).isValid());
+
+    UA_DataValue array;
+    UA_DataValue_init(&array);
+    array.value = createVariant(UA_TYPES_UINT16, 2);
+    array.hasValue = true;
+
+    result = QOpen62541ValueConverter::seriesToQVariant(&array, 1);
+    QCOMPARE(result.userType(), int(QMetaType::QVariantList));
+    list = result.toList();
+    QCOMPARE(list.size(), 1);
+    QCOMPARE(list.at(0).toList(), QVariantList({QVariant::fromValue(quint16(0)), QVariant::fromValue(quint16(0))}));
+
+    // Without samples, there is no type
+    result = QOpen62541ValueConverter::seriesToQVariant(nullptr, 0);
+    QCOMPARE(result.userType(), int(QMetaType::QVariantList));
+    QVERIFY(result.toList().isEmpty());
+
+    for (auto &value : uniform)
+        UA_DataValue_deleteMembers(&value);
+    for (auto &value : mixed)
+        UA_DataValue_deleteMembers(&value);
+    UA_DataValue_deleteMembers(&array);
+}
+
+void tst_Open62541ValueConverter::historyData()
+{
+    QOpcUaHistoryData data;
+    QCOMPARE(data.statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(data.count(), 0);
+    QVERIFY(!data.values().isValid());
+
+    data.setNodeId(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+    data.setValues(QVariant::fromValue(QVector<double>({1.5, 0})));
+    data.setSourceTimestamps({Q_INT64_C(1600000000000), QOpcUaHistoryData::InvalidTimestamp});
+    data.setServerTimestamps({Q_INT64_C(1600000000001), Q_INT64_C(1600000001001)});
+    data.setStatusCodes({QOpcUa::UaStatusCode::Good, QOpcUa::UaStatusCode::BadNoData});
+
+    // The number of samples is the number of status codes
+    QCOMPARE(data.count(), 2);
+    QCOMPARE(data.values().value<QVector<double>>(), QVector<double>({1.5, 0}));
+    QCOMPARE(data.sourceTimestamps().at(1), QOpcUaHistoryData::InvalidTimestamp);
+
+    // Copies are independent
+    QOpcUaHistoryData copy = data;
+    copy.setStatusCode(QOpcUa::UaStatusCode::GoodMoreData);
+    copy.setStatusCodes({QOpcUa::UaStatusCode::Good});
+    QCOMPARE(copy.nodeId(), data.nodeId());
+    QCOMPARE(copy.count(), 1);
+    QCOMPARE(data.count(), 2);
+    QCOMPARE(data.statusCode(), QOpcUa::UaStatusCode::Good);
+}
+
+void tst_Open62541ValueConverter::historyReadRequest()
+{
+    QOpcUaHistoryReadRequest request;
+    QCOMPARE(request.type(), QOpcUaHistoryReadRequest::Type::RawModified);
+    QVERIFY(request.nodeIds().isEmpty());
+    QCOMPARE(request.numValuesPerNode(), quint32(0));
+    QVERIFY(!request.returnBounds());
+    QVERIFY(!request.readModified());
+    QVERIFY(request == QOpcUaHistoryReadRequest());
+
+    const QDateTime start = QDateTime::fromMSecsSinceEpoch(Q_INT64_C(1600000000000), Qt::UTC);
+    request.setType(QOpcUaHistoryReadRequest::Type::Processed);
+    request.setNodeIds({QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")});
+    request.setStartTimestamp(start);
+    request.setEndTimestamp(start.addSecs(60));
+    request.setAggregateType(QStringLiteral("ns=0;i=2342"));
+    request.setProcessingInterval(1000);
+
+    QOpcUaHistoryReadRequest copy = request;
+    QVERIFY(copy == request);
+    QCOMPARE(copy.endTimestamp(), start.addSecs(60));
+    QCOMPARE(copy.processingInterval(), 1000.0);
+
+    // Each parameter takes part in the comparison
+    copy.setRequestedTimestamps({start});
+    QVERIFY(!(copy == request));
+    QVERIFY(request.requestedTimestamps().isEmpty());
+    copy = request;
+    copy.setUseSimpleBounds(false);
+    QVERIFY(!(copy == request));
+}
+
+QTEST_APPLESS_MAIN(tst_Open62541ValueConverter)
+
+#include "tst_open62541valueconverter.moc"
@@ -42,10 +42,18 @@
 #include <QtOpcUa/QOpcUaProvider>
 #include <QtOpcUa/qopcuabinarydataencoding.h>
 #include <QtOpcUa/qopcuamultidimensionalarray.h>
+#include <QtOpcUa/qopcuapubsubreader.h>
+#include <private/qopcuabackend_p.h>
+#include <private/qopcuaclientimpl_p.h>
+#include <private/qopcuareadresult_p.h>
+#include <private/qopcuatagtable_p.h>
 
 #include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
 #include <QtCore/QProcess>
+#include <QtCore/QScopeGuard>
 #include <QtCore/QScopedPointer>
+#include <QtCore/QTemporaryDir>
 #include <QtCore/QThread>
 #include <QtCore/QTimer>
 
@@ -53,6 +61,7 @@
 #include <QtTest/QtTest>
 #include <QTcpSocket>
 #include <QTcpServer>
+#include <QUdpSocket>
 #include <QVariantMap>
 
 const int signalSpyTimeout = 10000;
@@ -119,6 +128,64 @@ public:
     QOpcUaClient *opcuaClient;
 };
 
+// Client without a server connection, the test emits the signals of the backend directly
+class StubClientImpl : public QOpcUaClientImpl
+{
+public:
+    StubClientImpl()
+    {
+        connectBackendWithClient(&m_backend);
+    }
+
+    void connectToEndpoint(const QOpcUaEndpointDescription &) override {}
+    void disconnectFromEndpoint() override {}
+    QOpcUaNode *node(const QString &) override { return nullptr; }
+    QString backend() const override { return QStringLiteral("stub"); }
+    bool requestEndpoints(const QUrl &) override { return false; }
+    bool findServers(const QUrl &, const QStringList &, const QStringList &) override { return false; }
+    bool readNodeAttributes(const QVector<QOpcUaReadItem> &) override { return false; }
+    bool writeNodeAttributes(const QVector<QOpcUaWriteItem> &) override { return false; }
+    bool addNode(const QOpcUaAddNodeItem &) override { return false; }
+    bool deleteNode(const QString &, bool) override { return false; }
+    bool addReference(const QOpcUaAddReferenceItem &) override { return false; }
+    bool deleteReference(const QOpcUaDeleteReferenceItem &) override { return false; }
+    QStringList supportedSecurityPolicies() const override { return QStringList(); }
+    QVector<QOpcUaUserTokenPolicy::TokenType> supportedUserTokenTypes() const override { return {}; }
+
+    bool createMonitoredItems(const QVector<quint64> &handles, const QVector<QOpcUaMonitoringItem> &) override
+    {
+        m_handles += handles;
+        return true;
+    }
+
+    QOpcUaBackend m_backend;
+    QVector<quint64> m_handles;
+};
+
+// Counts the conversions, the first one is delayed to let concurrent callers of value() collide
+class CountingLazyValue : public QOpcUaLazyValue
+{
+public:
+    explicit CountingLazyValue(const QVariant &value)
+        : m_value(value)
+    {}
+
+    static QAtomicInt decodeCount;
+
+protected:
+    QVariant decode() override
+    {
+        if (decodeCount.fetchAndAddOrdered(1) == 0)
+            QThread::msleep(50);
+        return m_value;
+    }
+
+private:
+    QVariant m_value;
+};
+
+QAtomicInt CountingLazyValue::decodeCount;
+
 const QString readWriteNode = QStringLiteral("ns=3;s=TestNode.ReadWrite");
 const QVector<QString> xmlElements = {
     QStringLiteral("<?xml version=\"1\" encoding=\"UTF-8\"?>"),
@@ -372,6 +439,12 @@ private slots:
     void writeNodeAttributes();
     defineDataMethod(readNodeAttributes_data)
     void readNodeAttributes();
+    defineDataMethod(chunkedNodeAttributes_data)
+    void chunkedNodeAttributes();
+    defineDataMethod(pipelinedRequests_data)
+    void pipelinedRequests();
+    defineDataMethod(coalescedRequests_data)
+    void coalescedRequests();
 
     defineDataMethod(getRootNode_data)
     void getRootNode();
@@ -399,6 +472,26 @@ private slots:
     void dataChangeSubscriptionInvalidNode();
     defineDataMethod(dataChangeSubscriptionSharing_data)
     void dataChangeSubscriptionSharing();
+    defineDataMethod(dataChangeSubscriptionWithoutBatching_data)
+    void dataChangeSubscriptionWithoutBatching();
+    defineDataMethod(clientSideDataChangeFilter_data)
+    void clientSideDataChangeFilter();
+    defineDataMethod(bulkMonitoring_data)
+    void bulkMonitoring();
+    defineDataMethod(tagTableMonitoring_data)
+    void tagTableMonitoring();
+    defineDataMethod(crawl_data)
+    void crawl();
+    defineDataMethod(addressSpaceCache_data)
+    void addressSpaceCache();
+    defineDataMethod(registerNodes_data)
+    void registerNodes();
+    defineDataMethod(readHistoryData_data)
+    void readHistoryData();
+    defineDataMethod(typedArrays_data)
+    void typedArrays();
+    defineDataMethod(zeroCopyExtensionObjects_data)
+    void zeroCopyExtensionObjects();
     defineDataMethod(methodCall_data)
     void methodCall();
     defineDataMethod(methodCallInvalid_data)
@@ -480,11 +573,24 @@ private slots:
     void extensionObjectWithGuid();
 
     void statusStrings();
+    void eventBatch();
+    void clientEventSignals();
+    void readResultTimestamps();
+    void lazyReadResultValue();
+    void lazyDataChangeValues();
+    void pubSubReader();
+    void testServerPublisher();
+    defineDataMethod(simulatedVariables_data)
+    void simulatedVariables();
 
     // This test case restarts the server. It must be run last to avoid
     // destroying state required by other test cases.
     defineDataMethod(connectionLost_data)
     void connectionLost();
+    defineDataMethod(connectionRecovery_data)
+    void connectionRecovery();
+    defineDataMethod(disconnectWhileReconnecting_data)
+    void disconnectWhileReconnecting();
 
 private:
     QString envOrDefault(const char *env, QString def)
@@ -826,6 +932,22 @@ void Tst_QOpcUaClient::compareNodeIds()
         QCOMPARE(identifierType, 'b');
         QCOMPARE(identifier, QStringLiteral("UXQgZnR3IQ=="));
     }
+    {
+        quint16 namespaceIndex = 0;
+        char identifierType = 0;
+        QString identifier;
+        QVERIFY(QOpcUa::nodeIdStringSplit(QStringLiteral("ns=65535;s=A"), &namespaceIndex, &identifier, &identifierType));
+        QCOMPARE(namespaceIndex, 65535);
+        QCOMPARE(identifierType, 's');
+        QCOMPARE(identifier, QStringLiteral("A"));
+    }
+
+    QVERIFY(!QOpcUa::nodeIdStringSplit(QStringLiteral("ns=65536;i=1"), nullptr, nullptr, nullptr));
+    QVERIFY(!QOpcUa::nodeIdStringSplit(QStringLiteral("ns=1x;i=1"), nullptr, nullptr, nullptr));
+    QVERIFY(!QOpcUa::nodeIdStringSplit(QStringLiteral("ns=1;i=1;i=2"), nullptr, nullptr, nullptr));
+    QVERIFY(!QOpcUa::nodeIdStringSplit(QStringLiteral("ns=1;x=1"), nullptr, nullptr, nullptr));
+    QVERIFY(!QOpcUa::nodeIdStringSplit(QStringLiteral("ns=1;i="), nullptr, nullptr, nullptr));
+    QVERIFY(!QOpcUa::nodeIdStringSplit(QString(), nullptr, nullptr, nullptr));
 }
 
 void Tst_QOpcUaClient::readNS0OmitNode()
@@ -1045,6 +1167,221 @@ void Tst_QOpcUaClient::readNodeAttributes()
     // Only check the source timestamp, the server timestamp is replaced with the current DateTime in the open62541
     // server's Read service.
     QCOMPARE(result[1].sourceTimestamp(), QDateTime::fromString(QStringLiteral("2018-08-03 01:00:00"), Qt::ISODate));
+
+    // The raw timestamps must match the QDateTime accessors
+    QCOMPARE(result[0].sourceTimestampRaw(), Q_INT64_C(0));
+    QCOMPARE(result[0].sourceTimestampMSecsSinceEpoch(), QOpcUaReadResult::InvalidTimestamp);
+    QCOMPARE(result[1].sourceTimestampMSecsSinceEpoch(), result[1].sourceTimestamp().toMSecsSinceEpoch());
+    QCOMPARE(result[1].serverTimestampMSecsSinceEpoch(), result[1].serverTimestamp().toMSecsSinceEpoch());
+
+    QOpcUaReadResult copy;
+    copy.setSourceTimestampRaw(result[1].sourceTimestampRaw());
+    QCOMPARE(copy.sourceTimestamp(), result[1].sourceTimestamp());
+    copy.setSourceTimestamp(result[1].sourceTimestamp());
+    QCOMPARE(copy.sourceTimestampRaw(), result[1].sourceTimestampRaw());
+}
+
+void Tst_QOpcUaClient::chunkedNodeAttributes()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Splitting requests at the operation limits is only supported by the open62541 backend");
+    if (m_testServerPath.isEmpty())
+        QSKIP("This test requires its own test server with lowered operation limits");
+
+    // A second server which rejects Read and Write requests for more than two nodes
+    const quint16 port = 43345;
+    QProcess serverProcess;
+    serverProcess.start(m_testServerPath, {QStringLiteral("--port"), QString::number(port),
+                                           QStringLiteral("--max-nodes-per-read"), QStringLiteral("2"),
+                                           QStringLiteral("--max-nodes-per-write"), QStringLiteral("2")});
+    QVERIFY2(serverProcess.waitForStarted(), qPrintable(serverProcess.errorString()));
+    // Stops the server on every return, the clients declared below are disconnected before
+    const auto stopServer = qScopeGuard([&serverProcess]() {
+        serverProcess.kill();
+        serverProcess.waitForFinished();
+    });
+
+    bool listening = false;
+    for (int i = 0; i < 20 && !listening; ++i) {
+        QTcpSocket socket;
+        socket.connectToHost(QHostAddress::LocalHost, port);
+        listening = socket.waitForConnected(250);
+        if (!listening)
+            QTest::qWait(250);
+    }
+    QVERIFY2(listening, "Server does not run");
+
+    QOpcUaEndpointDescription endpoint = m_endpoint;
+    QUrl endpointUrl(endpoint.endpointUrl());
+    endpointUrl.setPort(port);
+    endpoint.setEndpointUrl(endpointUrl.toString());
+
+    const QStringList nodeIds = {
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int16"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int64"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt16"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt32")
+    };
+    const QVector<QOpcUa::Types> types = {QOpcUa::Types::Int16, QOpcUa::Types::Int32, QOpcUa::Types::Int64,
+                                          QOpcUa::Types::UInt16, QOpcUa::Types::UInt32};
+
+    QVector<QOpcUaWriteItem> writeItems;
+    QVector<QOpcUaReadItem> readItems;
+    for (int i = 0; i < nodeIds.size(); ++i) {
+        writeItems.append(QOpcUaWriteItem(nodeIds.at(i), QOpcUa::NodeAttribute::Value, i + 10, types.at(i)));
+        readItems.append(QOpcUaReadItem(nodeIds.at(i)));
+    }
+
+    {
+        OpcuaConnector connector(opcuaClient, endpoint);
+
+        // The five items are sent in chunks of two, the results are merged in the order of the request
+        QSignalSpy writeSpy(opcuaClient, &QOpcUaClient::writeNodeAttributesFinished);
+        QVERIFY(opcuaClient->writeNodeAttributes(writeItems));
+        QTRY_COMPARE_WITH_TIMEOUT(writeSpy.size(), 1, signalSpyTimeout);
+        QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+        const auto writeResults = writeSpy.at(0).at(0).value<QVector<QOpcUaWriteResult>>();
+        QCOMPARE(writeResults.size(), nodeIds.size());
+        for (int i = 0; i < writeResults.size(); ++i) {
+            QCOMPARE(writeResults.at(i).nodeId(), nodeIds.at(i));
+            QCOMPARE(writeResults.at(i).statusCode(), QOpcUa::UaStatusCode::Good);
+        }
+
+        QSignalSpy readSpy(opcuaClient, &QOpcUaClient::readNodeAttributesFinished);
+        QVERIFY(opcuaClient->readNodeAttributes(readItems));
+        QTRY_COMPARE_WITH_TIMEOUT(readSpy.size(), 1, signalSpyTimeout);
+        QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+        const auto readResults = readSpy.at(0).at(0).value<QVector<QOpcUaReadResult>>();
+        QCOMPARE(readResults.size(), nodeIds.size());
+        for (int i = 0; i < readResults.size(); ++i) {
+            QCOMPARE(readResults.at(i).nodeId(), nodeIds.at(i));
+            QCOMPARE(readResults.at(i).statusCode(), QOpcUa::UaStatusCode::Good);
+            QCOMPARE(readResults.at(i).value().toInt(), i + 10);
+        }
+    }
+
+    // With a configured limit of three, the first chunk exceeds the limit of the server and fails the whole request
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("maxNodesPerRead"), 3);
+    backendOptions.insert(QLatin1String("maxNodesPerWrite"), 3);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), endpoint);
+
+    QSignalSpy writeSpy(client.data(), &QOpcUaClient::writeNodeAttributesFinished);
+    QVERIFY(client->writeNodeAttributes(writeItems));
+    QTRY_COMPARE_WITH_TIMEOUT(writeSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadTooManyOperations);
+    QVERIFY(writeSpy.at(0).at(0).value<QVector<QOpcUaWriteResult>>().isEmpty());
+
+    QSignalSpy readSpy(client.data(), &QOpcUaClient::readNodeAttributesFinished);
+    QVERIFY(client->readNodeAttributes(readItems));
+    QTRY_COMPARE_WITH_TIMEOUT(readSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadTooManyOperations);
+    QVERIFY(readSpy.at(0).at(0).value<QVector<QOpcUaReadResult>>().isEmpty());
+
+    // Neither request reaches the server in chunks it accepts, the finished signals are emitted only once
+    QTest::qWait(500);
+    QCOMPARE(writeSpy.size(), 1);
+    QCOMPARE(readSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::pipelinedRequests()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Limiting the requests in flight is only supported by the open62541 backend");
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("maxRequestsInFlight"), 2);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(client->node("ns=2;s=Demo.Static.Scalar.Double"));
+    QVERIFY(node != nullptr);
+
+    QSignalSpy readNodeAttributesSpy(client.data(), &QOpcUaClient::readNodeAttributesFinished);
+    QSignalSpy attributeReadSpy(node.data(), &QOpcUaNode::attributeRead);
+
+    // Issue more requests than the window allows, the remaining requests are queued by the backend
+    constexpr int requestCount = 20;
+    const QVector<QOpcUaReadItem> request({QOpcUaReadItem(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"))});
+    for (int i = 0; i < requestCount; ++i) {
+        QVERIFY(client->readNodeAttributes(request));
+        QVERIFY(node->readAttributes(QOpcUa::NodeAttribute::Value));
+    }
+
+    QTRY_COMPARE_WITH_TIMEOUT(readNodeAttributesSpy.size(), requestCount, signalSpyTimeout);
+    QTRY_COMPARE_WITH_TIMEOUT(attributeReadSpy.size(), requestCount, signalSpyTimeout);
+
+    for (const auto &results : qAsConst(readNodeAttributesSpy)) {
+        QCOMPARE(results.at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+        const auto readResults = results.at(0).value<QVector<QOpcUaReadResult>>();
+        QCOMPARE(readResults.size(), 1);
+        QCOMPARE(readResults.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(readResults.at(0).value(), 23.0);
+    }
+
+    QCOMPARE(node->attributeError(QOpcUa::NodeAttribute::Value), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value), 23.0);
+}
+
+void Tst_QOpcUaClient::coalescedRequests()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Request coalescing is only supported by the open62541 backend");
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("requestCoalescingInterval"), 20000);
+    backendOptions.insert(QLatin1String("requestCoalescingMaxItems"), 4);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    const QStringList nodeIds = {
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int16"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int32"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.Int64"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt16"),
+        QStringLiteral("ns=2;s=Demo.Static.Scalar.UInt32")
+    };
+    const QVector<QOpcUa::Types> types = {QOpcUa::Types::Int16, QOpcUa::Types::Int32, QOpcUa::Types::Int64,
+                                          QOpcUa::Types::UInt16, QOpcUa::Types::UInt32};
+
+    QVector<QSharedPointer<QOpcUaNode>> nodes;
+    QVector<QSharedPointer<QSignalSpy>> writeSpies;
+    QVector<QSharedPointer<QSignalSpy>> readSpies;
+    for (const auto &nodeId : nodeIds) {
+        QSharedPointer<QOpcUaNode> node(client->node(nodeId));
+        QVERIFY(node != nullptr);
+        writeSpies.push_back(QSharedPointer<QSignalSpy>::create(node.data(), &QOpcUaNode::attributeWritten));
+        readSpies.push_back(QSharedPointer<QSignalSpy>::create(node.data(), &QOpcUaNode::attributeRead));
+        nodes.push_back(node);
+    }
+
+    // The writes and reads for all nodes are combined into requests with at most four items
+    for (int i = 0; i < nodes.size(); ++i)
+        QVERIFY(nodes[i]->writeAttribute(QOpcUa::NodeAttribute::Value, i + 10, types.at(i)));
+    for (const auto &node : qAsConst(nodes))
+        QVERIFY(node->readAttributes(QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::DisplayName));
+
+    for (int i = 0; i < nodes.size(); ++i) {
+        QTRY_COMPARE_WITH_TIMEOUT(writeSpies[i]->size(), 1, signalSpyTimeout);
+        QCOMPARE(writeSpies[i]->at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+        QTRY_COMPARE_WITH_TIMEOUT(readSpies[i]->size(), 1, signalSpyTimeout);
+        QCOMPARE(readSpies[i]->at(0).at(0).value<QOpcUa::NodeAttributes>(),
+                 QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::DisplayName);
+        QCOMPARE(nodes[i]->attributeError(QOpcUa::NodeAttribute::Value), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(nodes[i]->attribute(QOpcUa::NodeAttribute::Value).toInt(), i + 10);
+        QCOMPARE(nodes[i]->attributeError(QOpcUa::NodeAttribute::DisplayName), QOpcUa::UaStatusCode::Good);
+    }
 }
 
 void Tst_QOpcUaClient::getRootNode()
@@ -1619,6 +1956,644 @@ void Tst_QOpcUaClient::dataChangeSubscriptionSharing()
     QCOMPARE(attrs.size(), 0);
 }
 
+void Tst_QOpcUaClient::dataChangeSubscriptionWithoutBatching()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Data change batching is only supported by the open62541 backend");
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("disableDataChangeBatching"), true);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(23)), QOpcUa::Types::Double);
+    QTRY_VERIFY_WITH_TIMEOUT(dataChangeSpy.size() >= 1 && dataChangeSpy.last().at(1) == double(23), signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.last().at(0).value<QOpcUa::NodeAttribute>(), QOpcUa::NodeAttribute::Value);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 23.0);
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::clientSideDataChangeFilter()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Client-side data change filters are only supported by the open62541 backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+
+    // The node has no EURange property, a percent deadband can't be used
+    QOpcUaMonitoringParameters p(100);
+    p.setClientSideFilter(QOpcUaMonitoringParameters::DataChangeFilter(QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger::StatusOrValue,
+                                                                       QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Percent, 10));
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, p);
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::BadDeadbandFilterInvalid);
+
+    monitoringEnabledSpy.clear();
+    p.setClientSideFilter(QOpcUaMonitoringParameters::DataChangeFilter(QOpcUaMonitoringParameters::DataChangeFilter::DataChangeTrigger::StatusOrValue,
+                                                                       QOpcUaMonitoringParameters::DataChangeFilter::DeadbandType::Absolute, 1));
+    p.setMinimumDeliveryInterval(300);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, p);
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).minimumDeliveryInterval(), 300.0);
+    QTRY_COMPARE_WITH_TIMEOUT(dataChangeSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.at(0).at(1).toDouble(), 0.0);
+
+    // A change within the deadband is suppressed
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0.5)), QOpcUa::Types::Double);
+    QTRY_COMPARE_WITH_TIMEOUT(node->monitoringStatus(QOpcUa::NodeAttribute::Value).suppressedNotifications(), quint64(1),
+                              signalSpyTimeout);
+    QCOMPARE(dataChangeSpy.size(), 1);
+
+    // Changes arriving within the minimum delivery interval are held back, only the last one is delivered
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(5)), QOpcUa::Types::Double);
+    QTRY_COMPARE_WITH_TIMEOUT(dataChangeSpy.size(), 2, signalSpyTimeout);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(10)), QOpcUa::Types::Double);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(15)), QOpcUa::Types::Double);
+    QTRY_VERIFY_WITH_TIMEOUT(dataChangeSpy.size() >= 3 && dataChangeSpy.last().at(1).toDouble() == 15.0, signalSpyTimeout);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 15.0);
+    QCOMPARE(dataChangeSpy.at(1).at(1).toDouble(), 5.0);
+
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+    node->disableMonitoring(QOpcUa::NodeAttribute::Value);
+    monitoringDisabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringDisabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::bulkMonitoring()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Bulk monitoring is only supported by the open62541 backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QString doubleNode = QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QVector<QOpcUaMonitoringItem> request;
+    request.push_back(QOpcUaMonitoringItem(readWriteNode, QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100)));
+    request.push_back(QOpcUaMonitoringItem(doubleNode, QOpcUa::NodeAttribute::Value | QOpcUa::NodeAttribute::DisplayName,
+                                           QOpcUaMonitoringParameters(100)));
+    request.push_back(QOpcUaMonitoringItem(QStringLiteral("ns=3;s=InvalidNode"), QOpcUa::NodeAttribute::Value,
+                                           QOpcUaMonitoringParameters(100)));
+
+    QSignalSpy dataChangeSpy(opcuaClient, &QOpcUaClient::dataChangesOccurred);
+    QSignalSpy enableSpy(opcuaClient, &QOpcUaClient::enableMonitoringFinished);
+
+    QVERIFY(opcuaClient->enableMonitoring(request));
+    enableSpy.wait(signalSpyTimeout);
+    QCOMPARE(enableSpy.size(), 1);
+
+    QVector<QOpcUaMonitoringItem> results = enableSpy.at(0).at(0).value<QVector<QOpcUaMonitoringItem>>();
+    QCOMPARE(results.size(), 4);
+    QCOMPARE(results.at(0).nodeId(), readWriteNode);
+    QCOMPARE(results.at(0).attributes(), QOpcUa::NodeAttributes(QOpcUa::NodeAttribute::Value));
+    QCOMPARE(results.at(0).parameters().statusCode(), QOpcUa::UaStatusCode::Good);
+    QVERIFY(results.at(0).parameters().subscriptionId() != 0);
+    QVERIFY(results.at(0).parameters().monitoredItemId() != 0);
+    QCOMPARE(results.at(1).nodeId(), doubleNode);
+    QCOMPARE(results.at(1).attributes(), QOpcUa::NodeAttributes(QOpcUa::NodeAttribute::DisplayName));
+    QCOMPARE(results.at(1).parameters().statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(2).nodeId(), doubleNode);
+    QCOMPARE(results.at(2).attributes(), QOpcUa::NodeAttributes(QOpcUa::NodeAttribute::Value));
+    QCOMPARE(results.at(2).parameters().statusCode(), QOpcUa::UaStatusCode::Good);
+    // All items with the same shared parameters are created in the same subscription
+    QCOMPARE(results.at(2).parameters().subscriptionId(), results.at(0).parameters().subscriptionId());
+    QCOMPARE(results.at(3).parameters().statusCode(), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+
+    // Monitoring the same attribute twice is rejected
+    enableSpy.clear();
+    QVERIFY(opcuaClient->enableMonitoring({request.at(0)}));
+    enableSpy.wait(signalSpyTimeout);
+    QCOMPARE(enableSpy.size(), 1);
+    results = enableSpy.at(0).at(0).value<QVector<QOpcUaMonitoringItem>>();
+    QCOMPARE(results.size(), 1);
+    QCOMPARE(results.at(0).parameters().statusCode(), QOpcUa::UaStatusCode::BadEntryExists);
+
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(23)), QOpcUa::Types::Double);
+
+    QTRY_VERIFY_WITH_TIMEOUT([&]() {
+        for (const auto &entry : qAsConst(dataChangeSpy)) {
+            for (const auto &value : entry.at(0).value<QVector<QOpcUaReadResult>>()) {
+                if (value.nodeId() == readWriteNode && value.attribute() == QOpcUa::NodeAttribute::Value &&
+                        value.value() == double(23))
+                    return true;
+            }
+        }
+        return false;
+    }(), signalSpyTimeout);
+
+    QSignalSpy modifySpy(opcuaClient, &QOpcUaClient::modifyMonitoringFinished);
+    QOpcUaMonitoringParameters modifiedParameters;
+    modifiedParameters.setSamplingInterval(200);
+    modifiedParameters.setQueueSize(5);
+    QVERIFY(opcuaClient->modifyMonitoring({QOpcUaMonitoringItem(readWriteNode, QOpcUa::NodeAttribute::Value, modifiedParameters)}));
+    modifySpy.wait(signalSpyTimeout);
+    QCOMPARE(modifySpy.size(), 1);
+    results = modifySpy.at(0).at(0).value<QVector<QOpcUaMonitoringItem>>();
+    QCOMPARE(results.size(), 1);
+    QCOMPARE(results.at(0).parameters().statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(0).parameters().samplingInterval(), 200.0);
+    QCOMPARE(results.at(0).parameters().queueSize(), 5U);
+
+    QSignalSpy disableSpy(opcuaClient, &QOpcUaClient::disableMonitoringFinished);
+    QVERIFY(opcuaClient->disableMonitoring(request));
+    disableSpy.wait(signalSpyTimeout);
+    QCOMPARE(disableSpy.size(), 1);
+    results = disableSpy.at(0).at(0).value<QVector<QOpcUaMonitoringItem>>();
+    QCOMPARE(results.size(), 4);
+    for (int i = 0; i < 3; ++i)
+        QCOMPARE(results.at(i).parameters().statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(results.at(3).parameters().statusCode(), QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+}
+
+void Tst_QOpcUaClient::tagTableMonitoring()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Tag tables are only supported by the open62541 backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(opcuaClient->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QOpcUaTagTable table;
+    QCOMPARE(table.addTag(readWriteNode), 0);
+    QCOMPARE(table.addTag(QStringLiteral("ns=3;s=InvalidNode")), 1);
+    QCOMPARE(table.addTag(QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")), 2);
+    QCOMPARE(table.size(), 3);
+    QCOMPARE(table.nodeId(2), QStringLiteral("ns=2;s=Demo.Static.Scalar.Double"));
+    QCOMPARE(table.statusCode(0), QOpcUa::UaStatusCode::BadWaitingForInitialData);
+
+    QSignalSpy tagsChangedSpy(opcuaClient, &QOpcUaClient::tagsChanged);
+    QVERIFY(opcuaClient->enableMonitoring(table, QOpcUaMonitoringParameters(100)));
+    QVERIFY(!opcuaClient->enableMonitoring(table, QOpcUaMonitoringParameters(100))); // Already monitored
+
+    // Initial values and the error for the invalid node are collected until the changes are taken
+    QSet<int> changed;
+    QTRY_VERIFY_WITH_TIMEOUT([&]() {
+        for (int tag : table.takeChangedTags())
+            changed.insert(tag);
+        return changed.size() == 3;
+    }(), signalSpyTimeout);
+    QVERIFY(tagsChangedSpy.size() >= 1);
+    QCOMPARE(tagsChangedSpy.at(0).at(0).value<QOpcUaTagTable>(), table);
+    QCOMPARE(table.statusCode(0), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(table.value(0).toDouble(), 0.0);
+    QVERIFY(table.sourceTimestamp(0).isValid());
+    QCOMPARE(table.statusCode(1), QOpcUa::UaStatusCode::BadNodeIdUnknown);
+    QCOMPARE(table.statusCode(2), QOpcUa::UaStatusCode::Good);
+
+    tagsChangedSpy.clear();
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(42)), QOpcUa::Types::Double);
+    QTRY_VERIFY_WITH_TIMEOUT(tagsChangedSpy.size() == 1, signalSpyTimeout);
+    QCOMPARE(table.takeChangedTags(), QVector<int>({0}));
+    QCOMPARE(table.value(0).toDouble(), 42.0);
+
+    QVERIFY(opcuaClient->disableMonitoring(table));
+    QVERIFY(!opcuaClient->disableMonitoring(table));
+}
+
+void Tst_QOpcUaClient::crawl()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Crawling is only supported by the open62541 backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QString objectsFolder = QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::ObjectsFolder);
+    const QString server = QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Server);
+
+    QOpcUaBrowseRequest request;
+    request.setReferenceTypeId(QOpcUa::ReferenceTypeId::HierarchicalReferences);
+    request.setIncludeSubtypes(true);
+
+    QSignalSpy referencesSpy(opcuaClient, &QOpcUaClient::crawlReferencesReceived);
+    QSignalSpy finishedSpy(opcuaClient, &QOpcUaClient::crawlFinished);
+
+    // Only the references of the start node are reported for a depth of 1
+    QVERIFY(opcuaClient->crawl({objectsFolder}, request, 1));
+    QVERIFY(!opcuaClient->crawl({objectsFolder}, request, 1)); // Another crawl is in progress
+    QTRY_COMPARE_WITH_TIMEOUT(finishedSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(finishedSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QVERIFY(referencesSpy.size() >= 1);
+
+    QSet<QString> targets;
+    for (const auto &batch : qAsConst(referencesSpy)) {
+        const auto sources = batch.at(0).toStringList();
+        const auto references = batch.at(1).value<QVector<QOpcUaReferenceDescription>>();
+        QCOMPARE(sources.size(), references.size());
+        for (int i = 0; i < sources.size(); ++i) {
+            QCOMPARE(sources.at(i), objectsFolder);
+            targets.insert(references.at(i).targetNodeId().nodeId());
+        }
+    }
+    QVERIFY(targets.contains(server));
+
+    // Deeper levels are browsed breadth-first, every node is browsed only once
+    referencesSpy.clear();
+    finishedSpy.clear();
+    QVERIFY(opcuaClient->crawl({objectsFolder, objectsFolder}, request, 3));
+    QTRY_COMPARE_WITH_TIMEOUT(finishedSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(finishedSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    QSet<QString> sources;
+    QSet<QString> seenReferences;
+    for (const auto &batch : qAsConst(referencesSpy)) {
+        const auto sourceNodeIds = batch.at(0).toStringList();
+        const auto references = batch.at(1).value<QVector<QOpcUaReferenceDescription>>();
+        QCOMPARE(sourceNodeIds.size(), references.size());
+        for (int i = 0; i < sourceNodeIds.size(); ++i) {
+            sources.insert(sourceNodeIds.at(i));
+            const QString key = QStringLiteral("%1 %2 %3 %4").arg(sourceNodeIds.at(i), references.at(i).refTypeId(),
+                                                                references.at(i).targetNodeId().nodeId())
+                    .arg(references.at(i).isForwardReference());
+            QVERIFY2(!seenReferences.contains(key), qPrintable(key));
+            seenReferences.insert(key);
+        }
+    }
+    QVERIFY(sources.contains(objectsFolder));
+    QVERIFY(sources.contains(server));
+
+    // Invalid start nodes are reported in the final status code
+    referencesSpy.clear();
+    finishedSpy.clear();
+    QVERIFY(opcuaClient->crawl({QStringLiteral("ns=0;x=Invalid")}, request));
+    QTRY_COMPARE_WITH_TIMEOUT(finishedSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(finishedSpy.at(0).at(0).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNodeIdInvalid);
+    QCOMPARE(referencesSpy.size(), 0);
+
+    QVERIFY(!opcuaClient->crawl(QStringList(), request));
+}
+
+void Tst_QOpcUaClient::addressSpaceCache()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("The address space cache is only supported by the open62541 backend");
+
+    QTemporaryDir cacheDir;
+    QVERIFY(cacheDir.isValid());
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("addressSpaceCacheDirectory"), cacheDir.path());
+
+    QOpcUaBrowseRequest request;
+    request.setReferenceTypeId(QOpcUa::ReferenceTypeId::HierarchicalReferences);
+    request.setIncludeSubtypes(true);
+
+    QVector<QOpcUaReferenceDescription> references;
+    QVariant displayName;
+
+    // The first session fills the cache, the second one is answered from it
+    for (int session = 0; session < 2; ++session) {
+        QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+        QVERIFY(client != nullptr);
+
+        {
+            OpcuaConnector connector(client.data(), m_endpoint);
+
+            QScopedPointer<QOpcUaNode> node(client->node("ns=1;s=Large.Folder"));
+            QVERIFY(node != nullptr);
+
+            READ_MANDATORY_BASE_NODE(node);
+            QCOMPARE(node->attribute(QOpcUa::NodeAttribute::NodeId).toString(), QStringLiteral("ns=1;s=Large.Folder"));
+            QCOMPARE(node->attribute(QOpcUa::NodeAttribute::NodeClass).value<QOpcUa::NodeClass>(), QOpcUa::NodeClass::Object);
+
+            QSignalSpy browseSpy(node.data(), &QOpcUaNode::browseFinished);
+            QVERIFY(node->browse(request));
+            browseSpy.wait(signalSpyTimeout);
+            QCOMPARE(browseSpy.size(), 1);
+            QCOMPARE(browseSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+            const auto result = browseSpy.at(0).at(0).value<QVector<QOpcUaReferenceDescription>>();
+            QCOMPARE(result.size(), 100);
+
+            if (session == 0) {
+                references = result;
+                displayName = node->attribute(QOpcUa::NodeAttribute::DisplayName);
+            } else {
+                for (int i = 0; i < result.size(); ++i) {
+                    QCOMPARE(result.at(i).targetNodeId(), references.at(i).targetNodeId());
+                    QCOMPARE(result.at(i).browseName(), references.at(i).browseName());
+                    QCOMPARE(result.at(i).displayName(), references.at(i).displayName());
+                    QCOMPARE(result.at(i).nodeClass(), references.at(i).nodeClass());
+                }
+                QCOMPARE(node->attribute(QOpcUa::NodeAttribute::DisplayName), displayName);
+            }
+
+            // The Value attribute is never cached
+            QScopedPointer<QOpcUaNode> valueNode(client->node(readWriteNode));
+            QVERIFY(valueNode != nullptr);
+            WRITE_VALUE_ATTRIBUTE(valueNode, QVariant(double(session)), QOpcUa::Types::Double);
+            READ_MANDATORY_VARIABLE_NODE(valueNode);
+            QCOMPARE(valueNode->attribute(QOpcUa::NodeAttribute::Value).toDouble(), double(session));
+
+            // Unknown nodes must not reach the monitored item for the model change events of the server object
+            const QVector<QOpcUaMonitoringItem> unknownItem = {
+                QOpcUaMonitoringItem(QStringLiteral("ns=0;i=2253"), QOpcUa::NodeAttribute::EventNotifier, QOpcUaMonitoringParameters(1000))
+            };
+
+            QSignalSpy modifySpy(client.data(), &QOpcUaClient::modifyMonitoringFinished);
+            QVERIFY(client->modifyMonitoring(unknownItem));
+            QTRY_COMPARE_WITH_TIMEOUT(modifySpy.size(), 1, signalSpyTimeout);
+            auto results = modifySpy.at(0).at(0).value<QVector<QOpcUaMonitoringItem>>();
+            QCOMPARE(results.size(), 1);
+            QCOMPARE(results.at(0).parameters().statusCode(), QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+
+            QSignalSpy disableSpy(client.data(), &QOpcUaClient::disableMonitoringFinished);
+            QVERIFY(client->disableMonitoring(unknownItem));
+            QTRY_COMPARE_WITH_TIMEOUT(disableSpy.size(), 1, signalSpyTimeout);
+            results = disableSpy.at(0).at(0).value<QVector<QOpcUaMonitoringItem>>();
+            QCOMPARE(results.size(), 1);
+            QCOMPARE(results.at(0).parameters().statusCode(), QOpcUa::UaStatusCode::BadMonitoredItemIdInvalid);
+        }
+
+        // The cache is written when the client disconnects
+        QCOMPARE(QDir(cacheDir.path()).entryList({QStringLiteral("*.cache")}, QDir::Files).size(), 1);
+    }
+}
+
+void Tst_QOpcUaClient::registerNodes()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Registering nodes is only supported by the open62541 backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    const QString doubleNode = QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+
+    QSignalSpy registerSpy(opcuaClient, &QOpcUaClient::registerNodesFinished);
+    QSignalSpy unregisterSpy(opcuaClient, &QOpcUaClient::unregisterNodesFinished);
+
+    QVERIFY(opcuaClient->registerNodes({doubleNode}));
+    QTRY_COMPARE_WITH_TIMEOUT(registerSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(registerSpy.at(0).at(0).toStringList(), QStringList({doubleNode}));
+    QCOMPARE(registerSpy.at(0).at(1).toStringList().size(), 1);
+    QVERIFY(!registerSpy.at(0).at(1).toStringList().at(0).isEmpty());
+    QCOMPARE(registerSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    // Reads and writes of the registered node still report the node id from the request
+    QSignalSpy writeSpy(opcuaClient, &QOpcUaClient::writeNodeAttributesFinished);
+    QVERIFY(opcuaClient->writeNodeAttributes({QOpcUaWriteItem(doubleNode, QOpcUa::NodeAttribute::Value,
+                                                              23.5, QOpcUa::Types::Double)}));
+    QTRY_COMPARE_WITH_TIMEOUT(writeSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    auto writeResults = writeSpy.at(0).at(0).value<QVector<QOpcUaWriteResult>>();
+    QCOMPARE(writeResults.size(), 1);
+    QCOMPARE(writeResults.at(0).nodeId(), doubleNode);
+    QCOMPARE(writeResults.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    QSignalSpy readSpy(opcuaClient, &QOpcUaClient::readNodeAttributesFinished);
+    QVERIFY(opcuaClient->readNodeAttributes({QOpcUaReadItem(doubleNode)}));
+    QTRY_COMPARE_WITH_TIMEOUT(readSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    auto readResults = readSpy.at(0).at(0).value<QVector<QOpcUaReadResult>>();
+    QCOMPARE(readResults.size(), 1);
+    QCOMPARE(readResults.at(0).nodeId(), doubleNode);
+    QCOMPARE(readResults.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(readResults.at(0).value().toDouble(), 23.5);
+
+    // A node registers its own node id once and releases the registration when it is destroyed
+    {
+        QScopedPointer<QOpcUaNode> node(opcuaClient->node(doubleNode));
+        QVERIFY(node != nullptr);
+        QSignalSpy nodeRegisterSpy(node.data(), &QOpcUaNode::registerNodeIdFinished);
+        QVERIFY(node->registerNodeId());
+        QVERIFY(!node->registerNodeId());
+        QTRY_COMPARE_WITH_TIMEOUT(nodeRegisterSpy.size(), 1, signalSpyTimeout);
+        QVERIFY(!nodeRegisterSpy.at(0).at(0).toString().isEmpty());
+        QCOMPARE(nodeRegisterSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+        QCOMPARE(registerSpy.size(), 1); // Node requests are not reported by the client
+        QVERIFY(!node->registerNodeId()); // Still registered after the successful result
+
+        WRITE_VALUE_ATTRIBUTE(node, 42.0, QOpcUa::Types::Double);
+        READ_MANDATORY_VARIABLE_NODE(node);
+        QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).toDouble(), 42.0);
+    }
+
+    QVERIFY(opcuaClient->unregisterNodes({doubleNode}));
+    QTRY_COMPARE_WITH_TIMEOUT(unregisterSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(unregisterSpy.at(0).at(0).toStringList(), QStringList({doubleNode}));
+    QCOMPARE(unregisterSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+
+    // The node id is still usable after it has been unregistered
+    readSpy.clear();
+    QVERIFY(opcuaClient->readNodeAttributes({QOpcUaReadItem(doubleNode)}));
+    QTRY_COMPARE_WITH_TIMEOUT(readSpy.size(), 1, signalSpyTimeout);
+    readResults = readSpy.at(0).at(0).value<QVector<QOpcUaReadResult>>();
+    QCOMPARE(readResults.size(), 1);
+    QCOMPARE(readResults.at(0).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(readResults.at(0).value().toDouble(), 42.0);
+
+    registerSpy.clear();
+    QVERIFY(opcuaClient->registerNodes(QStringList()));
+    QTRY_COMPARE_WITH_TIMEOUT(registerSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(registerSpy.at(0).at(2).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+}
+
+void Tst_QOpcUaClient::readHistoryData()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Reading historical data is only supported by the open62541 backend");
+
+    OpcuaConnector connector(opcuaClient, m_endpoint);
+
+    QSignalSpy dataSpy(opcuaClient, &QOpcUaClient::historyDataReceived);
+    QSignalSpy finishedSpy(opcuaClient, &QOpcUaClient::historyReadFinished);
+
+    if (!opcuaClient->readHistoryData(QOpcUaHistoryReadRequest()))
+        QSKIP("open62541 has been built without historizing support");
+
+    QTRY_COMPARE_WITH_TIMEOUT(finishedSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(finishedSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::BadNothingToDo);
+    QCOMPARE(dataSpy.size(), 0);
+
+    const QString historizedNode = QStringLiteral("ns=2;s=Demo.Static.Scalar.HistorizedDouble");
+    const QDateTime start = QDateTime::currentDateTimeUtc().addSecs(-1);
+
+    // The test server returns at most 10 values per response, 25 values require two continuations
+    {
+        QScopedPointer<QOpcUaNode> node(opcuaClient->node(historizedNode));
+        QVERIFY(node != nullptr);
+        for (int i = 1; i <= 25; ++i)
+            WRITE_VALUE_ATTRIBUTE(node, double(i), QOpcUa::Types::Double);
+    }
+
+    QOpcUaHistoryReadRequest request;
+    request.setType(QOpcUaHistoryReadRequest::Type::RawModified);
+    request.setNodeIds({historizedNode});
+    request.setStartTimestamp(start);
+    request.setEndTimestamp(QDateTime::currentDateTimeUtc().addSecs(1));
+
+    finishedSpy.clear();
+    QVERIFY(opcuaClient->readHistoryData(request));
+    QTRY_COMPARE_WITH_TIMEOUT(finishedSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(finishedSpy.at(0).at(0).value<QOpcUaHistoryReadRequest>(), request);
+    QCOMPARE(finishedSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QVERIFY(dataSpy.size() >= 3);
+
+    QVector<double> values;
+    qint64 lastTimestamp = QOpcUaHistoryData::InvalidTimestamp;
+    for (const auto &arguments : qAsConst(dataSpy)) {
+        QCOMPARE(arguments.at(0).value<QOpcUaHistoryReadRequest>(), request);
+        const auto data = arguments.at(1).value<QVector<QOpcUaHistoryData>>();
+        QCOMPARE(data.size(), 1);
+        QCOMPARE(data.at(0).nodeId(), historizedNode);
+        QVERIFY(data.at(0).values().canConvert<QVector<double>>());
+
+        const auto chunk = data.at(0).values().value<QVector<double>>();
+        QCOMPARE(chunk.size(), data.at(0).count());
+        values += chunk;
+
+        for (const qint64 timestamp : data.at(0).sourceTimestamps()) {
+            QVERIFY(timestamp != QOpcUaHistoryData::InvalidTimestamp);
+            QVERIFY(timestamp >= lastTimestamp);
+            lastTimestamp = timestamp;
+        }
+    }
+
+    QVERIFY(values.size() >= 25);
+    for (int i = 0; i < 25; ++i)
+        QCOMPARE(values.at(values.size() - 25 + i), double(i + 1));
+
+    // A node without history is reported with its status code
+    dataSpy.clear();
+    finishedSpy.clear();
+    request.setNodeIds({QStringLiteral("ns=2;s=Demo.Static.Scalar.Double")});
+    QVERIFY(opcuaClient->readHistoryData(request));
+    QTRY_COMPARE_WITH_TIMEOUT(finishedSpy.size(), 1, signalSpyTimeout);
+    QCOMPARE(dataSpy.size(), 1);
+    const auto data = dataSpy.at(0).at(1).value<QVector<QOpcUaHistoryData>>();
+    QCOMPARE(data.size(), 1);
+    QVERIFY(data.at(0).statusCode() != QOpcUa::UaStatusCode::Good);
+    QCOMPARE(data.at(0).count(), 0);
+}
+
+void Tst_QOpcUaClient::typedArrays()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Typed arrays are only supported by the open62541 backend");
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("typedArrays"), true);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(client->node("ns=2;s=Demo.Static.Arrays.Double"));
+    QVERIFY(node != nullptr);
+
+    const QVector<double> doubleValues({1.5, -2.25, 3e10});
+    const QVariant doubleValue = QVariant::fromValue(doubleValues);
+    WRITE_VALUE_ATTRIBUTE(node, doubleValue, QOpcUa::Types::Double);
+    READ_MANDATORY_VARIABLE_NODE(node);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).userType(), qMetaTypeId<QVector<double>>());
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).value<QVector<double>>(), doubleValues);
+
+    // Typed vectors are converted if the requested type doesn't match the element type
+    node.reset(client->node("ns=2;s=Demo.Static.Arrays.Int32"));
+    QVERIFY(node != nullptr);
+    const QVariant int64Value = QVariant::fromValue(QVector<qint64>({-1, 2, 3}));
+    WRITE_VALUE_ATTRIBUTE(node, int64Value, QOpcUa::Types::Int32);
+    READ_MANDATORY_VARIABLE_NODE(node);
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).value<QVector<qint32>>(), QVector<qint32>({-1, 2, 3}));
+
+    // The default client keeps returning a QVariantList
+    OpcuaConnector defaultConnector(opcuaClient, m_endpoint);
+    QScopedPointer<QOpcUaNode> defaultNode(opcuaClient->node("ns=2;s=Demo.Static.Arrays.Double"));
+    QVERIFY(defaultNode != nullptr);
+    READ_MANDATORY_VARIABLE_NODE(defaultNode);
+    QCOMPARE(defaultNode->attribute(QOpcUa::NodeAttribute::Value).type(), QVariant::List);
+    QCOMPARE(defaultNode->attribute(QOpcUa::NodeAttribute::Value).toList(),
+             QVariantList({1.5, -2.25, 3e10}));
+}
+
+void Tst_QOpcUaClient::zeroCopyExtensionObjects()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Zero copy extension objects are only supported by the open62541 backend");
+
+    OpcuaConnector defaultConnector(opcuaClient, m_endpoint);
+    QScopedPointer<QOpcUaNode> defaultNode(opcuaClient->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.ExtensionObject")));
+    QVERIFY(defaultNode != nullptr);
+
+    QOpcUaExtensionObject written;
+    ENCODE_EXTENSION_OBJECT(written, 0);
+    WRITE_VALUE_ATTRIBUTE(defaultNode, written, QOpcUa::Types::ExtensionObject);
+    READ_MANDATORY_VARIABLE_NODE(defaultNode);
+    const QOpcUaExtensionObject copied = defaultNode->attribute(QOpcUa::NodeAttribute::Value).value<QOpcUaExtensionObject>();
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("zeroCopyExtensionObjects"), true);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(client->node(QStringLiteral("ns=2;s=Demo.Static.Scalar.ExtensionObject")));
+    QVERIFY(node != nullptr);
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    QOpcUaExtensionObject obj = node->attribute(QOpcUa::NodeAttribute::Value).value<QOpcUaExtensionObject>();
+    QCOMPARE(obj, copied);
+    QCOMPARE(obj.encodedBody(), written.encodedBody());
+    VERIFY_EXTENSION_OBJECT(obj, 0);
+
+    // Modifying the adopted body must not affect other copies of the value
+    QOpcUaExtensionObject modified = obj;
+    modified.encodedBodyRef().append('x');
+    QCOMPARE(obj.encodedBody(), written.encodedBody());
+    QCOMPARE(node->attribute(QOpcUa::NodeAttribute::Value).value<QOpcUaExtensionObject>(), copied);
+}
+
 void Tst_QOpcUaClient::methodCall()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -3316,6 +4291,46 @@ void Tst_QOpcUaClient::multiDimensionalArray()
     QCOMPARE(readBack.value({1, 1, 2}), 11.0);
 
     QCOMPARE(arr, readBack);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        return;
+
+    // The open62541 backend stores numeric arrays in the typed storage
+    QVERIFY(readBack.isTyped());
+    QCOMPARE(readBack.valueType(), int(QMetaType::Double));
+    QCOMPARE(readBack.strides(), QVector<quint32>({6, 3, 1}));
+    QVERIFY(readBack.constTypedData<float>() == nullptr);
+    QCOMPARE(readBack.typedValueArray<double>(), QVector<double>({0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0}));
+
+    const auto view = readBack.view<double>();
+    QVERIFY(view.isValid());
+    QCOMPARE(view.size(), 12u);
+    QCOMPARE(view.value({1, 0, 2}), 8.0);
+    const auto plane = view.subArray(1);
+    QCOMPARE(plane.arrayDimensions(), QVector<quint32>({2, 3}));
+    QCOMPARE(plane.value({1, 1}), 10.0);
+    QCOMPARE(plane.subArray(0).value({2}), 8.0);
+    QVERIFY(!plane.subArray(2).isValid());
+    QVERIFY(!readBack.view<qint32>().isValid());
+
+    // Typed arrays are written without converting each element
+    QOpcUaMultiDimensionalArray typed(arrayDimensions);
+    typed.setTypedValueArray(QVector<double>({11.0, 10.0, 9.0, 8.0, 7.0, 6.0, 5.0, 4.0, 3.0, 2.0, 1.0, 0.0}));
+    QVERIFY(typed.isValid());
+    QVERIFY(typed.setValue({0, 0, 0}, 12));
+    QCOMPARE(typed.value({0, 0, 0}), 12.0);
+    WRITE_VALUE_ATTRIBUTE(node, typed, QOpcUa::Double);
+    READ_MANDATORY_VARIABLE_NODE(node);
+
+    readBack = node->attribute(QOpcUa::NodeAttribute::Value).value<QOpcUaMultiDimensionalArray>();
+    QCOMPARE(readBack, typed);
+    QCOMPARE(readBack.value({1, 1, 2}), 0.0);
+
+    // Switching to the QVariantList storage keeps the values
+    readBack.valueArrayRef()[0] = 13.0;
+    QVERIFY(!readBack.isTyped());
+    QCOMPARE(readBack.value({0, 0, 0}), 13.0);
+    QCOMPARE(readBack.value({0, 0, 1}), 10.0);
 }
 
 void Tst_QOpcUaClient::dateTimeConversion()
@@ -3639,6 +4654,636 @@ void Tst_QOpcUaClient::statusStrings()
     QCOMPARE(statusToString(QOpcUa::BadAggregateConfigurationRejected), "BadAggregateConfigurationRejected");
 }
 
+void Tst_QOpcUaClient::eventBatch()
+{
+    // The test server has no event support, the batch is checked without a server
+    QOpcUaEventBatch batch;
+    batch.setCount(2);
+    batch.setFieldNames({QStringLiteral("Severity"), QStringLiteral("Message"), QStringLiteral("ConditionClassName")});
+    batch.setFields({QVariant::fromValue(QVector<quint16>({100, 500})),
+                     QVariant::fromValue(QVector<QOpcUaLocalizedText>({QOpcUaLocalizedText(QStringLiteral("en"), QStringLiteral("First")),
+                                                                       QOpcUaLocalizedText(QStringLiteral("en"), QStringLiteral("Second"))})),
+                     QVariantList({QStringLiteral("Process"), QVariant()})});
+
+    QCOMPARE(batch.count(), 2);
+    QCOMPARE(batch.fieldCount(), 3);
+    QCOMPARE(batch.fieldIndex(QStringLiteral("Message")), 1);
+    QCOMPARE(batch.fieldIndex(QStringLiteral("EventId")), -1);
+
+    QCOMPARE(batch.typedField<quint16>(0), QVector<quint16>({100, 500}));
+    QVERIFY(batch.typedField<qint32>(0).isEmpty());
+    QVERIFY(batch.typedField<QString>(2).isEmpty());
+
+    QCOMPARE(batch.value(1, 0).userType(), int(QMetaType::UShort));
+    QCOMPARE(batch.value(1, 0).value<quint16>(), quint16(500));
+    QCOMPARE(batch.value(0, 1).value<QOpcUaLocalizedText>().text(), QStringLiteral("First"));
+    QCOMPARE(batch.value(0, 2), QVariant(QStringLiteral("Process")));
+    QVERIFY(!batch.value(1, 2).isValid());
+    QVERIFY(!batch.value(2, 0).isValid());
+    QVERIFY(!batch.value(0, 3).isValid());
+
+    const QVariantList fields = batch.eventFields(1);
+    QCOMPARE(fields.size(), 3);
+    QCOMPARE(fields.at(0).value<quint16>(), quint16(500));
+    QCOMPARE(fields.at(1).value<QOpcUaLocalizedText>().text(), QStringLiteral("Second"));
+    QVERIFY(!fields.at(2).isValid());
+
+    // Copies share the data until one of them is modified
+    QOpcUaEventBatch copy = batch;
+    copy.setCount(1);
+    QCOMPARE(batch.count(), 2);
+    QCOMPARE(copy.eventFields(0).size(), 3);
+}
+
+void Tst_QOpcUaClient::clientEventSignals()
+{
+    // The test server has no event support, the backend signals are emitted by the test
+    auto impl = new StubClientImpl;
+    QOpcUaClient client(impl);
+    emit impl->m_backend.stateAndOrErrorChanged(QOpcUaClient::Connected, QOpcUaClient::NoError);
+    QCOMPARE(client.state(), QOpcUaClient::Connected);
+
+    const QString serverNode = QOpcUa::namespace0Id(QOpcUa::NodeIds::Namespace0::Server);
+    QVERIFY(client.enableMonitoring({QOpcUaMonitoringItem(serverNode, QOpcUa::NodeAttribute::EventNotifier,
+                                                          QOpcUaMonitoringParameters(100))}));
+    QCOMPARE(impl->m_handles.size(), 1);
+    const quint64 handle = impl->m_handles.at(0);
+
+    QOpcUaEventBatch batch;
+    batch.setCount(3);
+    batch.setFieldNames({QStringLiteral("Severity"), QStringLiteral("Message")});
+    batch.setFields({QVariant::fromValue(QVector<quint16>({100, 200, 300})),
+                     QVariantList({QStringLiteral("First"), QStringLiteral("Second"), QStringLiteral("Third")})});
+
+    // Without a connection to eventOccurred(), only the batch is delivered
+    QSignalSpy batchSpy(&client, &QOpcUaClient::eventsOccurred);
+    emit impl->m_backend.eventsOccurred(handle, batch);
+    QCOMPARE(batchSpy.size(), 1);
+    QCOMPARE(batchSpy.at(0).at(0).toString(), serverNode);
+    QCOMPARE(batchSpy.at(0).at(1).value<QOpcUaEventBatch>().count(), 3);
+
+    // Each event of the batch is emitted after the batch
+    QVector<QVariantList> events;
+    QStringList signalOrder;
+    connect(&client, &QOpcUaClient::eventsOccurred, this, [&](const QString &nodeId) {
+        QCOMPARE(nodeId, serverNode);
+        signalOrder.append(QStringLiteral("batch"));
+    });
+    connect(&client, &QOpcUaClient::eventOccurred, this, [&](const QString &nodeId, const QVariantList &fields) {
+        QCOMPARE(nodeId, serverNode);
+        signalOrder.append(QStringLiteral("event"));
+        events.append(fields);
+    });
+
+    emit impl->m_backend.eventsOccurred(handle, batch);
+    QCOMPARE(signalOrder, QStringList({QStringLiteral("batch"), QStringLiteral("event"),
+                                       QStringLiteral("event"), QStringLiteral("event")}));
+    QCOMPARE(events.size(), 3);
+    for (int i = 0; i < events.size(); ++i) {
+        QCOMPARE(events.at(i).size(), 2);
+        QCOMPARE(events.at(i).at(0).value<quint16>(), quint16(100 * (i + 1)));
+        QCOMPARE(events.at(i).at(1), batch.value(i, 1));
+    }
+
+    // Single events of backends without batches are still delivered
+    events.clear();
+    emit impl->m_backend.eventOccurred(handle, {quint16(400), QStringLiteral("Fourth")});
+    QCOMPARE(events.size(), 1);
+    QCOMPARE(events.at(0).at(1).toString(), QStringLiteral("Fourth"));
+
+    // Events for unknown handles are dropped
+    events.clear();
+    emit impl->m_backend.eventsOccurred(handle + 1, batch);
+    QVERIFY(events.isEmpty());
+}
+
+void Tst_QOpcUaClient::readResultTimestamps()
+{
+    QOpcUaReadResult result;
+
+    // 0 means that the timestamp is not set
+    QCOMPARE(result.sourceTimestampRaw(), Q_INT64_C(0));
+    QVERIFY(!result.sourceTimestamp().isValid());
+    QCOMPARE(result.sourceTimestampMSecsSinceEpoch(), QOpcUaReadResult::InvalidTimestamp);
+    QVERIFY(!result.serverTimestamp().isValid());
+    QCOMPARE(result.serverTimestampMSecsSinceEpoch(), QOpcUaReadResult::InvalidTimestamp);
+
+    // 2020-09-13T12:26:40.123 UTC plus 456.7 microseconds, the QDateTime is in UTC and truncated to milliseconds
+    const qint64 raw = (Q_INT64_C(1600000000123) + Q_INT64_C(11644473600000)) * 10000 + 4567;
+    const QDateTime timestamp = QDateTime::fromMSecsSinceEpoch(Q_INT64_C(1600000000123), Qt::UTC);
+    result.setSourceTimestampRaw(raw);
+    result.setServerTimestampRaw(raw);
+    QCOMPARE(result.sourceTimestampRaw(), raw);
+    QCOMPARE(result.sourceTimestamp(), timestamp);
+    QCOMPARE(result.sourceTimestamp().timeSpec(), Qt::UTC);
+    QCOMPARE(result.sourceTimestampMSecsSinceEpoch(), timestamp.toMSecsSinceEpoch());
+    QCOMPARE(result.serverTimestamp(), timestamp);
+    QCOMPARE(result.serverTimestamp().timeSpec(), Qt::UTC);
+    QCOMPARE(result.serverTimestampMSecsSinceEpoch(), timestamp.toMSecsSinceEpoch());
+
+    // Round trip of QDateTime values in any time spec, the result is always in UTC
+    const QDateTime localTimestamp = timestamp.toLocalTime();
+    result.setSourceTimestamp(localTimestamp);
+    QCOMPARE(result.sourceTimestampRaw(), raw - 4567);
+    QCOMPARE(result.sourceTimestamp(), localTimestamp);
+    QCOMPARE(result.sourceTimestamp().toMSecsSinceEpoch(), localTimestamp.toMSecsSinceEpoch());
+    QCOMPARE(result.sourceTimestamp().timeSpec(), Qt::UTC);
+
+    const QDateTime offsetTimestamp = timestamp.toOffsetFromUtc(3600);
+    result.setServerTimestamp(offsetTimestamp);
+    QCOMPARE(result.serverTimestampRaw(), raw - 4567);
+    QCOMPARE(result.serverTimestamp().toMSecsSinceEpoch(), offsetTimestamp.toMSecsSinceEpoch());
+    QCOMPARE(result.serverTimestamp().timeSpec(), Qt::UTC);
+
+    // Raw values without a sub-millisecond part survive the round trip through QDateTime
+    QOpcUaReadResult copy;
+    copy.setSourceTimestamp(result.sourceTimestamp());
+    QCOMPARE(copy.sourceTimestampRaw(), result.sourceTimestampRaw());
+    QCOMPARE(copy.sourceTimestamp(), result.sourceTimestamp());
+
+    // An invalid QDateTime clears the timestamp
+    result.setSourceTimestamp(QDateTime());
+    QCOMPARE(result.sourceTimestampRaw(), Q_INT64_C(0));
+    QVERIFY(!result.sourceTimestamp().isValid());
+    QCOMPARE(result.sourceTimestampMSecsSinceEpoch(), QOpcUaReadResult::InvalidTimestamp);
+}
+
+void Tst_QOpcUaClient::lazyReadResultValue()
+{
+    // Copies share the lazy value, it is converted once
+    CountingLazyValue::decodeCount = 0;
+    QOpcUaReadResult result;
+    qt_setLazyValue(result, new CountingLazyValue(42.5));
+    QOpcUaReadResult copy = result;
+    QCOMPARE(CountingLazyValue::decodeCount.loadAcquire(), 0);
+    QCOMPARE(copy.value().toDouble(), 42.5);
+    QCOMPARE(result.value().toDouble(), 42.5);
+    QCOMPARE(copy.value().toDouble(), 42.5);
+    QCOMPARE(CountingLazyValue::decodeCount.loadAcquire(), 1);
+
+    // setValue() replaces the lazy value of one copy without converting it
+    CountingLazyValue::decodeCount = 0;
+    qt_setLazyValue(result, new CountingLazyValue(QStringLiteral("lazy")));
+    copy = result;
+    copy.setValue(23);
+    QCOMPARE(copy.value().toInt(), 23);
+    QCOMPARE(CountingLazyValue::decodeCount.loadAcquire(), 0);
+    QCOMPARE(result.value().toString(), QStringLiteral("lazy"));
+    QCOMPARE(CountingLazyValue::decodeCount.loadAcquire(), 1);
+    result.setValue(24);
+    QCOMPARE(result.value().toInt(), 24);
+    QCOMPARE(copy.value().toInt(), 23);
+
+    // Concurrent calls of value() from different threads wait for the same conversion
+    CountingLazyValue::decodeCount = 0;
+    qt_setLazyValue(result, new CountingLazyValue(QVariant::fromValue(QVector<double>({1, 2, 3}))));
+    const QOpcUaReadResult threadCopy = result;
+    QVariant threadValue;
+    QScopedPointer<QThread> thread(QThread::create([&threadCopy, &threadValue]() {
+        threadValue = threadCopy.value();
+    }));
+    thread->start();
+    const QVariant value = result.value();
+    QVERIFY(thread->wait(signalSpyTimeout));
+    QCOMPARE(CountingLazyValue::decodeCount.loadAcquire(), 1);
+    QCOMPARE(value.value<QVector<double>>(), QVector<double>({1, 2, 3}));
+    QCOMPARE(threadValue.value<QVector<double>>(), QVector<double>({1, 2, 3}));
+}
+
+void Tst_QOpcUaClient::lazyDataChangeValues()
+{
+    // The backend signals are emitted by the test, the values are only converted if they are read
+    auto impl = new StubClientImpl;
+    QOpcUaClient client(impl);
+    emit impl->m_backend.stateAndOrErrorChanged(QOpcUaClient::Connected, QOpcUaClient::NoError);
+
+    QVERIFY(client.enableMonitoring({QOpcUaMonitoringItem(readWriteNode, QOpcUa::NodeAttribute::Value,
+                                                          QOpcUaMonitoringParameters(100))}));
+    QCOMPARE(impl->m_handles.size(), 1);
+    const quint64 handle = impl->m_handles.at(0);
+
+    // Data changes of nodes monitored by the client
+    CountingLazyValue::decodeCount = 0;
+    QOpcUaReadResult first;
+    first.setAttribute(QOpcUa::NodeAttribute::Value);
+    first.setStatusCode(QOpcUa::UaStatusCode::Good);
+    qt_setLazyValue(first, new CountingLazyValue(1.5));
+    QOpcUaReadResult second = first;
+    qt_setLazyValue(second, new CountingLazyValue(2.5));
+
+    QSignalSpy dataChangesSpy(&client, &QOpcUaClient::dataChangesOccurred);
+    emit impl->m_backend.dataChangesOccurred({qMakePair(handle, first), qMakePair(handle, second)});
+    QCOMPARE(dataChangesSpy.size(), 1);
+    const auto values = dataChangesSpy.at(0).at(0).value<QVector<QOpcUaReadResult>>();
+    QCOMPARE(values.size(), 2);
+    QCOMPARE(values.at(1).nodeId(), readWriteNode);
+    QCOMPARE(values.at(1).statusCode(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(CountingLazyValue::decodeCount.loadAcquire(), 0);
+    QCOMPARE(values.at(1).value().toDouble(), 2.5);
+    QCOMPARE(CountingLazyValue::decodeCount.loadAcquire(), 1);
+
+    // Tags which are overwritten before they are read are never converted
+    CountingLazyValue::decodeCount = 0;
+    QOpcUaTagTable table;
+    table.addTag(readWriteNode);
+    const quint32 tableId = 1;
+    impl->m_backend.registerTagTable(tableId, table);
+    const quint64 tagHandle = QOpcUaTagTablePrivate::tagHandle(tableId, 0);
+
+    QOpcUaReadResult tagValue;
+    tagValue.setStatusCode(QOpcUa::UaStatusCode::Good);
+    qt_setLazyValue(tagValue, new CountingLazyValue(3.5));
+    QVERIFY(impl->m_backend.updateTagTable(tagHandle, tagValue));
+    qt_setLazyValue(tagValue, new CountingLazyValue(4.5));
+    QVERIFY(impl->m_backend.updateTagTable(tagHandle, tagValue));
+    QCOMPARE(table.statusCode(0), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(CountingLazyValue::decodeCount.loadAcquire(), 0);
+    QCOMPARE(table.value(0).toDouble(), 4.5);
+    QCOMPARE(table.value(0).toDouble(), 4.5);
+    QCOMPARE(CountingLazyValue::decodeCount.loadAcquire(), 1);
+    impl->m_backend.unregisterTagTable(tableId);
+}
+
+void Tst_QOpcUaClient::pubSubReader()
+{
+    // The datagrams are encoded here, the reader doesn't need a server
+    quint16 port = 0;
+    {
+        QUdpSocket probe;
+        QVERIFY(probe.bind(QHostAddress::LocalHost, 0));
+        port = probe.localPort();
+    }
+
+    QOpcUaPubSubReader reader;
+    reader.setWriterGroupId(100);
+    reader.setFieldNames({QStringLiteral("Counter"), QStringLiteral("Value"), QStringLiteral("Name")});
+    QVERIFY(!reader.bind(QUrl(QStringLiteral("opc.tcp://127.0.0.1:%1").arg(port))));
+    QVERIFY(reader.bind(QUrl(QStringLiteral("opc.udp://127.0.0.1:%1").arg(port))));
+    QVERIFY(reader.isBound());
+
+    QSignalSpy spy(&reader, &QOpcUaPubSubReader::dataSetsReceived);
+    QUdpSocket sender;
+    const QDateTime timestamp = QDateTime::fromMSecsSinceEpoch(Q_INT64_C(1600000000123), Qt::UTC);
+
+    // NetworkMessage with PublisherId, WriterGroupId, one DataSetMessage of writer 7 and the DataSetMessage header
+    const auto networkMessage = [](quint16 writerGroupId, quint8 fieldEncoding, quint8 messageType, quint16 sequenceNumber,
+                                   quint16 dataSetWriterId = 7) {
+        QByteArray data;
+        QOpcUaBinaryDataEncoding encoder(&data);
+        encoder.encode<quint8>(0x01 | 0x10 | 0x20 | 0x40 | 0x80);
+        encoder.encode<quint8>(0x01); // UInt16 PublisherId
+        encoder.encode<quint16>(2234);
+        encoder.encode<quint8>(0x01); // WriterGroupId
+        encoder.encode<quint16>(writerGroupId);
+        encoder.encode<quint8>(1);
+        encoder.encode<quint16>(dataSetWriterId);
+        encoder.encode<quint8>(0x01 | (fieldEncoding << 1) | 0x08 | 0x80);
+        encoder.encode<quint8>(messageType | 0x10);
+        encoder.encode<quint16>(sequenceNumber);
+        return data;
+    };
+
+    const auto send = [&](const QByteArray &data) {
+        spy.clear();
+        return sender.writeDatagram(data, QHostAddress::LocalHost, port) == data.size() && spy.wait(signalSpyTimeout);
+    };
+
+    // Key frame with Variant encoding, the encoder appends to data after each assignment
+    QByteArray data = networkMessage(100, 0, 0, 1);
+    QOpcUaBinaryDataEncoding encoder(&data);
+    encoder.encode<QDateTime>(timestamp);
+    encoder.encode<quint16>(3);
+    encoder.encode<quint8>(7); // UInt32
+    encoder.encode<quint32>(10);
+    encoder.encode<quint8>(11); // Double
+    encoder.encode<double>(1.5);
+    encoder.encode<quint8>(12); // String
+    encoder.encode<QString>(QStringLiteral("Pump"));
+    QVERIFY(send(data));
+
+    QOpcUaDataSetBatch batch = spy.at(0).at(0).value<QOpcUaDataSetBatch>();
+    QCOMPARE(batch.count(), 1);
+    QCOMPARE(batch.fieldIndex(QStringLiteral("Value")), 1);
+    QCOMPARE(batch.typedField<quint32>(0), QVector<quint32>({10}));
+    QCOMPARE(batch.typedField<double>(1), QVector<double>({1.5}));
+    QCOMPARE(batch.typedField<QString>(2), QVector<QString>({QStringLiteral("Pump")}));
+    QCOMPARE(batch.dataSetWriterIds(), QVector<quint16>({7}));
+    QCOMPARE(batch.sequenceNumbers(), QVector<quint16>({1}));
+    QCOMPARE(batch.timestamps(), QVector<qint64>({timestamp.toMSecsSinceEpoch()}));
+    QCOMPARE(batch.statusCodes(), QVector<QOpcUa::UaStatusCode>({QOpcUa::UaStatusCode::Good}));
+
+    // Delta frame, the fields which are not contained keep their last value
+    data = networkMessage(100, 0, 1, 2);
+    encoder.encode<QDateTime>(timestamp);
+    encoder.encode<quint16>(1);
+    encoder.encode<quint16>(1);
+    encoder.encode<quint8>(11);
+    encoder.encode<double>(2.5);
+    QVERIFY(send(data));
+
+    batch = spy.at(0).at(0).value<QOpcUaDataSetBatch>();
+    QCOMPARE(batch.count(), 1);
+    QCOMPARE(batch.typedField<quint32>(0), QVector<quint32>({10}));
+    QCOMPARE(batch.typedField<double>(1), QVector<double>({2.5}));
+    QCOMPARE(batch.value(0, 2), QVariant(QStringLiteral("Pump")));
+
+    // Messages of other writer groups are ignored, a field with an unexpected type makes its column generic
+    const QByteArray otherGroup = networkMessage(200, 0, 0, 3);
+    QCOMPARE(sender.writeDatagram(otherGroup, QHostAddress::LocalHost, port), qint64(otherGroup.size()));
+    data = networkMessage(100, 0, 0, 4);
+    encoder.encode<QDateTime>(timestamp);
+    encoder.encode<quint16>(3);
+    encoder.encode<quint8>(8); // Int64
+    encoder.encode<qint64>(-1);
+    encoder.encode<quint8>(11);
+    encoder.encode<double>(3.5);
+    encoder.encode<quint8>(12);
+    encoder.encode<QString>(QStringLiteral("Valve"));
+    QVERIFY(send(data));
+
+    batch = spy.at(0).at(0).value<QOpcUaDataSetBatch>();
+    QCOMPARE(batch.count(), 1);
+    QCOMPARE(batch.sequenceNumbers(), QVector<quint16>({4}));
+    QCOMPARE(batch.field(0).userType(), int(QMetaType::QVariantList));
+    QCOMPARE(batch.value(0, 0), QVariant::fromValue(qint64(-1)));
+    QCOMPARE(batch.typedField<double>(1), QVector<double>({3.5}));
+
+    // A truncated key frame keeps the last values of the missing fields
+    data = networkMessage(100, 0, 0, 5);
+    encoder.encode<QDateTime>(timestamp);
+    encoder.encode<quint16>(3);
+    encoder.encode<quint8>(7);
+    encoder.encode<quint32>(11);
+    encoder.encode<quint8>(11);
+    QVERIFY(send(data));
+
+    batch = spy.at(0).at(0).value<QOpcUaDataSetBatch>();
+    QCOMPARE(batch.typedField<quint32>(0), QVector<quint32>({11}));
+    QCOMPARE(batch.typedField<double>(1), QVector<double>({3.5}));
+    QCOMPARE(batch.typedField<QString>(2), QVector<QString>({QStringLiteral("Valve")}));
+    QCOMPARE(batch.statusCodes(), QVector<QOpcUa::UaStatusCode>({QOpcUa::UaStatusCode::BadDecodingError}));
+
+    // RawData requires the field types
+    reader.setFieldTypes({QOpcUa::Types::UInt32, QOpcUa::Types::Double, QOpcUa::Types::String});
+    data = networkMessage(100, 1, 0, 6);
+    encoder.encode<QDateTime>(timestamp);
+    encoder.encode<quint32>(12);
+    encoder.encode<double>(4.5);
+    encoder.encode<QString>(QStringLiteral("Tank"));
+    QVERIFY(send(data));
+
+    batch = spy.at(0).at(0).value<QOpcUaDataSetBatch>();
+    QCOMPARE(batch.typedField<quint32>(0), QVector<quint32>({12}));
+    QCOMPARE(batch.typedField<double>(1), QVector<double>({4.5}));
+    QCOMPARE(batch.typedField<QString>(2), QVector<QString>({QStringLiteral("Tank")}));
+    QCOMPARE(batch.statusCodes(), QVector<QOpcUa::UaStatusCode>({QOpcUa::UaStatusCode::Good}));
+
+    // Interleaved writers, the fields which are not contained in a delta frame keep the values of its own writer
+    data = networkMessage(100, 1, 0, 7, 8);
+    encoder.encode<QDateTime>(timestamp);
+    encoder.encode<quint32>(20);
+    encoder.encode<double>(8.5);
+    encoder.encode<QString>(QStringLiteral("Fan"));
+    QVERIFY(send(data));
+
+    data = networkMessage(100, 1, 1, 8);
+    encoder.encode<QDateTime>(timestamp);
+    encoder.encode<quint16>(1);
+    encoder.encode<quint16>(0);
+    encoder.encode<quint32>(13);
+    QVERIFY(send(data));
+
+    batch = spy.at(0).at(0).value<QOpcUaDataSetBatch>();
+    QCOMPARE(batch.dataSetWriterIds(), QVector<quint16>({7}));
+    QCOMPARE(batch.typedField<quint32>(0), QVector<quint32>({13}));
+    QCOMPARE(batch.typedField<double>(1), QVector<double>({4.5}));
+    QCOMPARE(batch.typedField<QString>(2), QVector<QString>({QStringLiteral("Tank")}));
+
+    data = networkMessage(100, 1, 1, 9, 8);
+    encoder.encode<QDateTime>(timestamp);
+    encoder.encode<quint16>(1);
+    encoder.encode<quint16>(1);
+    encoder.encode<double>(9.5);
+    QVERIFY(send(data));
+
+    batch = spy.at(0).at(0).value<QOpcUaDataSetBatch>();
+    QCOMPARE(batch.dataSetWriterIds(), QVector<quint16>({8}));
+    QCOMPARE(batch.typedField<quint32>(0), QVector<quint32>({20}));
+    QCOMPARE(batch.typedField<double>(1), QVector<double>({9.5}));
+    QCOMPARE(batch.typedField<QString>(2), QVector<QString>({QStringLiteral("Fan")}));
+
+    // A delta frame of a writer without a key frame is dropped
+    data = networkMessage(100, 1, 1, 10, 9);
+    encoder.encode<QDateTime>(timestamp);
+    encoder.encode<quint16>(1);
+    encoder.encode<quint16>(0);
+    encoder.encode<quint32>(30);
+    QCOMPARE(sender.writeDatagram(data, QHostAddress::LocalHost, port), qint64(data.size()));
+    QTRY_COMPARE_WITH_TIMEOUT(reader.droppedMessageCount(), quint64(1), signalSpyTimeout);
+
+    // Unsupported UADP version
+    QCOMPARE(sender.writeDatagram(QByteArray(1, '\x02'), QHostAddress::LocalHost, port), qint64(1));
+    QTRY_COMPARE_WITH_TIMEOUT(reader.droppedMessageCount(), quint64(2), signalSpyTimeout);
+    QCOMPARE(reader.receivedMessageCount(), quint64(8));
+
+    reader.close();
+    QVERIFY(!reader.isBound());
+}
+
+void Tst_QOpcUaClient::testServerPublisher()
+{
+    if (m_testServerPath.isEmpty())
+        QSKIP("This test requires its own test server with an enabled UADP publisher");
+
+    QUdpSocket socket;
+    QVERIFY(socket.bind(QHostAddress::LocalHost, 0));
+    const quint16 port = socket.localPort();
+
+    // A second server which publishes 100 DataSetMessages per second with Variant encoding
+    QProcess serverProcess;
+    serverProcess.start(m_testServerPath, {QStringLiteral("--port"), QStringLiteral("43346"),
+                                           QStringLiteral("--pubsub-url"), QStringLiteral("opc.udp://127.0.0.1:%1").arg(port),
+                                           QStringLiteral("--pubsub-rate"), QStringLiteral("100")});
+    QVERIFY2(serverProcess.waitForStarted(), qPrintable(serverProcess.errorString()));
+
+    // The headers of the first messages, every tenth DataSetMessage is a key frame
+    constexpr int messageCount = 25;
+    int keyFrames = 0;
+    int deltaFrames = 0;
+    int previousSequenceNumber = -1;
+    for (int i = 0; i < messageCount; ++i) {
+        if (!socket.hasPendingDatagrams())
+            QVERIFY(socket.waitForReadyRead(signalSpyTimeout));
+
+        QByteArray data(static_cast<int>(socket.pendingDatagramSize()), Qt::Uninitialized);
+        QCOMPARE(socket.readDatagram(data.data(), data.size()), qint64(data.size()));
+
+        QOpcUaBinaryDataEncoding decoder(&data);
+        bool success = true;
+        QCOMPARE(decoder.decode<quint8>(success), quint8(0x01 | 0x10 | 0x20 | 0x40 | 0x80));
+        QCOMPARE(decoder.decode<quint8>(success), quint8(0x01 | 0x20));
+        QCOMPARE(decoder.decode<quint16>(success), quint16(2234));
+        QCOMPARE(decoder.decode<quint8>(success), quint8(0x01 | 0x08));
+        QCOMPARE(decoder.decode<quint16>(success), quint16(100));
+        const quint16 sequenceNumber = decoder.decode<quint16>(success);
+        QCOMPARE(decoder.decode<quint8>(success), quint8(1));
+        QCOMPARE(decoder.decode<quint16>(success), quint16(62541));
+        QVERIFY(decoder.decode<QDateTime>(success).isValid());
+        QCOMPARE(decoder.decode<quint8>(success), quint8(0x01 | 0x08 | 0x80));
+        const quint8 messageType = decoder.decode<quint8>(success);
+        QCOMPARE(decoder.decode<quint16>(success), sequenceNumber);
+        QVERIFY(success);
+
+        if (previousSequenceNumber >= 0)
+            QCOMPARE(int(sequenceNumber), previousSequenceNumber + 1);
+        previousSequenceNumber = sequenceNumber;
+
+        if (sequenceNumber % 10 == 0) {
+            // Key frame with all four fields
+            QCOMPARE(messageType, quint8(0));
+            QCOMPARE(decoder.decode<quint16>(success), quint16(4));
+            QCOMPARE(decoder.decode<quint8>(success), quint8(7)); // UInt32
+            QCOMPARE(decoder.decode<quint32>(success), quint32(sequenceNumber));
+            QCOMPARE(decoder.decode<quint8>(success), quint8(11)); // Double
+            decoder.decode<double>(success);
+            QCOMPARE(decoder.decode<quint8>(success), quint8(1)); // Boolean
+            decoder.decode<bool>(success);
+            QCOMPARE(decoder.decode<quint8>(success), quint8(12)); // String
+            QCOMPARE(decoder.decode<QString>(success), QStringLiteral("open62541-testserver"));
+            ++keyFrames;
+        } else {
+            // Delta frame with the changed Counter and Sine fields
+            QCOMPARE(messageType, quint8(1));
+            QCOMPARE(decoder.decode<quint16>(success), quint16(2));
+            QCOMPARE(decoder.decode<quint16>(success), quint16(0));
+            QCOMPARE(decoder.decode<quint8>(success), quint8(7));
+            QCOMPARE(decoder.decode<quint32>(success), quint32(sequenceNumber));
+            QCOMPARE(decoder.decode<quint16>(success), quint16(1));
+            QCOMPARE(decoder.decode<quint8>(success), quint8(11));
+            decoder.decode<double>(success);
+            ++deltaFrames;
+        }
+        QVERIFY(success);
+        QCOMPARE(decoder.offset(), data.size());
+    }
+    QVERIFY(keyFrames >= 2);
+    QVERIFY(deltaFrames >= 2 * 9);
+
+    // The reader completes the delta frames with the fields of the last key frame
+    socket.close();
+    QOpcUaPubSubReader reader;
+    reader.setPublisherId(QVariant::fromValue(quint16(2234)));
+    reader.setWriterGroupId(100);
+    reader.setDataSetWriterId(62541);
+    reader.setFieldNames({QStringLiteral("Counter"), QStringLiteral("Sine"), QStringLiteral("Flag"), QStringLiteral("Name")});
+    QSignalSpy spy(&reader, &QOpcUaPubSubReader::dataSetsReceived);
+    QVERIFY(reader.bind(QUrl(QStringLiteral("opc.udp://127.0.0.1:%1").arg(port))));
+
+    QTRY_VERIFY_WITH_TIMEOUT(reader.receivedMessageCount() >= 2 * 10, signalSpyTimeout);
+    QCOMPARE(reader.droppedMessageCount(), quint64(0));
+
+    bool keyFrameSeen = false;
+    for (const QList<QVariant> &arguments : qAsConst(spy)) {
+        const QOpcUaDataSetBatch batch = arguments.at(0).value<QOpcUaDataSetBatch>();
+        const QVector<quint16> sequenceNumbers = batch.sequenceNumbers();
+        const QVector<quint32> counters = batch.typedField<quint32>(0);
+        QCOMPARE(counters.size(), batch.count());
+        for (int i = 0; i < batch.count(); ++i) {
+            QCOMPARE(counters.at(i), quint32(sequenceNumbers.at(i)));
+            QCOMPARE(batch.dataSetWriterIds().at(i), quint16(62541));
+            keyFrameSeen |= sequenceNumbers.at(i) % 10 == 0;
+            // Flag and Name are only valid after the first key frame
+            if (keyFrameSeen)
+                QCOMPARE(batch.value(i, 3), QVariant(QStringLiteral("open62541-testserver")));
+        }
+    }
+    QVERIFY(keyFrameSeen);
+
+    reader.close();
+    serverProcess.kill();
+    serverProcess.waitForFinished();
+}
+
+void Tst_QOpcUaClient::simulatedVariables()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (m_testServerPath.isEmpty())
+        QSKIP("This test requires its own test server with simulated variables");
+
+    // A second server with ramp values, Double.0 changes ten times and Int32.1 four times per second
+    const quint16 port = 43347;
+    QProcess serverProcess;
+    serverProcess.start(m_testServerPath, {QStringLiteral("--port"), QString::number(port),
+                                           QStringLiteral("--simulation-variables"), QStringLiteral("4"),
+                                           QStringLiteral("--simulation-rates"), QStringLiteral("10,4"),
+                                           QStringLiteral("--simulation-distribution"), QStringLiteral("ramp")});
+    QVERIFY2(serverProcess.waitForStarted(), qPrintable(serverProcess.errorString()));
+    const auto stopServer = qScopeGuard([&serverProcess]() {
+        serverProcess.kill();
+        serverProcess.waitForFinished();
+    });
+
+    bool listening = false;
+    for (int i = 0; i < 20 && !listening; ++i) {
+        QTcpSocket socket;
+        socket.connectToHost(QHostAddress::LocalHost, port);
+        listening = socket.waitForConnected(250);
+        if (!listening)
+            QTest::qWait(250);
+    }
+    QVERIFY2(listening, "Server does not run");
+
+    QOpcUaEndpointDescription endpoint = m_endpoint;
+    QUrl endpointUrl(endpoint.endpointUrl());
+    endpointUrl.setPort(port);
+    endpoint.setEndpointUrl(endpointUrl.toString());
+
+    OpcuaConnector connector(opcuaClient, endpoint);
+
+    QSignalSpy namespaceSpy(opcuaClient, &QOpcUaClient::namespaceArrayUpdated);
+    QVERIFY(opcuaClient->updateNamespaceArray());
+    QTRY_VERIFY_WITH_TIMEOUT(namespaceSpy.size() > 0, signalSpyTimeout);
+    const int ns = opcuaClient->namespaceArray().indexOf(QStringLiteral("http://qt-project.org/Simulation/0"));
+    QVERIFY(ns > 0);
+
+    const QVector<QOpcUaReadItem> items = {
+        QOpcUaReadItem(QStringLiteral("ns=%1;s=Simulation.Double.0").arg(ns)),
+        QOpcUaReadItem(QStringLiteral("ns=%1;s=Simulation.Int32.1").arg(ns))
+    };
+    const QVector<double> rates = {10, 4};
+
+    const auto readValues = [&]() {
+        QVector<double> values;
+        QSignalSpy readSpy(opcuaClient, &QOpcUaClient::readNodeAttributesFinished);
+        if (!opcuaClient->readNodeAttributes(items) || !readSpy.wait(signalSpyTimeout))
+            return values;
+        const auto results = readSpy.at(0).at(0).value<QVector<QOpcUaReadResult>>();
+        for (const auto &result : results) {
+            if (result.statusCode() == QOpcUa::UaStatusCode::Good)
+                values.append(result.value().toDouble());
+        }
+        return values;
+    };
+
+    // The ramp advances by one per update, the difference of two reads is the number of updates in between
+    QElapsedTimer timer;
+    const QVector<double> first = readValues();
+    timer.start();
+    QCOMPARE(first.size(), items.size());
+    QTest::qWait(2000);
+    const QVector<double> second = readValues();
+    const double seconds = timer.elapsed() / 1000.0;
+    QCOMPARE(second.size(), items.size());
+
+    for (int i = 0; i < items.size(); ++i) {
+        const double expected = rates.at(i) * seconds;
+        const double updates = second.at(i) - first.at(i);
+        QVERIFY2(qAbs(updates - expected) <= expected * 0.25 + 2,
+                 qPrintable(QStringLiteral("%1 updates of %2 in %3 s").arg(updates).arg(items.at(i).nodeId()).arg(seconds)));
+    }
+}
+
 void Tst_QOpcUaClient::addNamespace()
 {
     QFETCH(QOpcUaClient *, opcuaClient);
@@ -3757,6 +5402,110 @@ void Tst_QOpcUaClient::connectionLost()
     QCOMPARE(stateSpy.at(0).at(0).value<QOpcUaClient::ClientState>(), QOpcUaClient::ClientState::Disconnected);
 }
 
+void Tst_QOpcUaClient::connectionRecovery()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Automatic reconnects are only supported by the open62541 backend");
+
+    // Restart the test server if necessary
+    if (m_serverProcess.state() != QProcess::ProcessState::Running) {
+        m_serverProcess.start(m_testServerPath);
+        QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+        QTest::qSleep(2000);
+    }
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("reconnectInterval"), 500);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QScopedPointer<QOpcUaNode> node(client->node(readWriteNode));
+    QVERIFY(node != nullptr);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(0)), QOpcUa::Types::Double);
+
+    QSignalSpy monitoringEnabledSpy(node.data(), &QOpcUaNode::enableMonitoringFinished);
+    node->enableMonitoring(QOpcUa::NodeAttribute::Value, QOpcUaMonitoringParameters(100));
+    monitoringEnabledSpy.wait(signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+    QCOMPARE(node->monitoringStatus(QOpcUa::NodeAttribute::Value).statusCode(), QOpcUa::UaStatusCode::Good);
+
+    QSignalSpy stateSpy(client.data(), &QOpcUaClient::stateChanged);
+    QSignalSpy connectedSpy(client.data(), &QOpcUaClient::connected);
+    QSignalSpy disconnectedSpy(client.data(), &QOpcUaClient::disconnected);
+    QSignalSpy recoveredSpy(client.data(), &QOpcUaClient::connectionRecovered);
+    QSignalSpy monitoringDisabledSpy(node.data(), &QOpcUaNode::disableMonitoringFinished);
+
+    m_serverProcess.kill();
+    m_serverProcess.waitForFinished();
+    QCOMPARE(m_serverProcess.state(), QProcess::ProcessState::NotRunning);
+
+    // The client keeps trying to reconnect instead of disconnecting
+    QTRY_COMPARE_WITH_TIMEOUT(client->state(), QOpcUaClient::ClientState::Connecting, 10000);
+
+    m_serverProcess.start(m_testServerPath);
+    QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+
+    QTRY_COMPARE_WITH_TIMEOUT(recoveredSpy.size(), 1, 15000);
+    QCOMPARE(client->state(), QOpcUaClient::ClientState::Connected);
+    QCOMPARE(connectedSpy.size(), 0);
+    QCOMPARE(disconnectedSpy.size(), 0);
+    QCOMPARE(monitoringDisabledSpy.size(), 0);
+    QCOMPARE(stateSpy.size(), 2);
+    QCOMPARE(stateSpy.at(0).at(0).value<QOpcUaClient::ClientState>(), QOpcUaClient::ClientState::Connecting);
+    QCOMPARE(stateSpy.at(1).at(0).value<QOpcUaClient::ClientState>(), QOpcUaClient::ClientState::Connected);
+
+    // The monitored item has been recovered without enabling monitoring again
+    QSignalSpy dataChangeSpy(node.data(), &QOpcUaNode::dataChangeOccurred);
+    WRITE_VALUE_ATTRIBUTE(node, QVariant(double(42)), QOpcUa::Types::Double);
+    QTRY_VERIFY_WITH_TIMEOUT(dataChangeSpy.size() > 0 &&
+                             dataChangeSpy.last().at(1).value<QVariant>() == QVariant(double(42)), signalSpyTimeout);
+    QCOMPARE(monitoringEnabledSpy.size(), 1);
+}
+
+void Tst_QOpcUaClient::disconnectWhileReconnecting()
+{
+    QFETCH(QOpcUaClient *, opcuaClient);
+
+    if (opcuaClient->backend() != QLatin1String("open62541"))
+        QSKIP("Automatic reconnects are only supported by the open62541 backend");
+
+    // Restart the test server if necessary
+    if (m_serverProcess.state() != QProcess::ProcessState::Running) {
+        m_serverProcess.start(m_testServerPath);
+        QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+        QTest::qSleep(2000);
+    }
+
+    QVariantMap backendOptions;
+    backendOptions.insert(QLatin1String("reconnectInterval"), 200);
+    QScopedPointer<QOpcUaClient> client(m_opcUa.createClient(opcuaClient->backend(), backendOptions));
+    QVERIFY(client != nullptr);
+    OpcuaConnector connector(client.data(), m_endpoint);
+
+    QSignalSpy disconnectedSpy(client.data(), &QOpcUaClient::disconnected);
+    QSignalSpy recoveredSpy(client.data(), &QOpcUaClient::connectionRecovered);
+
+    m_serverProcess.kill();
+    m_serverProcess.waitForFinished();
+    QCOMPARE(m_serverProcess.state(), QProcess::ProcessState::NotRunning);
+    QTRY_COMPARE_WITH_TIMEOUT(client->state(), QOpcUaClient::ClientState::Connecting, 10000);
+
+    // Disconnecting while the server is down stops the reconnect attempts
+    client->disconnectFromEndpoint();
+    QTRY_COMPARE_WITH_TIMEOUT(client->state(), QOpcUaClient::ClientState::Disconnected, signalSpyTimeout);
+    QCOMPARE(disconnectedSpy.size(), 1);
+
+    m_serverProcess.start(m_testServerPath);
+    QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+    QTest::qWait(3000);
+    QCOMPARE(client->state(), QOpcUaClient::ClientState::Disconnected);
+    QCOMPARE(recoveredSpy.size(), 0);
+    QCOMPARE(disconnectedSpy.size(), 1);
+}
+
 void Tst_QOpcUaClient::cleanupTestCase()
 {
     if (m_serverProcess.state() == QProcess::Running) {
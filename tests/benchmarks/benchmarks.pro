@@ -0,0 +1,6 @@
+TEMPLATE = subdirs
+SUBDIRS += commandqueue nodeid
+
+QT_FOR_CONFIG += opcua-private
+
+qtConfig(open62541): SUBDIRS += endtoend
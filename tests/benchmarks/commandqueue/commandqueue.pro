@@ -0,0 +1,10 @@
+TARGET = tst_bench_commandqueue
+
+QT += testlib
+QT -= gui
+CONFIG += benchmark
+
+INCLUDEPATH += $$PWD/../../../src/plugins/opcua/open62541
+
+SOURCES += \
+    tst_bench_commandqueue.cpp
@@ -0,0 +1,178 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "qopen62541commandqueue.h"
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QThread>
+#include <QtCore/QVariant>
+
+#include <QtTest/QtTest>
+
+// Stands in for the backend, the slot has the same shape as Open62541AsyncBackend::writeAttribute()
+class Receiver : public QObject
+{
+    Q_OBJECT
+
+public:
+    QOpen62541CommandQueue queue;
+    int calls = 0;
+
+public slots:
+    void writeAttribute(quint64 handle, QVariant value, QString indexRange)
+    {
+        Q_UNUSED(handle);
+        Q_UNUSED(value);
+        Q_UNUSED(indexRange);
+        ++calls;
+    }
+
+    void drain()
+    {
+        queue.drain();
+    }
+};
+
+class tst_Bench_CommandQueue : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void invokeMethod_data() { requestCounts(); }
+    void invokeMethod();
+    void commandQueue_data() { requestCounts(); }
+    void commandQueue();
+    void commandQueueCrossThread_data() { requestCounts(); }
+    void commandQueueCrossThread();
+
+private:
+    void requestCounts();
+};
+
+void tst_Bench_CommandQueue::requestCounts()
+{
+    QTest::addColumn<int>("requests");
+
+    QTest::newRow("1") << 1;
+    QTest::newRow("100") << 100;
+    QTest::newRow("10000") << 10000;
+}
+
+void tst_Bench_CommandQueue::invokeMethod()
+{
+    QFETCH(int, requests);
+
+    Receiver receiver;
+    const QVariant value(42.0);
+    const QString indexRange;
+
+    QBENCHMARK {
+        for (int i = 0; i < requests; ++i) {
+            QMetaObject::invokeMethod(&receiver, "writeAttribute", Qt::QueuedConnection,
+                                      Q_ARG(quint64, i),
+                                      Q_ARG(QVariant, value),
+                                      Q_ARG(QString, indexRange));
+        }
+        QCoreApplication::sendPostedEvents(&receiver, QEvent::MetaCall);
+    }
+
+    QVERIFY(receiver.calls >= requests);
+}
+
+void tst_Bench_CommandQueue::commandQueue()
+{
+    QFETCH(int, requests);
+
+    Receiver receiver;
+    Receiver *target = &receiver;
+    const QVariant value(42.0);
+    const QString indexRange;
+
+    QBENCHMARK {
+        for (int i = 0; i < requests; ++i) {
+            const quint64 handle = i;
+            if (receiver.queue.push([target, handle, value, indexRange]() {
+                    target->writeAttribute(handle, value, indexRange);
+                })) {
+                QMetaObject::invokeMethod(&receiver, &Receiver::drain, Qt::QueuedConnection);
+            }
+        }
+        QCoreApplication::sendPostedEvents(&receiver, QEvent::MetaCall);
+    }
+
+    QVERIFY(receiver.calls >= requests);
+}
+
+// Producer and consumer on different threads, as between QOpen62541Client and its backend
+void tst_Bench_CommandQueue::commandQueueCrossThread()
+{
+    QFETCH(int, requests);
+
+    QThread thread;
+    Receiver receiver;
+    receiver.moveToThread(&thread);
+    thread.start();
+
+    Receiver *target = &receiver;
+    const QVariant value(42.0);
+    const QString indexRange;
+    QAtomicInt done;
+
+    QBENCHMARK {
+        done.storeRelaxed(0);
+        for (int i = 0; i < requests; ++i) {
+            const quint64 handle = i;
+            const bool last = i == requests - 1;
+            if (receiver.queue.push([target, handle, value, indexRange, last, &done]() {
+                    target->writeAttribute(handle, value, indexRange);
+                    if (last)
+                        done.storeRelease(1);
+                })) {
+                QMetaObject::invokeMethod(&receiver, &Receiver::drain, Qt::QueuedConnection);
+            }
+        }
+        while (!done.loadAcquire())
+            QThread::yieldCurrentThread();
+    }
+
+    thread.quit();
+    thread.wait();
+    QVERIFY(receiver.calls >= requests);
+}
+
+QTEST_GUILESS_MAIN(tst_Bench_CommandQueue)
+
+#include "tst_bench_commandqueue.moc"
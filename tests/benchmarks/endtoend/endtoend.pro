@@ -0,0 +1,8 @@
+TARGET = tst_bench_endtoend
+
+QT += testlib opcua network
+QT -= gui
+CONFIG += benchmark
+
+SOURCES += \
+    tst_bench_endtoend.cpp
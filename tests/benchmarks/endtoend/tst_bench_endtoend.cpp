@@ -0,0 +1,439 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/QOpcUaClient>
+#include <QtOpcUa/QOpcUaNode>
+#include <QtOpcUa/QOpcUaProvider>
+#include <QtOpcUa/QOpcUaPubSubReader>
+#include <QtOpcUa/QOpcUaReadItem>
+#include <QtOpcUa/QOpcUaTagTable>
+#include <QtOpcUa/QOpcUaWriteItem>
+
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QProcess>
+#include <QtCore/QScopedPointer>
+
+#include <QtNetwork/QTcpSocket>
+
+#include <QtTest/QSignalSpy>
+#include <QtTest/QtTest>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#ifdef Q_OS_LINUX
+#include <unistd.h>
+#endif
+
+/*
+    End-to-end measurements against the open62541 test server. The server is started
+    on localhost unless OPCUA_HOST or OPCUA_PORT point to a running server.
+
+    Results which can't be expressed using QBENCHMARK are reported using QTest::setBenchmarkResult(),
+    so all numbers are part of the machine-readable output, for example "-o results.xml,xml" or "-csv".
+*/
+
+static const int signalSpyTimeout = 10000;
+static const int notificationTimeout = 60000;
+static const QString readWriteNode = QStringLiteral("ns=3;s=TestNode.ReadWrite");
+static const QString monitoredNode = QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+static const QString largeFolderNode = QStringLiteral("ns=1;s=Large.Folder");
+static const quint16 pubSubPort = 43345;
+static const int pubSubRate = 10000; // DataSetMessages per second sent by the UADP publisher of the test server
+
+class tst_Bench_EndToEnd : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+    void cleanupTestCase();
+
+    void readThroughput_data() { batchSizes(); }
+    void readThroughput();
+    void writeThroughput_data() { batchSizes(); }
+    void writeThroughput();
+    void notificationThroughput_data();
+    void notificationThroughput();
+    void notificationLatency_data();
+    void notificationLatency();
+    void browseThroughput();
+    void memoryPerNode_data();
+    void memoryPerNode();
+    void pubSubThroughput();
+
+private:
+    struct NotificationResult {
+        qint64 deliveryTime = 0; // ms from the write until the last notification has arrived
+        QVector<qint64> latencies; // ms from the source timestamp until the arrival, sorted
+    };
+
+    void batchSizes();
+    bool measureNotifications(int itemCount, NotificationResult *result);
+
+    QProcess m_serverProcess;
+    QOpcUaProvider m_provider;
+    QScopedPointer<QOpcUaClient> m_client;
+    QHash<int, NotificationResult> m_notificationResults;
+    double m_writtenValue = 0;
+};
+
+void tst_Bench_EndToEnd::initTestCase()
+{
+    const quint16 defaultPort = 43344;
+    const QString defaultHost = QStringLiteral("localhost");
+
+    if (!QOpcUaProvider::availableBackends().contains(QLatin1String("open62541")))
+        QSKIP("The end-to-end benchmarks require the open62541 backend");
+
+    if (qEnvironmentVariableIsEmpty("OPCUA_HOST") && qEnvironmentVariableIsEmpty("OPCUA_PORT")) {
+        const QString serverPath = QCoreApplication::applicationDirPath()
+#if defined(Q_OS_MACOS)
+                + QLatin1String("/../../open62541-testserver/open62541-testserver.app/Contents/MacOS/open62541-testserver")
+#else
+#if defined(Q_OS_WIN) && !defined(TESTS_CMAKE_SPECIFIC_PATH)
+                + QLatin1String("/..")
+#endif
+                + QLatin1String("/../../open62541-testserver/open62541-testserver")
+#ifdef Q_OS_WIN
+                + QLatin1String(".exe")
+#endif
+#endif
+                ;
+        if (!QFile::exists(serverPath))
+            QSKIP("The end-to-end benchmarks rely on the open62541-based test server");
+
+        QTcpSocket socket;
+        socket.connectToHost(defaultHost, defaultPort);
+        QVERIFY2(!socket.waitForConnected(1500), "Server is already running");
+
+        m_serverProcess.start(serverPath, {QStringLiteral("--pubsub-url"), QStringLiteral("opc.udp://127.0.0.1:%1").arg(pubSubPort),
+                                           QStringLiteral("--pubsub-rate"), QString::number(pubSubRate)});
+        QVERIFY2(m_serverProcess.waitForStarted(), qPrintable(m_serverProcess.errorString()));
+
+        QTRY_VERIFY_WITH_TIMEOUT([&]() {
+            socket.connectToHost(defaultHost, defaultPort);
+            return socket.waitForConnected(100);
+        }(), signalSpyTimeout);
+        socket.disconnectFromHost();
+    }
+
+    const QString host = qEnvironmentVariableIsEmpty("OPCUA_HOST") ? defaultHost : qEnvironmentVariable("OPCUA_HOST");
+    const QString port = qEnvironmentVariableIsEmpty("OPCUA_PORT") ? QString::number(defaultPort) : qEnvironmentVariable("OPCUA_PORT");
+
+    m_client.reset(m_provider.createClient(QLatin1String("open62541")));
+    QVERIFY(m_client);
+
+    QSignalSpy endpointSpy(m_client.data(), &QOpcUaClient::endpointsRequestFinished);
+    QVERIFY(m_client->requestEndpoints(QUrl(QStringLiteral("opc.tcp://%1:%2").arg(host, port))));
+    QVERIFY(endpointSpy.wait(signalSpyTimeout));
+    const auto endpoints = endpointSpy.at(0).at(0).value<QVector<QOpcUaEndpointDescription>>();
+    QVERIFY(!endpoints.isEmpty());
+
+    m_client->connectToEndpoint(endpoints.first());
+    QTRY_COMPARE_WITH_TIMEOUT(m_client->state(), QOpcUaClient::Connected, signalSpyTimeout);
+}
+
+void tst_Bench_EndToEnd::cleanupTestCase()
+{
+    if (m_client && m_client->state() == QOpcUaClient::Connected) {
+        m_client->disconnectFromEndpoint();
+        QTRY_COMPARE_WITH_TIMEOUT(m_client->state(), QOpcUaClient::Disconnected, signalSpyTimeout);
+    }
+    m_client.reset();
+
+    if (m_serverProcess.state() == QProcess::Running) {
+        m_serverProcess.kill();
+        m_serverProcess.waitForFinished(2000);
+    }
+}
+
+void tst_Bench_EndToEnd::batchSizes()
+{
+    QTest::addColumn<int>("batchSize");
+
+    for (int batchSize : {1, 10, 100, 1000})
+        QTest::addRow("%d", batchSize) << batchSize;
+}
+
+void tst_Bench_EndToEnd::readThroughput()
+{
+    QFETCH(int, batchSize);
+
+    const QVector<QOpcUaReadItem> request(batchSize, QOpcUaReadItem(readWriteNode));
+    QSignalSpy readSpy(m_client.data(), &QOpcUaClient::readNodeAttributesFinished);
+
+    QBENCHMARK {
+        readSpy.clear();
+        QVERIFY(m_client->readNodeAttributes(request));
+        QVERIFY(readSpy.wait(signalSpyTimeout));
+    }
+
+    QCOMPARE(readSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+}
+
+void tst_Bench_EndToEnd::writeThroughput()
+{
+    QFETCH(int, batchSize);
+
+    const QVector<QOpcUaWriteItem> request(batchSize, QOpcUaWriteItem(readWriteNode, QOpcUa::NodeAttribute::Value,
+                                                                      1.0, QOpcUa::Types::Double));
+    QSignalSpy writeSpy(m_client.data(), &QOpcUaClient::writeNodeAttributesFinished);
+
+    QBENCHMARK {
+        writeSpy.clear();
+        QVERIFY(m_client->writeNodeAttributes(request));
+        QVERIFY(writeSpy.wait(signalSpyTimeout));
+    }
+
+    QCOMPARE(writeSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+}
+
+/*
+    Monitors the same node itemCount times using a tag table and writes a new value
+    with the current time as source timestamp. Every tag receives one notification.
+*/
+bool tst_Bench_EndToEnd::measureNotifications(int itemCount, NotificationResult *result)
+{
+    QOpcUaTagTable table;
+    table.reserve(itemCount);
+    for (int i = 0; i < itemCount; ++i)
+        table.addTag(monitoredNode);
+
+    QOpcUaMonitoringParameters parameters(0); // Revised to the fastest interval supported by the server
+    parameters.setSamplingInterval(0);
+    if (!m_client->enableMonitoring(table, parameters))
+        return false;
+
+    // Wait for the initial values
+    int pending = itemCount;
+    if (!QTest::qWaitFor([&]() { pending -= table.takeChangedTags().size(); return pending == 0; }, notificationTimeout))
+        return false;
+
+    QVector<qint64> arrivals(itemCount, 0);
+    pending = itemCount;
+    QElapsedTimer timer;
+
+    QOpcUaWriteItem write(monitoredNode, QOpcUa::NodeAttribute::Value, ++m_writtenValue, QOpcUa::Types::Double);
+    write.setSourceTimestamp(QDateTime::currentDateTimeUtc());
+    timer.start();
+    if (!m_client->writeNodeAttributes({write}))
+        return false;
+
+    const bool delivered = QTest::qWaitFor([&]() {
+        const auto changed = table.takeChangedTags();
+        if (changed.isEmpty())
+            return false;
+        const qint64 now = QDateTime::currentMSecsSinceEpoch();
+        for (int tag : changed)
+            arrivals[tag] = now;
+        pending -= changed.size();
+        return pending == 0;
+    }, notificationTimeout);
+
+    result->deliveryTime = timer.elapsed();
+
+    m_client->disableMonitoring(table);
+    // There is no signal for the removal, give the server some time to delete the monitored items
+    QTest::qWait(500);
+
+    if (!delivered)
+        return false;
+
+    result->latencies.resize(itemCount);
+    for (int i = 0; i < itemCount; ++i)
+        result->latencies[i] = arrivals.at(i) - table.sourceTimestamp(i).toMSecsSinceEpoch();
+    std::sort(result->latencies.begin(), result->latencies.end());
+    return true;
+}
+
+void tst_Bench_EndToEnd::notificationThroughput_data()
+{
+    QTest::addColumn<int>("itemCount");
+
+    for (int itemCount : {1000, 10000, 100000})
+        QTest::addRow("%d", itemCount) << itemCount;
+}
+
+// Reports the time needed to deliver one notification to each of the monitored items
+void tst_Bench_EndToEnd::notificationThroughput()
+{
+    QFETCH(int, itemCount);
+
+    NotificationResult result;
+    QVERIFY(measureNotifications(itemCount, &result));
+    m_notificationResults.insert(itemCount, result);
+
+    QTest::setBenchmarkResult(result.deliveryTime, QTest::WalltimeMilliseconds);
+}
+
+void tst_Bench_EndToEnd::notificationLatency_data()
+{
+    QTest::addColumn<int>("itemCount");
+    QTest::addColumn<int>("percentile");
+
+    for (int itemCount : {1000, 10000, 100000}) {
+        for (int percentile : {50, 90, 99, 100})
+            QTest::addRow("%d p%d", itemCount, percentile) << itemCount << percentile;
+    }
+}
+
+// Reports the percentiles of the time from the source timestamp to the arrival in the tag table
+void tst_Bench_EndToEnd::notificationLatency()
+{
+    QFETCH(int, itemCount);
+    QFETCH(int, percentile);
+
+    // The measurement is shared with notificationThroughput() and all rows of the same item count
+    if (!m_notificationResults.contains(itemCount)) {
+        NotificationResult result;
+        QVERIFY(measureNotifications(itemCount, &result));
+        m_notificationResults.insert(itemCount, result);
+    }
+
+    const QVector<qint64> &latencies = m_notificationResults[itemCount].latencies;
+    const int index = qMin(latencies.size() - 1, latencies.size() * percentile / 100);
+    QTest::setBenchmarkResult(latencies.at(index), QTest::WalltimeMilliseconds);
+}
+
+void tst_Bench_EndToEnd::browseThroughput()
+{
+    QScopedPointer<QOpcUaNode> node(m_client->node(largeFolderNode));
+    QVERIFY(node);
+
+    QSignalSpy browseSpy(node.data(), &QOpcUaNode::browseFinished);
+
+    QBENCHMARK {
+        browseSpy.clear();
+        QVERIFY(node->browseChildren());
+        QVERIFY(browseSpy.wait(signalSpyTimeout));
+    }
+
+    QCOMPARE(browseSpy.at(0).at(1).value<QOpcUa::UaStatusCode>(), QOpcUa::UaStatusCode::Good);
+    QCOMPARE(browseSpy.at(0).at(0).value<QVector<QOpcUaReferenceDescription>>().size(), 100);
+}
+
+void tst_Bench_EndToEnd::memoryPerNode_data()
+{
+    QTest::addColumn<int>("nodeCount");
+
+    for (int nodeCount : {1000, 10000, 100000})
+        QTest::addRow("%d", nodeCount) << nodeCount;
+}
+
+#ifdef Q_OS_LINUX
+static qint64 residentSetSize()
+{
+    QFile statm(QStringLiteral("/proc/self/statm"));
+    if (!statm.open(QFile::ReadOnly))
+        return -1;
+    const QList<QByteArray> fields = statm.readAll().split(' ');
+    if (fields.size() < 2)
+        return -1;
+    return fields.at(1).toLongLong() * sysconf(_SC_PAGESIZE);
+}
+#endif
+
+// Reports the increase of the resident set size per QOpcUaNode, which includes the backend side
+void tst_Bench_EndToEnd::memoryPerNode()
+{
+#ifdef Q_OS_LINUX
+    QFETCH(int, nodeCount);
+
+    std::vector<std::unique_ptr<QOpcUaNode>> nodes;
+    nodes.reserve(nodeCount);
+
+    const qint64 before = residentSetSize();
+    QVERIFY(before > 0);
+
+    for (int i = 0; i < nodeCount; ++i) {
+        nodes.emplace_back(m_client->node(QStringLiteral("ns=2;s=Benchmark.Node.%1").arg(i)));
+        QVERIFY(nodes.back());
+    }
+    // Let the backend process the registration of the nodes
+    QCoreApplication::processEvents();
+
+    const qint64 after = residentSetSize();
+    QTest::setBenchmarkResult(qreal(after - before) / nodeCount, QTest::BytesAllocated);
+#else
+    QSKIP("Measuring the memory usage is only supported on Linux");
+#endif
+}
+
+// Reports the number of DataSetMessages per second decoded from the UADP publisher of the test server
+void tst_Bench_EndToEnd::pubSubThroughput()
+{
+    if (m_serverProcess.state() != QProcess::Running)
+        QSKIP("The PubSub benchmark requires the test server started by the benchmark");
+
+    QOpcUaPubSubReader reader;
+    reader.setWriterGroupId(100);
+    reader.setFieldNames({QStringLiteral("Counter"), QStringLiteral("Sine"), QStringLiteral("Flag"), QStringLiteral("Name")});
+
+    quint64 received = 0;
+    quint32 firstCounter = 0;
+    quint32 lastCounter = 0;
+    QObject::connect(&reader, &QOpcUaPubSubReader::dataSetsReceived, [&](const QOpcUaDataSetBatch &dataSets) {
+        const QVector<quint32> counters = dataSets.typedField<quint32>(0);
+        if (counters.isEmpty())
+            return;
+        if (!received)
+            firstCounter = counters.constFirst();
+        lastCounter = counters.constLast();
+        received += counters.size();
+    });
+
+    QVERIFY(reader.bind(QUrl(QStringLiteral("opc.udp://127.0.0.1:%1").arg(pubSubPort))));
+
+    QElapsedTimer timer;
+    timer.start();
+    QTest::qWait(2000);
+    const qint64 elapsed = timer.elapsed();
+    reader.close();
+
+    QVERIFY(received > 0);
+    QCOMPARE(reader.droppedMessageCount(), quint64(0));
+    // The Counter field increases by one per DataSetMessage, a gap is a lost datagram
+    QCOMPARE(received, quint64(lastCounter - firstCounter) + 1);
+    QTest::setBenchmarkResult(received * 1000.0 / elapsed, QTest::Events);
+}
+
+QTEST_GUILESS_MAIN(tst_Bench_EndToEnd)
+
+#include "tst_bench_endtoend.moc"
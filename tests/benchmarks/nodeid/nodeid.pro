@@ -0,0 +1,8 @@
+TARGET = tst_bench_nodeid
+
+QT += testlib opcua-private
+QT -= gui
+CONFIG += benchmark
+
+SOURCES += \
+    tst_bench_nodeid.cpp
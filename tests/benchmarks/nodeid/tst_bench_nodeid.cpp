@@ -0,0 +1,154 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include <QtOpcUa/qopcuatype.h>
+#include <private/qopcuatype_p.h>
+
+#include <QtCore/QRegularExpression>
+#include <QtCore/QStringList>
+
+#include <QtTest/QtTest>
+
+#include <limits>
+
+// The regular expression based implementation used before the parser was rewritten, kept as reference
+static bool legacyNodeIdStringSplit(const QString &nodeIdString, quint16 *nsIndex, QString *identifier, char *identifierType)
+{
+    quint16 namespaceIndex = 0;
+
+    QStringList components = nodeIdString.split(QLatin1String(";"));
+
+    if (components.size() > 2)
+        return false;
+
+    if (components.size() == 2 && components.at(0).contains(QRegularExpression(QLatin1String("^ns=[0-9]+")))) {
+        bool success = false;
+        uint ns = QStringView(components.at(0)).mid(3).toUInt(&success);
+        if (!success || ns > (std::numeric_limits<quint16>::max)())
+            return false;
+        namespaceIndex = ns;
+    }
+
+    if (components.last().size() < 3)
+        return false;
+
+    if (!components.last().contains(QRegularExpression(QLatin1String("^[isgb]="))))
+        return false;
+
+    if (nsIndex)
+        *nsIndex = namespaceIndex;
+    if (identifier)
+        *identifier = QStringView(components.last()).mid(2).toString();
+    if (identifierType)
+        *identifierType = components.last().at(0).toLatin1();
+
+    return true;
+}
+
+class tst_Bench_NodeId : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void legacySplit_data() { nodeIds(); }
+    void legacySplit();
+    void split_data() { nodeIds(); }
+    void split();
+    void splitView_data() { nodeIds(); }
+    void splitView();
+
+private:
+    void nodeIds();
+};
+
+void tst_Bench_NodeId::nodeIds()
+{
+    QTest::addColumn<QString>("nodeId");
+
+    QTest::newRow("numeric") << QStringLiteral("ns=0;i=2255");
+    QTest::newRow("string") << QStringLiteral("ns=2;s=Demo.Static.Scalar.Double");
+    QTest::newRow("guid") << QStringLiteral("ns=3;g=08081e75-8e5e-319b-954f-f3a7613dc29b");
+    QTest::newRow("opaque") << QStringLiteral("ns=3;b=UXQgZnR3IQ==");
+}
+
+void tst_Bench_NodeId::legacySplit()
+{
+    QFETCH(QString, nodeId);
+
+    quint16 namespaceIndex = 0;
+    QString identifier;
+    char identifierType = 0;
+
+    QBENCHMARK {
+        legacyNodeIdStringSplit(nodeId, &namespaceIndex, &identifier, &identifierType);
+    }
+
+    QVERIFY(!identifier.isEmpty());
+}
+
+void tst_Bench_NodeId::split()
+{
+    QFETCH(QString, nodeId);
+
+    quint16 namespaceIndex = 0;
+    QString identifier;
+    char identifierType = 0;
+
+    QBENCHMARK {
+        QOpcUa::nodeIdStringSplit(nodeId, &namespaceIndex, &identifier, &identifierType);
+    }
+
+    QVERIFY(!identifier.isEmpty());
+}
+
+void tst_Bench_NodeId::splitView()
+{
+    QFETCH(QString, nodeId);
+
+    quint16 namespaceIndex = 0;
+    QStringView identifier;
+    char identifierType = 0;
+
+    QBENCHMARK {
+        qt_splitNodeIdString(nodeId, &namespaceIndex, &identifier, &identifierType);
+    }
+
+    QVERIFY(!identifier.isEmpty());
+}
+
+QTEST_APPLESS_MAIN(tst_Bench_NodeId)
+
+#include "tst_bench_nodeid.moc"
@@ -0,0 +1,18 @@
+# Links a test against the static open62541helpers library
+INCLUDEPATH += \
+    $$PWD/../../../src/plugins/opcua/open62541 \
+    $$PWD/../../../src/3rdparty/open62541
+
+HELPERS_DIR = $$OUT_PWD/../../common/open62541helpers
+win32:CONFIG(debug, debug|release): HELPERS_DIR = $$HELPERS_DIR/debug
+else:win32: HELPERS_DIR = $$HELPERS_DIR/release
+
+LIBS += -L$$HELPERS_DIR -lopen62541helpers
+PRE_TARGETDEPS += $$HELPERS_DIR/$${QMAKE_PREFIX_STATICLIB}open62541helpers.$${QMAKE_EXTENSION_STATICLIB}
+
+qtConfig(open62541):!qtConfig(system-open62541) {
+    win32-msvc: LIBS += ws2_32.lib
+    win32-g++: LIBS += -lws2_32
+} else {
+    QMAKE_USE_PRIVATE += open62541
+}
@@ -0,0 +1,21 @@
+# The value converter and node id utilities of the open62541 plugin, built once as a static
+# library for tests which exercise them without loading the plugin.
+TEMPLATE = lib
+TARGET = open62541helpers
+CONFIG += staticlib
+
+QT += opcua-private
+QT -= gui
+
+INCLUDEPATH += $$PWD/../../../src/plugins/opcua/open62541
+
+qtConfig(open62541):!qtConfig(system-open62541) {
+    include($$PWD/../../../src/3rdparty/open62541.pri)
+} else {
+    QMAKE_USE_PRIVATE += open62541
+}
+
+SOURCES += \
+    open62541helpers.cpp \
+    $$PWD/../../../src/plugins/opcua/open62541/qopen62541utils.cpp \
+    $$PWD/../../../src/plugins/opcua/open62541/qopen62541valueconverter.cpp
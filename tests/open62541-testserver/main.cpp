@@ -35,8 +35,10 @@
 ****************************************************************************/
 
 #include "testserver.h"
+#include "uadppublisher.h"
 #include "qopen62541utils.h"
 
+#include <QtCore/QCommandLineParser>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QDebug>
 #include <QtCore/QThread>
@@ -60,11 +62,82 @@ int main(int argc, char **argv)
 {
     QCoreApplication app(argc, argv);
 
+    QCommandLineParser parser;
+    parser.setApplicationDescription(QStringLiteral("open62541 based OPC UA server for the QtOpcUa tests"));
+    parser.addHelpOption();
+    const QCommandLineOption variablesOption(QStringLiteral("simulation-variables"),
+                                             QStringLiteral("Number of simulated variables, 0 disables the simulation."),
+                                             QStringLiteral("count"), QStringLiteral("0"));
+    const QCommandLineOption namespacesOption(QStringLiteral("simulation-namespaces"),
+                                              QStringLiteral("Number of namespaces the simulated variables are spread across."),
+                                              QStringLiteral("count"), QStringLiteral("1"));
+    const QCommandLineOption ratesOption(QStringLiteral("simulation-rates"),
+                                         QStringLiteral("Comma separated change rates in Hz, assigned to the variables in turn."),
+                                         QStringLiteral("rates"), QStringLiteral("10"));
+    const QCommandLineOption distributionOption(QStringLiteral("simulation-distribution"),
+                                                QStringLiteral("Values of the simulated variables: sine, ramp or random."),
+                                                QStringLiteral("distribution"), QStringLiteral("sine"));
+    const QCommandLineOption arraySizeOption(QStringLiteral("simulation-array-size"),
+                                             QStringLiteral("Number of elements of the simulated array variables."),
+                                             QStringLiteral("size"), QStringLiteral("16"));
+    const QCommandLineOption pubSubUrlOption(QStringLiteral("pubsub-url"),
+                                             QStringLiteral("opc.udp URL the UADP publisher sends to, the publisher is disabled if not set."),
+                                             QStringLiteral("url"));
+    const QCommandLineOption pubSubRateOption(QStringLiteral("pubsub-rate"),
+                                              QStringLiteral("Number of DataSetMessages published per second."),
+                                              QStringLiteral("rate"), QStringLiteral("1000"));
+    const QCommandLineOption pubSubEncodingOption(QStringLiteral("pubsub-encoding"),
+                                                  QStringLiteral("Field encoding of the published DataSet: variant or raw."),
+                                                  QStringLiteral("encoding"), QStringLiteral("variant"));
+    const QCommandLineOption portOption(QStringLiteral("port"),
+                                        QStringLiteral("TCP port of the server."),
+                                        QStringLiteral("port"), QStringLiteral("43344"));
+    const QCommandLineOption maxNodesPerReadOption(QStringLiteral("max-nodes-per-read"),
+                                                   QStringLiteral("Maximum number of nodes in a Read request, 0 means no limit."),
+                                                   QStringLiteral("count"), QStringLiteral("0"));
+    const QCommandLineOption maxNodesPerWriteOption(QStringLiteral("max-nodes-per-write"),
+                                                    QStringLiteral("Maximum number of nodes in a Write request, 0 means no limit."),
+                                                    QStringLiteral("count"), QStringLiteral("0"));
+    parser.addOptions({variablesOption, namespacesOption, ratesOption, distributionOption, arraySizeOption,
+                       pubSubUrlOption, pubSubRateOption, pubSubEncodingOption,
+                       portOption, maxNodesPerReadOption, maxNodesPerWriteOption});
+    parser.process(app);
+
+    TestServer::SimulationSettings simulation;
+    simulation.variableCount = parser.value(variablesOption).toInt();
+    simulation.namespaceCount = parser.value(namespacesOption).toInt();
+    simulation.arraySize = parser.value(arraySizeOption).toInt();
+    simulation.rates.clear();
+    for (const QString &rate : parser.value(ratesOption).split(QLatin1Char(',')))
+        simulation.rates.push_back(rate.toDouble());
+
+    const QString distribution = parser.value(distributionOption);
+    if (distribution == QLatin1String("sine")) {
+        simulation.distribution = TestServer::SimulationSettings::Distribution::Sine;
+    } else if (distribution == QLatin1String("ramp")) {
+        simulation.distribution = TestServer::SimulationSettings::Distribution::Ramp;
+    } else if (distribution == QLatin1String("random")) {
+        simulation.distribution = TestServer::SimulationSettings::Distribution::Random;
+    } else {
+        qCritical() << "Unknown simulation distribution:" << distribution;
+        return -1;
+    }
+
+    UadpPublisher::Encoding pubSubEncoding = UadpPublisher::Encoding::Variant;
+    const QString encoding = parser.value(pubSubEncodingOption);
+    if (encoding == QLatin1String("raw")) {
+        pubSubEncoding = UadpPublisher::Encoding::RawData;
+    } else if (encoding != QLatin1String("variant")) {
+        qCritical() << "Unknown PubSub encoding:" << encoding;
+        return -1;
+    }
+
     TestServer server;
-    if (!server.init()) {
+    if (!server.init(parser.value(portOption).toUShort())) {
         qCritical() << "Could not initialize server.";
         return -1;
     }
+    server.setOperationLimits(parser.value(maxNodesPerReadOption).toUInt(), parser.value(maxNodesPerWriteOption).toUInt());
 
     server.launch();
 
@@ -238,5 +311,26 @@ int main(int argc, char **argv)
 
     server.addVariableWithWriteMask(testFolder, "ns=3;s=Demo.Static.Scalar.FullyWritable", "FullyWritableTest", 1.0, QOpcUa::Types::Double, fullWritableMask);
 
+#ifdef UA_ENABLE_HISTORIZING
+    server.addHistorizedVariable(testFolder, "ns=2;s=Demo.Static.Scalar.HistorizedDouble", "HistorizedDoubleTest");
+#endif
+
+    // The simulated variables are added last, the namespace indexes of the test nodes must not change
+    if (simulation.variableCount > 0) {
+        if (!server.startSimulation(simulation)) {
+            qCritical() << "Could not start the simulation.";
+            return -1;
+        }
+    }
+
+    UadpPublisher publisher;
+    if (parser.isSet(pubSubUrlOption)) {
+        const QUrl pubSubUrl(parser.value(pubSubUrlOption));
+        if (!publisher.start(pubSubUrl, parser.value(pubSubRateOption).toDouble(), pubSubEncoding)) {
+            qCritical() << "Could not start the UADP publisher.";
+            return -1;
+        }
+    }
+
     return app.exec();
 }
@@ -29,12 +29,14 @@ QMAKE_CFLAGS_RELEASE_WITH_DEBUGINFO -= -O2
 SOURCES += \
            main.cpp \
            testserver.cpp \
+           uadppublisher.cpp \
            $$PWD/../../src/plugins/opcua/open62541/qopen62541utils.cpp \
            $$PWD/../../src/plugins/opcua/open62541/qopen62541valueconverter.cpp
 
 
 HEADERS += \
-           testserver.h
+           testserver.h \
+           uadppublisher.h
 
 RESOURCES += certs.qrc
 
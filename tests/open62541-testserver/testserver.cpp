@@ -37,10 +37,12 @@
 #include "testserver.h"
 #include "qopen62541utils.h"
 #include "qopen62541valueconverter.h"
+#include <QtOpcUa/qopcuarange.h>
 #include <QtOpcUa/qopcuatype.h>
 
 #include <QtCore/QDebug>
 #include <QtCore/QLoggingCategory>
+#include <QtCore/QtMath>
 #include <QDir>
 #include <QFile>
 
@@ -55,8 +57,6 @@ static UA_UsernamePasswordLogin usernamePasswords[2] = {
     {UA_STRING_STATIC("user2"), UA_STRING_STATIC("password1")}};
 #endif
 
-const UA_UInt16 portNumber = 43344;
-
 // Node ID conversion is included from the open62541 plugin but warnings from there should be logged
 // using qt.opcua.testserver instead of qt.opcua.plugins.open62541 for usage in the test server
 Q_LOGGING_CATEGORY(QT_OPCUA_PLUGINS_OPEN62541, "qt.opcua.testserver")
@@ -71,13 +71,14 @@ TestServer::TestServer(QObject *parent) : QObject(parent)
 
 TestServer::~TestServer()
 {
+    stopSimulation();
     shutdown();
     UA_Server_delete(m_server);
 }
 
 bool TestServer::createInsecureServerConfig(UA_ServerConfig *config)
 {
-    UA_StatusCode result = UA_ServerConfig_setMinimal(config, portNumber, nullptr);
+    UA_StatusCode result = UA_ServerConfig_setMinimal(config, m_port, nullptr);
 
     if (result != UA_STATUSCODE_GOOD) {
         qWarning() << "Failed to create server config without encryption";
@@ -184,7 +185,7 @@ bool TestServer::createSecureServerConfig(UA_ServerConfig *config)
     // They will be used by the server.
     trustListDeleter.release();
 
-    result = UA_ServerConfig_addNetworkLayerTCP(config, portNumber, 0, 0);
+    result = UA_ServerConfig_addNetworkLayerTCP(config, m_port, 0, 0);
 
     if (result != UA_STATUSCODE_GOOD) {
         qWarning() << "Failed to add network layer";
@@ -223,10 +224,11 @@ bool TestServer::createSecureServerConfig(UA_ServerConfig *config)
 }
 #endif
 
-bool TestServer::init()
+bool TestServer::init(UA_UInt16 port)
 {
     bool success;
 
+    m_port = port;
     m_server = UA_Server_new();
 
     if (!m_server)
@@ -244,9 +246,36 @@ bool TestServer::init()
     if (!success || !m_config)
         return false;
 
+#ifdef UA_ENABLE_HISTORIZING
+    // Values written to historized variables are kept in memory for HistoryRead requests
+    m_historyGathering = UA_HistoryDataGathering_Default(1);
+    m_config->historyDatabase = UA_HistoryDatabase_default(m_historyGathering);
+#endif
+
     return true;
 }
 
+/*
+    Limits the number of nodes per Read and Write request, larger requests fail with BadTooManyOperations.
+    The limits are exposed in the OperationLimits object of the server, 0 means no limit.
+*/
+void TestServer::setOperationLimits(quint32 maxNodesPerRead, quint32 maxNodesPerWrite)
+{
+    m_config->maxNodesPerRead = maxNodesPerRead;
+    m_config->maxNodesPerWrite = maxNodesPerWrite;
+
+    // Namespace 0 has been populated with the limits of the config when the server was created
+    const QVector<QPair<UA_UInt32, UA_UInt32>> limits = {
+        {UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERREAD, maxNodesPerRead},
+        {UA_NS0ID_SERVER_SERVERCAPABILITIES_OPERATIONLIMITS_MAXNODESPERWRITE, maxNodesPerWrite}
+    };
+    for (const auto &limit : limits) {
+        UA_Variant value;
+        UA_Variant_setScalar(&value, const_cast<UA_UInt32 *>(&limit.second), &UA_TYPES[UA_TYPES_UINT32]);
+        UA_Server_writeValue(m_server, UA_NODEID_NUMERIC(0, limit.first), value);
+    }
+}
+
 void TestServer::launch()
 {
     UA_StatusCode s = UA_Server_run_startup(m_server);
@@ -760,4 +789,223 @@ UA_NodeId TestServer::addNodeWithFixedTimestamp(const UA_NodeId &folder, const Q
     return resultId;
 }
 
+#ifdef UA_ENABLE_HISTORIZING
+UA_NodeId TestServer::addHistorizedVariable(const UA_NodeId &folder, const QString &variableNode, const QString &name)
+{
+    UA_NodeId resultId = addVariable(folder, variableNode, name, 0.0, QOpcUa::Types::Double);
+    if (UA_NodeId_isNull(&resultId))
+        return resultId;
+
+    UA_Server_writeAccessLevel(m_server, resultId, UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE | UA_ACCESSLEVELMASK_HISTORYREAD);
+    UA_Server_writeHistorizing(m_server, resultId, true);
+
+    UA_HistorizingNodeIdSettings setting;
+    std::memset(&setting, 0, sizeof(setting));
+    setting.historizingBackend = UA_HistoryDataBackend_Memory(1, 1000);
+    // Small responses make the server return continuation points for longer histories
+    setting.maxHistoryDataResponseSize = 10;
+    setting.historizingUpdateStrategy = UA_HISTORIZINGUPDATESTRATEGY_VALUESET;
+
+    const UA_StatusCode result = m_historyGathering.registerNodeId(m_server, m_historyGathering.context, &resultId, setting);
+    if (result != UA_STATUSCODE_GOOD)
+        qWarning() << "Could not enable historizing:" << result << "for node" << variableNode;
+
+    return resultId;
+}
+#endif
+
+/*
+    Creates settings.variableCount variables spread over settings.namespaceCount namespaces.
+    The variables are scalar doubles, scalar int32, double arrays and Range structures in turn.
+    They are named ns=<namespace>;s=Simulation.<Type>.<index> and are organized in a
+    Simulation folder in each namespace.
+
+    The values are written by one repeated server callback per change rate,
+    using the current time as source timestamp.
+*/
+bool TestServer::startSimulation(const SimulationSettings &settings)
+{
+    if (!m_simulationGroups.empty() || settings.variableCount <= 0 || settings.namespaceCount <= 0
+            || settings.rates.isEmpty() || settings.arraySize <= 0) {
+        qWarning() << "Invalid simulation settings";
+        return false;
+    }
+    for (double rate : settings.rates) {
+        if (rate <= 0) {
+            qWarning() << "Invalid simulation rate" << rate;
+            return false;
+        }
+    }
+
+    m_simulationSettings = settings;
+    m_simulationArray.resize(settings.arraySize);
+    m_random.seed(1); // Random values are reproducible between runs
+
+    QVector<int> namespaces;
+    QVector<UA_NodeId> folders;
+    for (int i = 0; i < settings.namespaceCount; ++i) {
+        const int ns = registerNamespace(QStringLiteral("http://qt-project.org/Simulation/%1").arg(i));
+        namespaces.push_back(ns);
+        folders.push_back(addFolder(QStringLiteral("ns=%1;s=Simulation").arg(ns), QStringLiteral("Simulation")));
+    }
+
+    for (double rate : settings.rates) {
+        std::unique_ptr<SimulationGroup> group(new SimulationGroup);
+        group->server = this;
+        group->interval = 1000.0 / rate;
+        m_simulationGroups.push_back(std::move(group));
+    }
+
+    QVariantList initialArray;
+    for (int i = 0; i < settings.arraySize; ++i)
+        initialArray.push_back(0.0);
+
+    const auto deleteFolders = [&folders]() {
+        for (auto &folder : folders)
+            UA_NodeId_deleteMembers(&folder);
+    };
+
+    for (int i = 0; i < settings.variableCount; ++i) {
+        const int namespaceIndex = i % settings.namespaceCount;
+        const SimulatedType type = static_cast<SimulatedType>(i % 4);
+
+        QString name;
+        QVariant initialValue;
+        QOpcUa::Types uaType = QOpcUa::Types::Double;
+        switch (type) {
+        case SimulatedType::Double:
+            name = QStringLiteral("Double");
+            initialValue = 0.0;
+            break;
+        case SimulatedType::Int32:
+            name = QStringLiteral("Int32");
+            initialValue = 0;
+            uaType = QOpcUa::Types::Int32;
+            break;
+        case SimulatedType::DoubleArray:
+            name = QStringLiteral("DoubleArray");
+            initialValue = initialArray;
+            break;
+        case SimulatedType::Range:
+            name = QStringLiteral("Range");
+            initialValue = QVariant::fromValue(QOpcUaRange());
+            uaType = QOpcUa::Types::Range;
+            break;
+        }
+        name += QLatin1Char('.') + QString::number(i);
+
+        const UA_NodeId nodeId = addVariable(folders.at(namespaceIndex),
+                                             QStringLiteral("ns=%1;s=Simulation.%2").arg(namespaces.at(namespaceIndex)).arg(name),
+                                             name, initialValue, uaType);
+        if (UA_NodeId_isNull(&nodeId)) {
+            deleteFolders();
+            stopSimulation();
+            return false;
+        }
+
+        m_simulationGroups.at(i % m_simulationGroups.size())->variables.push_back({nodeId, type, i});
+    }
+
+    deleteFolders();
+
+    for (const auto &group : m_simulationGroups) {
+        const UA_StatusCode result = UA_Server_addRepeatedCallback(m_server, &TestServer::simulationCallback, group.get(),
+                                                                   group->interval, &group->callbackId);
+        if (result != UA_STATUSCODE_GOOD) {
+            qWarning() << "Could not add simulation callback:" << result;
+            stopSimulation();
+            return false;
+        }
+    }
+
+    // UA_Server_run_iterate() waits until the next callback is due, the timer only needs to restart it
+    m_timer.setInterval(0);
+
+    return true;
+}
+
+void TestServer::stopSimulation()
+{
+    for (const auto &group : m_simulationGroups) {
+        if (group->callbackId)
+            UA_Server_removeRepeatedCallback(m_server, group->callbackId);
+        for (auto &variable : group->variables)
+            UA_NodeId_deleteMembers(&variable.nodeId);
+    }
+    m_simulationGroups.clear();
+    m_timer.setInterval(30);
+}
+
+void TestServer::simulationCallback(UA_Server *server, void *data)
+{
+    Q_UNUSED(server);
+    auto group = static_cast<SimulationGroup *>(data);
+    group->server->updateSimulationGroup(group);
+}
+
+double TestServer::simulatedValue(const SimulationGroup *group, int index)
+{
+    switch (m_simulationSettings.distribution) {
+    case SimulationSettings::Distribution::Sine: {
+        // A period of ten seconds, the variables are phase shifted against each other
+        const double seconds = group->tick * group->interval / 1000.0;
+        return 100.0 * qSin(2 * M_PI * (seconds / 10.0 + index / 1000.0));
+    }
+    case SimulationSettings::Distribution::Ramp:
+        return double((group->tick + index) % 1000);
+    case SimulationSettings::Distribution::Random:
+        return m_random.bounded(100.0);
+    }
+    return 0;
+}
+
+void TestServer::updateSimulationGroup(SimulationGroup *group)
+{
+    ++group->tick;
+
+    UA_WriteValue writeValue;
+    UA_WriteValue_init(&writeValue);
+    writeValue.attributeId = UA_ATTRIBUTEID_VALUE;
+    writeValue.value.hasValue = true;
+    writeValue.value.hasSourceTimestamp = true;
+    writeValue.value.sourceTimestamp = UA_DateTime_now();
+
+    bool failed = false;
+
+    for (const auto &variable : qAsConst(group->variables)) {
+        double value = simulatedValue(group, variable.index);
+
+        // The variant only references the values, UA_Server_write() copies them
+        UA_Int32 intValue;
+        UA_Range rangeValue;
+        UA_Variant &variant = writeValue.value.value;
+        switch (variable.type) {
+        case SimulatedType::Double:
+            UA_Variant_setScalar(&variant, &value, &UA_TYPES[UA_TYPES_DOUBLE]);
+            break;
+        case SimulatedType::Int32:
+            intValue = qRound(value);
+            UA_Variant_setScalar(&variant, &intValue, &UA_TYPES[UA_TYPES_INT32]);
+            break;
+        case SimulatedType::DoubleArray:
+            for (int i = 0; i < m_simulationArray.size(); ++i)
+                m_simulationArray[i] = value + i;
+            UA_Variant_setArray(&variant, m_simulationArray.data(), m_simulationArray.size(), &UA_TYPES[UA_TYPES_DOUBLE]);
+            break;
+        case SimulatedType::Range:
+            rangeValue.low = value - 1;
+            rangeValue.high = value + 1;
+            UA_Variant_setScalar(&variant, &rangeValue, &UA_TYPES[UA_TYPES_RANGE]);
+            break;
+        }
+
+        writeValue.nodeId = variable.nodeId;
+        const UA_StatusCode result = UA_Server_write(m_server, &writeValue);
+        if (result != UA_STATUSCODE_GOOD && !failed) {
+            qWarning() << "Could not update simulated variable" << Open62541Utils::nodeIdToQString(variable.nodeId) << result;
+            failed = true;
+        }
+    }
+}
+
 QT_END_NAMESPACE
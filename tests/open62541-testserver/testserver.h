@@ -42,19 +42,39 @@
 
 #include <QtCore/QDateTime>
 #include <QtCore/QObject>
+#include <QtCore/QRandomGenerator>
 #include <QtCore/QTimer>
 #include <QtCore/QVariant>
 #include <QtCore/QVector>
 
+#include <memory>
+#include <vector>
+
 QT_BEGIN_NAMESPACE
 
 class TestServer : public QObject
 {
     Q_OBJECT
 public:
+    // Generated variables which are updated cyclically to put load on clients
+    struct SimulationSettings {
+        enum class Distribution {
+            Sine,
+            Ramp,
+            Random
+        };
+
+        int variableCount = 0;
+        int namespaceCount = 1;
+        QVector<double> rates {10}; // Change rates in Hz, assigned to the variables in turn
+        Distribution distribution = Distribution::Sine;
+        int arraySize = 16;
+    };
+
     explicit TestServer(QObject *parent = nullptr);
     ~TestServer();
-    bool init();
+    bool init(UA_UInt16 port = 43344);
+    void setOperationLimits(quint32 maxNodesPerRead, quint32 maxNodesPerWrite);
     bool createInsecureServerConfig(UA_ServerConfig *config);
 #if defined UA_ENABLE_ENCRYPTION
     bool createSecureServerConfig(UA_ServerConfig *config);
@@ -74,6 +94,12 @@ public:
     UA_NodeId addMultipleOutputArgumentsMethod(const UA_NodeId &folder, const QString &variableNode, const QString &description);
     UA_NodeId addAddNamespaceMethod(const UA_NodeId &folder, const QString &variableNode, const QString &description);
     UA_NodeId addNodeWithFixedTimestamp(const UA_NodeId &folder, const QString &nodeId, const QString &displayName);
+#ifdef UA_ENABLE_HISTORIZING
+    UA_NodeId addHistorizedVariable(const UA_NodeId &folder, const QString &variableNode, const QString &name);
+#endif
+
+    bool startSimulation(const SimulationSettings &settings);
+    void stopSimulation();
 
     static UA_StatusCode multiplyMethod(UA_Server *server, const UA_NodeId *sessionId, void *sessionHandle,
                                             const UA_NodeId *methodId, void *methodContext,
@@ -95,6 +121,10 @@ public:
 
     UA_ServerConfig *m_config{nullptr};
     UA_Server *m_server{nullptr};
+    UA_UInt16 m_port{43344};
+#ifdef UA_ENABLE_HISTORIZING
+    UA_HistoryDataGathering m_historyGathering;
+#endif
     QAtomicInt m_running{false};
     QTimer m_timer;
 
@@ -102,6 +132,38 @@ public slots:
     void launch();
     void processServerEvents();
     void shutdown();
+
+private:
+    enum class SimulatedType {
+        Double,
+        Int32,
+        DoubleArray,
+        Range
+    };
+
+    struct SimulatedVariable {
+        UA_NodeId nodeId;
+        SimulatedType type;
+        int index;
+    };
+
+    // All variables with the same change rate are updated by one repeated server callback
+    struct SimulationGroup {
+        TestServer *server;
+        double interval; // ms
+        quint64 tick = 0;
+        UA_UInt64 callbackId = 0;
+        QVector<SimulatedVariable> variables;
+    };
+
+    static void simulationCallback(UA_Server *server, void *data);
+    void updateSimulationGroup(SimulationGroup *group);
+    double simulatedValue(const SimulationGroup *group, int index);
+
+    SimulationSettings m_simulationSettings;
+    std::vector<std::unique_ptr<SimulationGroup>> m_simulationGroups;
+    QVector<double> m_simulationArray;
+    QRandomGenerator m_random;
 };
 
 QT_END_NAMESPACE
@@ -0,0 +1,189 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#include "uadppublisher.h"
+
+#include <QtOpcUa/QOpcUaBinaryDataEncoding>
+
+#include <QtCore/QDateTime>
+#include <QtCore/QDebug>
+#include <QtCore/QtMath>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+// Builtin type ids, OPC-UA part 6, 5.1.2
+constexpr quint8 BooleanId = 1;
+constexpr quint8 UInt32Id = 7;
+constexpr quint8 DoubleId = 11;
+constexpr quint8 StringId = 12;
+
+constexpr quint8 UadpVersion = 1;
+constexpr quint8 PublisherIdEnabled = 0x10;
+constexpr quint8 GroupHeaderEnabled = 0x20;
+constexpr quint8 PayloadHeaderEnabled = 0x40;
+constexpr quint8 ExtendedFlags1Enabled = 0x80;
+constexpr quint8 PublisherIdTypeUInt16 = 0x01;
+constexpr quint8 TimestampEnabled = 0x20;
+constexpr quint8 WriterGroupIdEnabled = 0x01;
+constexpr quint8 SequenceNumberEnabled = 0x08;
+
+constexpr quint8 DataSetMessageValid = 0x01;
+constexpr quint8 DataSetSequenceNumberEnabled = 0x08;
+constexpr quint8 DataSetFlags2Enabled = 0x80;
+constexpr quint8 KeyFrame = 0;
+constexpr quint8 DeltaFrame = 1;
+
+// Fields of the DataSet in the order of the DataSetMetaData
+enum Field : quint16 {
+    Counter = 0,
+    Sine = 1,
+    Flag = 2,
+    Name = 3
+};
+
+} // namespace
+
+constexpr quint16 UadpPublisher::PublisherId;
+constexpr quint16 UadpPublisher::WriterGroupId;
+constexpr quint16 UadpPublisher::DataSetWriterId;
+constexpr int UadpPublisher::KeyFrameInterval;
+constexpr int UadpPublisher::FieldCount;
+
+UadpPublisher::UadpPublisher(QObject *parent)
+    : QObject(parent)
+{
+    m_timer.setTimerType(Qt::PreciseTimer);
+    m_timer.setInterval(1);
+    connect(&m_timer, &QTimer::timeout, this, &UadpPublisher::publish);
+}
+
+bool UadpPublisher::start(const QUrl &url, double rate, Encoding encoding)
+{
+    if (url.scheme() != QLatin1String("opc.udp") || rate <= 0) {
+        qWarning() << "Invalid PubSub settings" << url << rate;
+        return false;
+    }
+
+    m_address = QHostAddress(url.host());
+    if (m_address.isNull()) {
+        qWarning() << "The PubSub address must be an IP address:" << url;
+        return false;
+    }
+
+    m_port = static_cast<quint16>(url.port(4840));
+    m_rate = rate;
+    m_encoding = encoding;
+    m_messageCount = 0;
+    m_sequenceNumber = 0;
+
+    m_elapsed.start();
+    m_timer.start();
+    return true;
+}
+
+void UadpPublisher::stop()
+{
+    m_timer.stop();
+}
+
+// Sends all messages which are due since the start, the timer is too coarse for rates above 1 kHz
+void UadpPublisher::publish()
+{
+    const quint64 due = static_cast<quint64>(m_elapsed.nsecsElapsed() / 1e9 * m_rate);
+
+    while (m_messageCount < due) {
+        encodeNetworkMessage();
+        if (m_socket.writeDatagram(m_buffer, m_address, m_port) < 0)
+            qWarning() << "Failed to publish the DataSet:" << m_socket.errorString();
+        ++m_messageCount;
+        ++m_sequenceNumber;
+    }
+}
+
+void UadpPublisher::encodeNetworkMessage()
+{
+    m_buffer.resize(0);
+    QOpcUaBinaryDataEncoding encoder(&m_buffer);
+
+    const bool keyFrame = m_encoding == Encoding::RawData || m_messageCount % KeyFrameInterval == 0;
+    const quint32 counter = static_cast<quint32>(m_messageCount);
+    const double sine = qSin(2 * M_PI * m_messageCount / 1000.0);
+
+    // NetworkMessage header
+    encoder.encode<quint8>(UadpVersion | PublisherIdEnabled | GroupHeaderEnabled | PayloadHeaderEnabled | ExtendedFlags1Enabled);
+    encoder.encode<quint8>(PublisherIdTypeUInt16 | TimestampEnabled);
+    encoder.encode<quint16>(PublisherId);
+    encoder.encode<quint8>(WriterGroupIdEnabled | SequenceNumberEnabled);
+    encoder.encode<quint16>(WriterGroupId);
+    encoder.encode<quint16>(m_sequenceNumber);
+    encoder.encode<quint8>(1); // One DataSetMessage
+    encoder.encode<quint16>(DataSetWriterId);
+    encoder.encode<QDateTime>(QDateTime::currentDateTimeUtc());
+
+    // DataSetMessage header
+    const quint8 fieldEncoding = m_encoding == Encoding::RawData ? 0x02 : 0x00;
+    encoder.encode<quint8>(DataSetMessageValid | fieldEncoding | DataSetSequenceNumberEnabled | DataSetFlags2Enabled);
+    encoder.encode<quint8>(keyFrame ? KeyFrame : DeltaFrame);
+    encoder.encode<quint16>(m_sequenceNumber);
+
+    if (m_encoding == Encoding::RawData) {
+        encoder.encode<quint32>(counter);
+        encoder.encode<double>(sine);
+        encoder.encode<bool>((m_messageCount / 1000) % 2);
+        encoder.encode<QString>(QStringLiteral("open62541-testserver"));
+    } else if (keyFrame) {
+        encoder.encode<quint16>(FieldCount);
+        encoder.encode<quint8>(UInt32Id);
+        encoder.encode<quint32>(counter);
+        encoder.encode<quint8>(DoubleId);
+        encoder.encode<double>(sine);
+        encoder.encode<quint8>(BooleanId);
+        encoder.encode<bool>((m_messageCount / 1000) % 2);
+        encoder.encode<quint8>(StringId);
+        encoder.encode<QString>(QStringLiteral("open62541-testserver"));
+    } else {
+        encoder.encode<quint16>(2);
+        encoder.encode<quint16>(Counter);
+        encoder.encode<quint8>(UInt32Id);
+        encoder.encode<quint32>(counter);
+        encoder.encode<quint16>(Sine);
+        encoder.encode<quint8>(DoubleId);
+        encoder.encode<double>(sine);
+    }
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,94 @@
+/****************************************************************************
+**
+** Copyright (C) 2019 The Qt Company Ltd.
+** Contact: http://www.qt.io/licensing/
+**
+** This file is part of the QtOpcUa module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL3$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see http://www.qt.io/terms-conditions. For further
+** information use the contact form at http://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPLv3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or later as published by the Free
+** Software Foundation and appearing in the file LICENSE.GPL included in
+** the packaging of this file. Please review the following information to
+** ensure the GNU General Public License version 2.0 requirements will be
+** met: http://www.gnu.org/licenses/gpl-2.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+#ifndef UADPPUBLISHER_H
+#define UADPPUBLISHER_H
+
+#include <QtCore/QByteArray>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QObject>
+#include <QtCore/QTimer>
+#include <QtCore/QUrl>
+#include <QtNetwork/QHostAddress>
+#include <QtNetwork/QUdpSocket>
+
+QT_BEGIN_NAMESPACE
+
+// Publishes a DataSet with the UADP message mapping of OPC UA PubSub (OPC-UA part 14, 7.2.2).
+// The PubSub support of open62541 is not enabled in the bundled build, so the messages are
+// encoded here. Every KeyFrameInterval-th message is a key frame, the others are delta frames
+// which only contain the fields changed with every message.
+class UadpPublisher : public QObject
+{
+    Q_OBJECT
+public:
+    enum class Encoding {
+        Variant,
+        RawData // Key frames only, delta frames can't be decoded without the DataSetMetaData
+    };
+
+    static constexpr quint16 PublisherId = 2234;
+    static constexpr quint16 WriterGroupId = 100;
+    static constexpr quint16 DataSetWriterId = 62541;
+    static constexpr int KeyFrameInterval = 10;
+
+    // Fields of the published DataSet: Counter (UInt32), Sine (Double), Flag (Boolean), Name (String)
+    static constexpr int FieldCount = 4;
+
+    explicit UadpPublisher(QObject *parent = nullptr);
+
+    bool start(const QUrl &url, double rate, Encoding encoding);
+    void stop();
+
+private:
+    void publish();
+    void encodeNetworkMessage();
+
+    QUdpSocket m_socket;
+    QHostAddress m_address;
+    quint16 m_port = 0;
+    Encoding m_encoding = Encoding::Variant;
+    double m_rate = 0; // Hz
+
+    QTimer m_timer;
+    QElapsedTimer m_elapsed;
+    quint64 m_messageCount = 0;
+    quint16 m_sequenceNumber = 0;
+    QByteArray m_buffer;
+};
+
+QT_END_NAMESPACE
+
+#endif // UADPPUBLISHER_H
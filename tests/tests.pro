@@ -1,6 +1,9 @@
 TEMPLATE = subdirs
 SUBDIRS += auto
 
+# benchmarks in debug mode are rarely sensible
+!qtConfig(debug): SUBDIRS += benchmarks
+
 QT_FOR_CONFIG += opcua-private
 
 qtConfig(open62541) {